@@ -0,0 +1,75 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include "flint.h"
+
+/*
+   The features are detected once, on first use. Only those the library
+   was built with kernels for are reported.
+*/
+
+static int _flint_cpu_features_init = 0;
+static ulong _flint_cpu_features_detected = 0;
+static ulong _flint_cpu_features = 0;
+
+static void _flint_cpu_features_detect(void)
+{
+    ulong features = 0;
+
+#if HAVE_AVX2
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+        features |= FLINT_CPU_AVX2;
+
+    if (__builtin_cpu_supports("fma"))
+        features |= FLINT_CPU_FMA;
+#endif
+
+#if HAVE_AVX512
+    if (__builtin_cpu_supports("avx512f"))
+        features |= FLINT_CPU_AVX512F;
+#endif
+
+    _flint_cpu_features_detected = features;
+    _flint_cpu_features = features;
+    _flint_cpu_features_init = 1;
+}
+
+ulong flint_get_cpu_features(void)
+{
+    if (!_flint_cpu_features_init)
+        _flint_cpu_features_detect();
+
+    return _flint_cpu_features;
+}
+
+void flint_set_cpu_features(ulong features)
+{
+    if (!_flint_cpu_features_init)
+        _flint_cpu_features_detect();
+
+    _flint_cpu_features = features & _flint_cpu_features_detected;
+}
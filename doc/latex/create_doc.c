@@ -78,6 +78,11 @@ static char * docsin[] = {
     "../../fft/doc/fft.txt",
     "../../qsieve/doc/qsieve.txt",
     "../../perm/doc/perm.txt",
+    "../../thread_pool/doc/thread_pool.txt",
+    "../../nmod_ntt/doc/nmod_ntt.txt",
+    "../../nmod_mont/doc/nmod_mont.txt",
+    "../../nmod_sparse_mat/doc/nmod_sparse_mat.txt",
+    "../../gf2_mat/doc/gf2_mat.txt",
     "../../flintxx/doc/flintxx.txt",
     "../../flintxx/doc/genericxx.txt",
 };
@@ -131,6 +136,11 @@ static char * docsout[] = {
     "input/fft.tex",
     "input/qsieve.tex",
     "input/perm.tex",
+    "input/thread_pool.tex",
+    "input/nmod_ntt.tex",
+    "input/nmod_mont.tex",
+    "input/nmod_sparse_mat.tex",
+    "input/gf2_mat.tex",
     "input/flintxx.tex",
     "input/genericxx.tex",
 };
@@ -257,6 +257,47 @@ FLINT_DLL void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n,
                         mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
                                 mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc);
 
+FLINT_DLL void _fft_mfa_truncate_sqrt2_outer_columns(mp_limb_t ** ii,
+                   mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc,
+                             mp_size_t start, mp_size_t end);
+
+FLINT_DLL void _fft_mfa_truncate_sqrt2_inner_rows(mp_limb_t ** ii,
+       mp_limb_t ** jj, mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1,
+       mp_limb_t ** t2, mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc,
+       mp_limb_t * tt, mp_size_t start, mp_size_t end);
+
+FLINT_DLL void _ifft_mfa_truncate_sqrt2_outer_columns(mp_limb_t ** ii,
+                   mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2,
+                             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc,
+                             mp_size_t start, mp_size_t end);
+
+/*
+   The passes of the matrix fourier algorithm are split between threads when
+   flint_get_num_threads() > 1 and the 4n coefficients of (n*w)/FLINT_BITS + 1
+   limbs span at least FFT_MFA_THREADED_CUTOFF limbs.
+*/
+#define FFT_MFA_THREADED_CUTOFF 32768
+
+#define FFT_MFA_OUTER 0
+#define FFT_MFA_INNER 1
+#define FFT_MFA_IFFT_OUTER 2
+
+static __inline__ slong
+_fft_mfa_num_threads(mp_size_t n, mp_bitcnt_t w)
+{
+   slong num_threads = flint_get_num_threads();
+   
+   if (4*n*((n*w)/FLINT_BITS + 1) < FFT_MFA_THREADED_CUTOFF)
+      num_threads = 1;
+
+   return num_threads;
+}
+
+FLINT_DLL void _fft_mfa_truncate_sqrt2_threaded(int pass, mp_limb_t ** ii,
+                  mp_limb_t ** jj, mp_size_t n, mp_bitcnt_t w, mp_size_t n1,
+                                         mp_size_t trunc, slong num_threads);
+
 FLINT_DLL void fft_negacyclic(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w, 
                              mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp);
 
@@ -237,25 +237,27 @@ void fft_mfa_truncate_sqrt2(mp_limb_t ** ii, mp_size_t n,
    }
 }
 
-void fft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, 
+void _fft_mfa_truncate_sqrt2_outer_columns(mp_limb_t ** ii, mp_size_t n, 
                    mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
-                             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+                             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc,
+                             mp_size_t start, mp_size_t end)
 {
    mp_size_t i, j;
    mp_size_t n2 = (2*n)/n1;
    mp_size_t trunc2 = (trunc - 2*n)/n1;
    mp_size_t limbs = (n*w)/FLINT_BITS;
    mp_bitcnt_t depth = 0;
-   mp_bitcnt_t depth2 = 0;
    
    while ((UWORD(1)<<depth) < n2) depth++;
-   while ((UWORD(1)<<depth2) < n1) depth2++;
 
-   /* first half matrix fourier FFT : n2 rows, n1 cols */
-   
-   /* FFTs on columns */
-   for (i = 0; i < n1; i++)
+   /* 
+      each column of the first half only feeds the same column of the second
+      half, so both halves of a column can be done together
+   */
+   for (i = start; i < end; i++)
    {   
+      /* first half matrix fourier FFT : n2 rows, n1 cols */
+   
       /* relevant part of first layer of full sqrt2 FFT */
       if (w & 1)
       {
@@ -302,24 +304,33 @@ void fft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n,
          mp_size_t s = n_revbin(j, depth);
          if (j < s) SWAP_PTRS(ii[i+j*n1], ii[i+s*n1]);
       }
-   }
-      
-   /* second half matrix fourier FFT : n2 rows, n1 cols */
-   ii += 2*n;
 
-   /* FFTs on columns */
-   for (i = 0; i < n1; i++)
-   {   
+      /* second half matrix fourier FFT : n2 rows, n1 cols */
+
       /*
          FFT of length n2 on column i, applying z^{r*i} for rows going up in steps 
          of 1 starting at row 0, where z => w bits
       */
       
-      fft_truncate1_twiddle(ii + i, n1, n2/2, w*n1, t1, t2, w, 0, i, 1, trunc2);
+      fft_truncate1_twiddle(ii + 2*n + i, n1, n2/2, w*n1, t1, t2, w, 0, i, 1, trunc2);
       for (j = 0; j < n2; j++)
       {
          mp_size_t s = n_revbin(j, depth);
-         if (j < s) SWAP_PTRS(ii[i+j*n1], ii[i+s*n1]);
+         if (j < s) SWAP_PTRS(ii[2*n+i+j*n1], ii[2*n+i+s*n1]);
       }
    }
 }
+
+void fft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, 
+                   mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+{
+   slong num_threads = _fft_mfa_num_threads(n, w);
+
+   if (num_threads > 1)
+      _fft_mfa_truncate_sqrt2_threaded(FFT_MFA_OUTER, ii, ii, n, w,
+                                                   n1, trunc, num_threads);
+   else
+      _fft_mfa_truncate_sqrt2_outer_columns(ii, n, w, t1, t2, temp,
+                                                          n1, trunc, 0, n1);
+}
@@ -33,59 +33,64 @@ or implied, of William Hart.
 #include "ulong_extras.h"
 #include "fft.h"
 
-void fft_mfa_truncate_sqrt2_inner(mp_limb_t ** ii, mp_limb_t ** jj, mp_size_t n, 
-                   mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
-                  mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, mp_limb_t * tt)
+void _fft_mfa_truncate_sqrt2_inner_rows(mp_limb_t ** ii, mp_limb_t ** jj,
+                   mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                  mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, mp_limb_t * tt,
+                  mp_size_t start, mp_size_t end)
 {
    mp_size_t i, j, s;
    mp_size_t n2 = (2*n)/n1;
    mp_size_t trunc2 = (trunc - 2*n)/n1;
    mp_size_t limbs = (n*w)/FLINT_BITS;
    mp_bitcnt_t depth = 0;
-   mp_bitcnt_t depth2 = 0;
+   mp_limb_t ** ir, ** jr;
    
    while ((UWORD(1)<<depth) < n2) depth++;
-   while ((UWORD(1)<<depth2) < n1) depth2++;
 
-   ii += 2*n;
-   jj += 2*n;
-
-   /* convolutions on relevant rows */
-   for (s = 0; s < trunc2; s++)
+   /*
+      rows 0, ..., trunc2 - 1 are the relevant rows of the second half,
+      rows trunc2, ..., trunc2 + n2 - 1 are the rows of the first half
+   */
+   for (s = start; s < end; s++)
    {
-      i = n_revbin(s, depth);
-      fft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
-      if (ii != jj) fft_radix2(jj + i*n1, n1/2, w*n2, t1, t2);
-      
-      for (j = 0; j < n1; j++)
+      if (s < trunc2)
       {
-         mp_size_t t = i*n1 + j;
-         mpn_normmod_2expp1(ii[t], limbs);
-         if (ii != jj) mpn_normmod_2expp1(jj[t], limbs);
-         fft_mulmod_2expp1(ii[t], ii[t], jj[t], n, w, tt);
-      }      
-      
-      ifft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
-   }
-
-   ii -= 2*n;
-   jj -= 2*n;
-
-   /* convolutions on rows */
-   for (i = 0; i < n2; i++)
-   {
-      fft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
-      if (ii != jj) fft_radix2(jj + i*n1, n1/2, w*n2, t1, t2);
+         i = n_revbin(s, depth);
+         ir = ii + 2*n + i*n1;
+         jr = jj + 2*n + i*n1;
+      } else
+      {
+         i = s - trunc2;
+         ir = ii + i*n1;
+         jr = jj + i*n1;
+      }
 
+      fft_radix2(ir, n1/2, w*n2, t1, t2);
+      if (ii != jj) fft_radix2(jr, n1/2, w*n2, t1, t2);
+      
       for (j = 0; j < n1; j++)
       {
-         mp_size_t t = i*n1 + j;
-         mpn_normmod_2expp1(ii[t], limbs);
-         if (ii != jj) mpn_normmod_2expp1(jj[t], limbs);
-         fft_mulmod_2expp1(ii[t], ii[t], jj[t], n, w, tt);
+         mpn_normmod_2expp1(ir[j], limbs);
+         if (ii != jj) mpn_normmod_2expp1(jr[j], limbs);
+         fft_mulmod_2expp1(ir[j], ir[j], jr[j], n, w, tt);
       }      
       
-      ifft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
+      ifft_radix2(ir, n1/2, w*n2, t1, t2);
    }
 }
 
+void fft_mfa_truncate_sqrt2_inner(mp_limb_t ** ii, mp_limb_t ** jj, mp_size_t n, 
+                   mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                  mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, mp_limb_t * tt)
+{
+   mp_size_t n2 = (2*n)/n1;
+   mp_size_t trunc2 = (trunc - 2*n)/n1;
+   slong num_threads = _fft_mfa_num_threads(n, w);
+
+   if (num_threads > 1)
+      _fft_mfa_truncate_sqrt2_threaded(FFT_MFA_INNER, ii, jj, n, w,
+                                                   n1, trunc, num_threads);
+   else
+      _fft_mfa_truncate_sqrt2_inner_rows(ii, jj, n, w, t1, t2, temp,
+                                          n1, trunc, tt, 0, trunc2 + n2);
+}
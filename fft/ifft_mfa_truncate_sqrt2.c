@@ -264,8 +264,9 @@ void ifft_mfa_truncate_sqrt2(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w,
    }
 }
 
-void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w, 
-   mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+void _ifft_mfa_truncate_sqrt2_outer_columns(mp_limb_t ** ii, mp_size_t n,
+   mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp,
+                 mp_size_t n1, mp_size_t trunc, mp_size_t start, mp_size_t end)
 {
    mp_size_t i, j;
    mp_size_t n2 = (2*n)/n1;
@@ -273,15 +274,18 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w,
    mp_bitcnt_t depth = 0;
    mp_bitcnt_t depth2 = 0;
    mp_bitcnt_t limbs = (w*n)/FLINT_BITS;
-   
+
    while ((UWORD(1)<<depth) < n2) depth++;
    while ((UWORD(1)<<depth2) < n1) depth2++;
 
-   /* first half mfa IFFT : n2 rows, n1 cols */
-   
-   /* column IFFTs */
-   for (i = 0; i < n1; i++)
+   /*
+      column i of the second half only depends on column i of the first
+      half, so both halves of a column can be done together
+   */
+   for (i = start; i < end; i++)
    {   
+      /* first half mfa IFFT : n2 rows, n1 cols */
+
       for (j = 0; j < n2; j++)
       {
          mp_size_t s = n_revbin(j, depth);
@@ -293,20 +297,16 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w,
          of 1 starting at row 0, where z => w bits
       */
       ifft_radix2_twiddle(ii + i, n1, n2/2, w*n1, t1, t2, w, 0, i, 1);
-   }
-   
-   /* second half IFFT : n2 rows, n1 cols */
-   ii += 2*n;
 
-   /* column IFFTs with relevant sqrt2 layer butterflies combined */
-   for (i = 0; i < n1; i++)
-   {   
+      /* second half IFFT : n2 rows, n1 cols */
+      ii += 2*n;
+
+      /* column IFFT with relevant sqrt2 layer butterflies combined */
       for (j = 0; j < trunc2; j++)
       {
          mp_size_t s = n_revbin(j, depth);
          if (j < s) SWAP_PTRS(ii[i+j*n1], ii[i+s*n1]);
       }
-
       for ( ; j < n2; j++)
       {
          mp_size_t u = i + j*n1;
@@ -366,5 +366,20 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w,
          mpn_div_2expmod_2expp1(ii[t], ii[t], limbs, depth + depth2 + 1);
          mpn_normmod_2expp1(ii[t], limbs);
       }
+
+      ii -= 2*n;
    }
 }
+
+void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w, 
+   mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+{
+   slong num_threads = _fft_mfa_num_threads(n, w);
+
+   if (num_threads > 1)
+      _fft_mfa_truncate_sqrt2_threaded(FFT_MFA_IFFT_OUTER, ii, ii, n, w,
+                                                   n1, trunc, num_threads);
+   else
+      _ifft_mfa_truncate_sqrt2_outer_columns(ii, n, w, t1, t2, temp,
+                                                          n1, trunc, 0, n1);
+}
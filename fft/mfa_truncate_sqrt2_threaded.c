@@ -0,0 +1,159 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include "gmp.h"
+#include "flint.h"
+#include "fft.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+   int pass;
+   mp_limb_t ** ii;
+   mp_limb_t ** jj;
+   mp_size_t n;
+   mp_bitcnt_t w;
+   mp_size_t n1;
+   mp_size_t trunc;
+   mp_size_t start;
+   mp_size_t end;
+   mp_limb_t * t1;
+   mp_limb_t * t2;
+   mp_limb_t * temp;
+   mp_limb_t * tt;
+} fft_mfa_arg_t;
+
+static void *
+_fft_mfa_worker(void * arg_ptr)
+{
+   fft_mfa_arg_t * arg = (fft_mfa_arg_t *) arg_ptr;
+
+   if (arg->pass == FFT_MFA_OUTER)
+      _fft_mfa_truncate_sqrt2_outer_columns(arg->ii, arg->n, arg->w,
+            &arg->t1, &arg->t2, &arg->temp, arg->n1, arg->trunc,
+                                                       arg->start, arg->end);
+   else if (arg->pass == FFT_MFA_INNER)
+      _fft_mfa_truncate_sqrt2_inner_rows(arg->ii, arg->jj, arg->n, arg->w,
+            &arg->t1, &arg->t2, &arg->temp, arg->n1, arg->trunc, arg->tt,
+                                                       arg->start, arg->end);
+   else
+      _ifft_mfa_truncate_sqrt2_outer_columns(arg->ii, arg->n, arg->w,
+            &arg->t1, &arg->t2, &arg->temp, arg->n1, arg->trunc,
+                                                       arg->start, arg->end);
+
+   return NULL;
+}
+
+/*
+   Buffers of ours that ended up in the array ii are replaced by the
+   orphaned buffers of the caller, which ended up in our temporaries.
+*/
+static void
+_fft_mfa_return_buffers(mp_limb_t ** ii, mp_size_t len, mp_limb_t * lo,
+      mp_limb_t * hi, mp_limb_t ** orphans, slong * num_orphans,
+                                                            mp_size_t size)
+{
+   mp_size_t i;
+
+   for (i = 0; i < len; i++)
+   {
+      if (ii[i] >= lo && ii[i] < hi)
+      {
+         mp_limb_t * p = orphans[--(*num_orphans)];
+
+         flint_mpn_copyi(p, ii[i], size);
+         ii[i] = p;
+      }
+   }
+}
+
+void _fft_mfa_truncate_sqrt2_threaded(int pass, mp_limb_t ** ii,
+                  mp_limb_t ** jj, mp_size_t n, mp_bitcnt_t w, mp_size_t n1,
+                                          mp_size_t trunc, slong num_threads)
+{
+   mp_size_t size = (n*w)/FLINT_BITS + 1;
+   mp_size_t n2 = (2*n)/n1;
+   mp_size_t trunc2 = (trunc - 2*n)/n1;
+   mp_size_t count = (pass == FFT_MFA_INNER) ? trunc2 + n2 : n1;
+   slong num_tasks, num_orphans, k;
+   mp_limb_t * buf, * hi, ** orphans;
+   fft_mfa_arg_t * args;
+
+   /* a few tasks per thread so that uneven rows do not leave threads idle */
+   num_tasks = FLINT_MIN(count, 4*num_threads);
+
+   /*
+      each task gets three temporaries, which are swapped with the
+      coefficients, followed by scratch space of two coefficients for the
+      pointwise products
+   */
+   buf = flint_malloc(5*num_tasks*size*sizeof(mp_limb_t));
+   hi = buf + 3*num_tasks*size;
+   args = flint_malloc(num_tasks*sizeof(fft_mfa_arg_t));
+
+   for (k = 0; k < num_tasks; k++)
+   {
+      args[k].pass = pass;
+      args[k].ii = ii;
+      args[k].jj = jj;
+      args[k].n = n;
+      args[k].w = w;
+      args[k].n1 = n1;
+      args[k].trunc = trunc;
+      args[k].start = (k*count)/num_tasks;
+      args[k].end = ((k + 1)*count)/num_tasks;
+      args[k].t1 = buf + 3*k*size;
+      args[k].t2 = args[k].t1 + size;
+      args[k].temp = args[k].t2 + size;
+      args[k].tt = hi + 2*k*size;
+   }
+
+   flint_parallel_do(_fft_mfa_worker, args, sizeof(fft_mfa_arg_t), num_tasks);
+
+   /*
+      The coefficients are permuted with the temporaries by swapping
+      pointers, so some coefficients may now live in our buffers.
+   */
+   orphans = flint_malloc(3*num_tasks*sizeof(mp_limb_t *));
+   num_orphans = 0;
+
+   for (k = 0; k < num_tasks; k++)
+   {
+      if (args[k].t1 < buf || args[k].t1 >= hi)
+         orphans[num_orphans++] = args[k].t1;
+      if (args[k].t2 < buf || args[k].t2 >= hi)
+         orphans[num_orphans++] = args[k].t2;
+      if (args[k].temp < buf || args[k].temp >= hi)
+         orphans[num_orphans++] = args[k].temp;
+   }
+
+   _fft_mfa_return_buffers(ii, 4*n, buf, hi, orphans, &num_orphans, size);
+   if (jj != ii)
+      _fft_mfa_return_buffers(jj, 4*n, buf, hi, orphans, &num_orphans, size);
+
+   flint_free(orphans);
+   flint_free(args);
+   flint_free(buf);
+}
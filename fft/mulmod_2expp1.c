@@ -33,10 +33,15 @@ or implied, of William Hart.
 #include "fft.h"
 #include "longlong.h"
 #include "ulong_extras.h"
-#include "fft_tuning.h"
 #include "mpn_extras.h"
 
-static mp_size_t mulmod_2expp1_table_n[FFT_N_NUM] = MULMOD_TAB;
+/* adjustment of the depth for 2^depth bits, depth >= 12 */
+static __inline__ mp_size_t
+_mulmod_2expp1_off(const flint_tuning_struct * T, mp_bitcnt_t depth)
+{
+   if (depth < 12) return T->mulmod_tab[0];
+   else return T->mulmod_tab[FLINT_MIN(depth, T->mulmod_num + 11) - 12];
+}
 
 void fft_naive_convolution_1(mp_limb_t * r, mp_limb_t * ii, mp_limb_t * jj, mp_size_t m)
 {
@@ -188,6 +193,7 @@ void fft_mulmod_2expp1(mp_limb_t * r, mp_limb_t * i1, mp_limb_t * i2,
    mp_bitcnt_t depth1, depth = 1;
 
    mp_size_t w1, off;
+   const flint_tuning_struct * T = flint_get_tuning();
 
    mp_limb_t c = 2*i1[limbs] + i2[limbs];
       
@@ -203,7 +209,7 @@ void fft_mulmod_2expp1(mp_limb_t * r, mp_limb_t * i1, mp_limb_t * i2,
       return;
    }
 
-   if (limbs <= FFT_MULMOD_2EXPP1_CUTOFF) 
+   if (limbs <= T->fft_mulmod_2expp1_cutoff)
    {
       r[limbs] = flint_mpn_mulmod_2expp1_basecase(r, i1, i2, c, bits, tt);
       return;
@@ -211,8 +217,7 @@ void fft_mulmod_2expp1(mp_limb_t * r, mp_limb_t * i1, mp_limb_t * i2,
    
    while ((UWORD(1)<<depth) < bits) depth++;
    
-   if (depth < 12) off = mulmod_2expp1_table_n[0];
-   else off = mulmod_2expp1_table_n[FLINT_MIN(depth, FFT_N_NUM + 11) - 12];
+   off = _mulmod_2expp1_off(T, depth);
    depth1 = depth/2 - off;
    
    w1 = bits/(UWORD(1)<<(2*depth1));
@@ -226,20 +231,20 @@ slong fft_adjust_limbs(mp_size_t limbs)
    mp_size_t depth = 1, limbs2, depth1 = 1, depth2 = 1, adj;
    mp_size_t off1, off2;
 
-   if (limbs <= FFT_MULMOD_2EXPP1_CUTOFF) return limbs;
+   const flint_tuning_struct * T = flint_get_tuning();
+
+   if (limbs <= T->fft_mulmod_2expp1_cutoff) return limbs;
          
    depth = FLINT_CLOG2(limbs);
    limbs2 = (WORD(1)<<depth); /* within a factor of 2 of limbs */
    bits2 = limbs2*FLINT_BITS;
 
    depth1 = FLINT_CLOG2(bits1);
-   if (depth1 < 12) off1 = mulmod_2expp1_table_n[0];
-   else off1 = mulmod_2expp1_table_n[FLINT_MIN(depth1, FFT_N_NUM + 11) - 12];
+   off1 = _mulmod_2expp1_off(T, depth1);
    depth1 = depth1/2 - off1;
    
    depth2 = FLINT_CLOG2(bits2);
-   if (depth2 < 12) off2 = mulmod_2expp1_table_n[0];
-   else off2 = mulmod_2expp1_table_n[FLINT_MIN(depth2, FFT_N_NUM + 11) - 12];
+   off2 = _mulmod_2expp1_off(T, depth2);
    depth2 = depth2/2 - off2;
    
    depth1 = FLINT_MAX(depth1, depth2);
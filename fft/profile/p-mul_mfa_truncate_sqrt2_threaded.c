@@ -0,0 +1,90 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "profiler.h"
+#include "fft.h"
+
+/*
+    Times mul_mfa_truncate_sqrt2 on integers of a few million limbs with
+    1, 2, 4 and 8 threads.
+*/
+
+int
+main(void)
+{
+    mp_bitcnt_t depth, w;
+    slong num_threads;
+    double truncation;
+    timeit_t t0;
+
+    FLINT_TEST_INIT(state);
+
+    _flint_rand_init_gmp(state);
+
+    w = 2;
+    truncation = 0.5;
+
+    for (depth = 13; depth <= 14; depth++)
+    {
+        mp_size_t n = (UWORD(1)<<depth);
+        mp_bitcnt_t bits1 = (n*w - (depth + 1))/2; 
+        mp_bitcnt_t bits = 2*n*bits1;
+        mp_size_t int_limbs = ((mp_size_t)(truncation*bits))/FLINT_BITS;
+        mp_limb_t * i1, * i2, * r1;
+
+        i1 = flint_malloc(4*int_limbs*sizeof(mp_limb_t));
+        i2 = i1 + int_limbs;
+        r1 = i2 + int_limbs;
+
+        flint_mpn_urandomb(i1, state->gmp_state, int_limbs*FLINT_BITS);
+        flint_mpn_urandomb(i2, state->gmp_state, int_limbs*FLINT_BITS);
+
+        for (num_threads = 1; num_threads <= 8; num_threads *= 2)
+        {
+            flint_set_num_threads(num_threads);
+
+            timeit_start(t0);
+            mul_mfa_truncate_sqrt2(r1, i1, int_limbs, i2, int_limbs, depth, w);
+            timeit_stop(t0);
+
+            flint_printf("limbs = %wd, threads = %wd: cpu = %wd ms, "
+                         "wall = %wd ms\n", int_limbs, num_threads,
+                         t0->cpu, t0->wall);
+        }
+
+        flint_free(i1);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    return 0;
+}
@@ -35,18 +35,324 @@ or implied, of William Hart.
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fft.h"
+#include "fmpz_poly.h"
+#include "fmpz_mat.h"
+#include "nmod_poly.h"
+
+/*
+   If a filename is given, the crossovers of some of the algorithms using
+   the FFT are also measured, with the FFT tuned as above, and everything
+   is written to a tuning profile, which the library loads with
+   flint_tuning_load() or from the environment variable FLINT_TUNING_FILE.
+*/
+
+typedef void (*tune_func_t)(void * arg);
+
+/* seconds per call of f(arg) */
+static double time_func(tune_func_t f, void * arg)
+{
+    clock_t start, end;
+    slong i, reps = 1;
+    double elapsed;
+
+    while (1)
+    {
+        start = clock();
+        for (i = 0; i < reps; i++)
+            f(arg);
+        end = clock();
+
+        elapsed = ((double) (end - start)) / CLOCKS_PER_SEC;
+        if (elapsed >= 0.02)
+            return elapsed / reps;
+
+        reps *= 2;
+    }
+}
+
+typedef struct
+{
+    fmpz * a;
+    fmpz * b;
+    fmpz * r;
+    slong len;
+} poly_arg_t;
+
+static void time_KS(void * arg)
+{
+    poly_arg_t * p = (poly_arg_t *) arg;
+    _fmpz_poly_mul_KS(p->r, p->a, p->len, p->b, p->len);
+}
+
+static void time_SS(void * arg)
+{
+    poly_arg_t * p = (poly_arg_t *) arg;
+    _fmpz_poly_mul_SS(p->r, p->a, p->len, p->b, p->len);
+}
+
+/* time of KS divided by time of SS for len coefficients of the given limbs */
+static double
+KS_over_SS(flint_rand_t state, slong len, slong limbs1, slong limbs2)
+{
+    poly_arg_t p;
+    double t1, t2;
+    slong i;
+
+    p.len = len;
+    p.a = _fmpz_vec_init(len);
+    p.b = _fmpz_vec_init(len);
+    p.r = _fmpz_vec_init(2*len - 1);
+
+    for (i = 0; i < len; i++)
+    {
+        fmpz_randbits(p.a + i, state, limbs1*FLINT_BITS);
+        fmpz_randbits(p.b + i, state, limbs2*FLINT_BITS);
+    }
+
+    t1 = time_func(time_KS, &p);
+    t2 = time_func(time_SS, &p);
+
+    _fmpz_vec_clear(p.a, len);
+    _fmpz_vec_clear(p.b, len);
+    _fmpz_vec_clear(p.r, 2*len - 1);
+
+    return t1/t2;
+}
+
+static void tune_fmpz_poly_mul(flint_tuning_t T, flint_rand_t state)
+{
+    slong limbs, ratio, wins = 0;
+
+    /* total limbs of the coefficients above which SS beats KS */
+    for (limbs = 2; limbs <= 64 && wins < 2; limbs++)
+    {
+        if (KS_over_SS(state, 128, limbs/2, limbs - limbs/2) > 1.0)
+            wins++;
+        else
+            wins = 0;
+    }
+
+    T->fmpz_poly_mul_KS_limbs = limbs - 1 - wins;
+
+    /* length, in multiples of the bits, above which KS wins again */
+    limbs = T->fmpz_poly_mul_KS_limbs + 2;
+    for (ratio = 1; ratio < 8; ratio++)
+    {
+        if (KS_over_SS(state, ratio*limbs*FLINT_BITS/2,
+                                        limbs/2, limbs - limbs/2) < 1.0)
+            break;
+    }
+
+    T->fmpz_poly_mul_KS_len_ratio = ratio;
+}
+
+typedef struct
+{
+    fmpz_mat_struct * A;
+    fmpz_mat_struct * B;
+    fmpz_mat_struct * C;
+    slong bits;
+} mat_arg_t;
+
+static void time_mat_mul(void * arg)
+{
+    mat_arg_t * p = (mat_arg_t *) arg;
+    fmpz_mat_mul(p->C, p->A, p->B);
+}
+
+static void time_mat_classical(void * arg)
+{
+    mat_arg_t * p = (mat_arg_t *) arg;
+    fmpz_mat_mul_classical_inline(p->C, p->A, p->B);
+}
+
+static void time_mat_strassen(void * arg)
+{
+    mat_arg_t * p = (mat_arg_t *) arg;
+    fmpz_mat_mul_strassen(p->C, p->A, p->B);
+}
+
+static void time_mat_multi_mod(void * arg)
+{
+    mat_arg_t * p = (mat_arg_t *) arg;
+    _fmpz_mat_mul_multi_mod(p->C, p->A, p->B, p->bits);
+}
+
+/* time of f1 divided by time of f2 for dim x dim matrices */
+static double mat_ratio(flint_rand_t state, slong dim, slong bits,
+                        tune_func_t f1, tune_func_t f2)
+{
+    fmpz_mat_t A, B, C;
+    mat_arg_t p;
+    double t1, t2;
+
+    fmpz_mat_init(A, dim, dim);
+    fmpz_mat_init(B, dim, dim);
+    fmpz_mat_init(C, dim, dim);
+    fmpz_mat_randbits(A, state, bits);
+    fmpz_mat_randbits(B, state, bits);
+
+    p.A = A;
+    p.B = B;
+    p.C = C;
+    p.bits = 2*bits + FLINT_BIT_COUNT(dim) + 1;
+
+    t1 = time_func(f1, &p);
+    t2 = time_func(f2, &p);
+
+    fmpz_mat_clear(A);
+    fmpz_mat_clear(B);
+    fmpz_mat_clear(C);
+
+    return t1/t2;
+}
+
+static void tune_fmpz_mat_mul(flint_tuning_t T, flint_rand_t state)
+{
+    slong dim, wins = 0, cutoff = T->fmpz_mat_mul_classical_cutoff;
+
+    /* classical against whatever is used above the cutoff */
+    T->fmpz_mat_mul_classical_cutoff = 1;
+    flint_set_tuning(T);
+
+    for (dim = 4; dim <= 64 && wins < 2; dim++)
+    {
+        if (mat_ratio(state, dim, FLINT_BITS/4,
+                      time_mat_classical, time_mat_mul) > 1.0)
+            wins++;
+        else
+            wins = 0;
+    }
+
+    cutoff = (wins == 2) ? dim - 2 : cutoff;
+    T->fmpz_mat_mul_classical_cutoff = cutoff;
+    flint_set_tuning(T);
+
+    /* Strassen against multi-modular for entries too large for one limb */
+    wins = 0;
+    for (dim = 20; dim <= 200 && wins < 2; dim += 10)
+    {
+        if (mat_ratio(state, dim, FLINT_BITS/2,
+                      time_mat_strassen, time_mat_multi_mod) > 1.0)
+            wins++;
+        else
+            wins = 0;
+    }
+
+    T->fmpz_mat_mul_strassen_cutoff = dim - 10*wins;
+}
+
+typedef struct
+{
+    nmod_poly_struct * a;
+    nmod_poly_struct * b;
+    nmod_poly_struct * g;
+} gcd_arg_t;
+
+static void time_gcd_euclidean(void * arg)
+{
+    gcd_arg_t * p = (gcd_arg_t *) arg;
+    nmod_poly_gcd_euclidean(p->g, p->a, p->b);
+}
+
+static void time_gcd_hgcd(void * arg)
+{
+    gcd_arg_t * p = (gcd_arg_t *) arg;
+    nmod_poly_gcd_hgcd(p->g, p->a, p->b);
+}
+
+/* times of f1 and f2, in t[0] and t[1], for a gcd of length len modulo n */
+static void gcd_times(double * t, flint_rand_t state, slong len, mp_limb_t n,
+                      tune_func_t f1, tune_func_t f2)
+{
+    nmod_poly_t a, b, g;
+    gcd_arg_t p;
+
+    nmod_poly_init(a, n);
+    nmod_poly_init(b, n);
+    nmod_poly_init(g, n);
+    do {
+        nmod_poly_randtest(a, state, len);
+    } while (a->length != len);
+    do {
+        nmod_poly_randtest(b, state, len - 1);
+    } while (b->length != len - 1);
+
+    p.a = a;
+    p.b = b;
+    p.g = g;
+
+    t[0] = time_func(f1, &p);
+    if (f2 != NULL)
+        t[1] = time_func(f2, &p);
+
+    nmod_poly_clear(a);
+    nmod_poly_clear(b);
+    nmod_poly_clear(g);
+}
+
+/* length at which HGCD overtakes the Euclidean algorithm modulo n */
+static slong gcd_cutoff(flint_rand_t state, mp_limb_t n)
+{
+    slong len, wins = 0;
+    double t[2];
+
+    for (len = 50; len <= 2000 && wins < 2; len += 50)
+    {
+        gcd_times(t, state, len, n, time_gcd_euclidean, time_gcd_hgcd);
+
+        if (t[0] > t[1])
+            wins++;
+        else
+            wins = 0;
+    }
+
+    return len - 50*wins;
+}
+
+static void tune_nmod_poly_gcd(flint_tuning_t T, flint_rand_t state)
+{
+    mp_limb_t n = n_nextprime(UWORD(1) << (FLINT_BITS - 2), 1);
+    slong cutoff, best_cutoff = T->nmod_poly_hgcd_cutoff;
+    double t[2], best = 0.0;
+
+    /* the basecase cutoff of HGCD minimising the time of a long gcd */
+    for (cutoff = 20; cutoff <= 400; cutoff += 20)
+    {
+        T->nmod_poly_hgcd_cutoff = cutoff;
+        flint_set_tuning(T);
+
+        gcd_times(t, state, 4000, n, time_gcd_hgcd, NULL);
+
+        if (cutoff == 20 || t[0] < best)
+        {
+            best = t[0];
+            best_cutoff = cutoff;
+        }
+    }
+
+    T->nmod_poly_hgcd_cutoff = best_cutoff;
+    flint_set_tuning(T);
+
+    T->nmod_poly_gcd_cutoff = gcd_cutoff(state, n);
+    T->nmod_poly_small_gcd_cutoff = gcd_cutoff(state, 251);
+}
 
 int
-main(void)
+main(int argc, char * argv[])
 {
     mp_bitcnt_t depth, w, depth1, w1;
     clock_t start, end;
     double elapsed;
     double best = 0.0;
     mp_size_t best_off, off, best_d, best_w;
+    slong num = 0;
+    flint_tuning_t T;
 
     FLINT_TEST_INIT(state);
 
+    flint_tuning_init_default(T);
+
     flint_printf("/* fft_tuning.h -- autogenerated by tune-fft */\n\n");
     flint_printf("#ifndef FFT_TUNING_H\n");
     flint_printf("#define FFT_TUNING_H\n\n");
@@ -103,6 +409,7 @@ main(void)
             }
            
             flint_printf("%wd", best_off); 
+            T->fft_tab[depth - 6][w - 1] = best_off;
             if (w != 2) flint_printf(",");
             flint_printf(" "); fflush(stdout);
 
@@ -181,6 +488,8 @@ main(void)
             }
 
             flint_printf("%wd", best_off); 
+            if (num < FLINT_TUNING_MULMOD_TAB_MAX - 1)
+               T->mulmod_tab[num++] = best_off;
             if (w != 2) flint_printf(", "); fflush(stdout);
 
             flint_free(i1);
@@ -188,13 +497,42 @@ main(void)
         flint_printf(", "); fflush(stdout);
     }
     flint_printf("1 }\n\n");
+    T->mulmod_tab[num++] = 1;
+    T->mulmod_num = num;
+    while (num < FLINT_TUNING_MULMOD_TAB_MAX)
+       T->mulmod_tab[num++] = 1;
     
     flint_printf("#define FFT_N_NUM %wd\n\n", 2*(depth - 12) + 1);
     
     flint_printf("#define FFT_MULMOD_2EXPP1_CUTOFF %wd\n\n", ((mp_limb_t) 1 << best_d)*best_w/(2*FLINT_BITS));
-    
-    flint_randclear(state);
+    T->fft_mulmod_2expp1_cutoff = FLINT_MAX(2048/FLINT_BITS,
+                             ((mp_limb_t) 1 << best_d)*best_w/(2*FLINT_BITS));
     
     flint_printf("#endif\n");
+    fflush(stdout);
+
+    if (argc > 1)
+    {
+       flint_set_tuning(T);
+
+       tune_fmpz_poly_mul(T, state);
+       flint_set_tuning(T);
+
+       tune_fmpz_mat_mul(T, state);
+       flint_set_tuning(T);
+
+       tune_nmod_poly_gcd(T, state);
+       flint_set_tuning(T);
+
+       if (!flint_tuning_save(argv[1]))
+       {
+          flint_fprintf(stderr, "Unable to write %s\n", argv[1]);
+          flint_randclear(state);
+          return 1;
+       }
+    }
+    
+    flint_randclear(state);
+
     return 0;
 }
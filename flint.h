@@ -99,6 +99,14 @@ void * flint_realloc(void * ptr, size_t size);
 void * flint_calloc(size_t num, size_t size);
 FLINT_DLL void flint_free(void * ptr);
 
+FLINT_DLL void __flint_set_memory_functions(void *(*alloc_func) (size_t),
+            void *(*calloc_func) (size_t, size_t),
+            void *(*realloc_func) (void *, size_t), void (*free_func) (void *));
+FLINT_DLL void __flint_get_memory_functions(void *(**alloc_func) (size_t),
+            void *(**calloc_func) (size_t, size_t),
+            void *(**realloc_func) (void *, size_t),
+            void (**free_func) (void *));
+
 typedef void (*flint_cleanup_function_t)(void);
 FLINT_DLL void flint_register_cleanup_function(flint_cleanup_function_t cleanup_function);
 FLINT_DLL void flint_cleanup(void);
@@ -145,6 +153,42 @@ FLINT_DLL void flint_cleanup(void);
 FLINT_DLL int flint_get_num_threads(void);
 FLINT_DLL void flint_set_num_threads(int num_threads);
 
+/* instruction set extensions usable by kernels selected at runtime */
+#define FLINT_CPU_AVX2    UWORD(1)
+#define FLINT_CPU_FMA     UWORD(2)
+#define FLINT_CPU_AVX512F UWORD(4)
+
+FLINT_DLL ulong flint_get_cpu_features(void);
+FLINT_DLL void flint_set_cpu_features(ulong features);
+
+/* crossover points read by dispatch code, loadable from a profile */
+#define FLINT_TUNING_MULMOD_TAB_MAX 32
+
+typedef struct
+{
+    int fft_tab[5][2];          /* depth/w adjustment for 2^6 <= n < 2^11 */
+    int mulmod_tab[FLINT_TUNING_MULMOD_TAB_MAX]; /* from depth 2^12 up */
+    slong mulmod_num;
+    slong fft_mulmod_2expp1_cutoff;     /* limbs, basecase -> FFT */
+    slong fmpz_poly_mul_KS_limbs;       /* total limbs, KS -> SS */
+    slong fmpz_poly_mul_KS_len_ratio;   /* KS if len > ratio * bits */
+    slong fmpz_mat_mul_classical_cutoff;    /* dim, classical -> others */
+    slong fmpz_mat_mul_strassen_cutoff;     /* dim, Strassen -> multi-mod */
+    slong nmod_poly_hgcd_cutoff;        /* basecase -> recursion */
+    slong nmod_poly_gcd_cutoff;         /* Euclidean -> HGCD */
+    slong nmod_poly_small_gcd_cutoff;   /* the same for moduli < 2^8 */
+} flint_tuning_struct;
+
+typedef flint_tuning_struct flint_tuning_t[1];
+
+FLINT_DLL void flint_tuning_init_default(flint_tuning_t T);
+FLINT_DLL const flint_tuning_struct * flint_get_tuning(void);
+FLINT_DLL void flint_set_tuning(const flint_tuning_t T);
+FLINT_DLL int flint_tuning_fprint(FILE * file, const flint_tuning_t T);
+FLINT_DLL int flint_tuning_fread(FILE * file, flint_tuning_t T);
+FLINT_DLL int flint_tuning_load(const char * filename);
+FLINT_DLL int flint_tuning_save(const char * filename);
+
 FLINT_DLL int flint_test_multiplier(void);
 
 typedef struct
@@ -278,6 +322,41 @@ unsigned int FLINT_BIT_COUNT(mp_limb_t x)
    } while (0)
 
 /* temporary allocation */
+#if HAVE_TLS
+
+/*
+   Allocations too large for alloca are taken from a thread local scratch
+   stack, which is rewound by TMP_END
+*/
+typedef struct
+{
+    void * chunk;
+    size_t used;
+    int active;
+} flint_tmp_mark_struct;
+
+typedef flint_tmp_mark_struct flint_tmp_mark_t[1];
+
+FLINT_DLL void * _flint_tmp_alloc(flint_tmp_mark_t mark, size_t size);
+FLINT_DLL void _flint_tmp_release(flint_tmp_mark_t mark);
+
+#define TMP_INIT \
+   flint_tmp_mark_t __tmp_mark
+
+#define TMP_START \
+   __tmp_mark->active = 0
+
+#define TMP_ALLOC(size) \
+   ((size) > 8192 ? _flint_tmp_alloc(__tmp_mark, (size)) : alloca(size))
+
+#define TMP_END \
+   do { \
+      if (__tmp_mark->active) \
+         _flint_tmp_release(__tmp_mark); \
+   } while (0)
+
+#else
+
 #define TMP_INIT \
    typedef struct __tmp_struct { \
       void * block; \
@@ -303,6 +382,8 @@ unsigned int FLINT_BIT_COUNT(mp_limb_t x)
       __tmp_root = __tmp_root->next; \
    }
 
+#endif
+
 /* compatibility between gmp and mpir */
 #ifndef mpn_com_n
 #define mpn_com_n mpn_com
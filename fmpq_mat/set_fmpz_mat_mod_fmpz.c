@@ -24,53 +24,109 @@
 ******************************************************************************/
 
 #include "fmpq_mat.h"
+#include "thread_pool.h"
 
-int
-fmpq_mat_set_fmpz_mat_mod_fmpz(fmpq_mat_t X,
-                                    const fmpz_mat_t Xmod, const fmpz_t mod)
+/*
+   Blocks of rows are reconstructed by different threads. Within a block,
+   each entry is multiplied by the product of the denominators found so
+   far before being reconstructed, so that once the common denominator
+   is known most entries reduce to small integers and the extended
+   Euclidean algorithm is not run.
+*/
+
+typedef struct
 {
-    fmpz_t num, den, t, u, d;
-    slong i, j;
+    fmpq_mat_struct * X;
+    const fmpz_mat_struct * Xmod;
+    const fmpz * mod;
+    const fmpz * N;
+    slong r0;
+    slong r1;
+    int success;
+}
+_reconstruct_arg_t;
 
-    int success = 1;
+static void *
+_fmpq_mat_reconstruct_worker(void * arg_ptr)
+{
+    _reconstruct_arg_t * arg = (_reconstruct_arg_t *) arg_ptr;
+    fmpz_t num, den, t, d;
+    slong i, j;
 
     fmpz_init(num);
     fmpz_init(den);
     fmpz_init(d);
     fmpz_init(t);
-    fmpz_init(u);
 
     fmpz_one(d);
+    arg->success = 1;
 
-    for (i = 0; i < Xmod->r; i++)
+    for (i = arg->r0; i < arg->r1 && arg->success; i++)
     {
-        for (j = 0; j < Xmod->c; j++)
+        for (j = 0; j < arg->Xmod->c; j++)
         {
-            /* TODO: handle various special cases efficiently; zeros,
-                     small integers, etc. */
-            fmpz_mul(t, d, fmpz_mat_entry(Xmod, i, j));
-            fmpz_fdiv_qr(u, t, t, mod);
+            fmpz_mul(t, d, fmpz_mat_entry(arg->Xmod, i, j));
+            fmpz_mod(t, t, arg->mod);
 
-            success = _fmpq_reconstruct_fmpz(num, den, t, mod);
+            arg->success = _fmpq_reconstruct_fmpz_2(num, den, t,
+                                                arg->mod, arg->N, arg->N);
+            if (!arg->success)
+                break;
 
-            fmpz_mul(den, den, d);
-            fmpz_set(d, den);
+            fmpz_mul(d, d, den);
 
-            if (!success)
-                goto cleanup;
-
-            fmpz_set(fmpq_mat_entry_num(X, i, j), num);
-            fmpz_set(fmpq_mat_entry_den(X, i, j), den);
-            fmpq_canonicalise(fmpq_mat_entry(X, i, j));
+            fmpz_swap(fmpq_mat_entry_num(arg->X, i, j), num);
+            fmpz_set(fmpq_mat_entry_den(arg->X, i, j), d);
+            fmpq_canonicalise(fmpq_mat_entry(arg->X, i, j));
         }
     }
 
-cleanup:
     fmpz_clear(num);
     fmpz_clear(den);
     fmpz_clear(d);
     fmpz_clear(t);
-    fmpz_clear(u);
+
+    return NULL;
+}
+
+int
+fmpq_mat_set_fmpz_mat_mod_fmpz(fmpq_mat_t X,
+                                    const fmpz_mat_t Xmod, const fmpz_t mod)
+{
+    _reconstruct_arg_t * args;
+    slong i, num_tasks;
+    fmpz_t N;
+    int success = 1;
+
+    if (Xmod->r == 0 || Xmod->c == 0)
+        return 1;
+
+    /* the bound used for both numerators and denominators */
+    fmpz_init(N);
+    fmpz_fdiv_q_2exp(N, mod, 1);
+    fmpz_sqrt(N, N);
+
+    num_tasks = FLINT_MIN(flint_get_num_threads(), Xmod->r);
+    args = flint_malloc(sizeof(_reconstruct_arg_t) * num_tasks);
+
+    for (i = 0; i < num_tasks; i++)
+    {
+        args[i].X = X;
+        args[i].Xmod = Xmod;
+        args[i].mod = mod;
+        args[i].N = N;
+        args[i].r0 = (i * Xmod->r) / num_tasks;
+        args[i].r1 = ((i + 1) * Xmod->r) / num_tasks;
+    }
+
+    flint_parallel_do(_fmpq_mat_reconstruct_worker, args,
+                      sizeof(_reconstruct_arg_t), num_tasks);
+
+    for (i = 0; i < num_tasks; i++)
+        success = success && args[i].success;
+
+    flint_free(args);
+    fmpz_clear(N);
 
     return success;
 }
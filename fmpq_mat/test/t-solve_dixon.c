@@ -52,6 +52,8 @@ main(void)
         m = n_randint(state, 10);
         bits = 1 + n_randint(state, 100);
 
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         fmpq_mat_init(A, n, n);
         fmpq_mat_init(B, n, m);
         fmpq_mat_init(X, n, m);
@@ -135,6 +137,8 @@ main(void)
         fmpz_clear(den);
     }
 
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
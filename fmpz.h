@@ -67,6 +67,61 @@ typedef struct
 
 typedef fmpz_preinvn_struct fmpz_preinvn_t[1];
 
+/*
+    Fixed base exponentiation modulo m: powers[i] = g^(2^(w i)) mod m for
+    0 <= i < num, so that exponents of up to w num bits need no squarings.
+*/
+typedef struct
+{
+   fmpz_t m;
+   fmpz_preinvn_t minv;
+   fmpz * powers;
+   slong num;
+   slong w;
+} fmpz_powm_fixed_struct;
+
+typedef fmpz_powm_fixed_struct fmpz_powm_fixed_t[1];
+
+/*
+    Pohlig-Hellman data for discrete logarithms modulo a prime p whose
+    p - 1 has only word sized prime factors, as for n_discrete_log_ph_t.
+    The BSGS tables hold the least significant limbs of the baby steps.
+*/
+typedef struct
+{
+   mp_limb_t q;
+   ulong e;
+   fmpz_t cofactor;
+   fmpz_t idem;
+   fmpz_t gamma;
+   fmpz_t alphainv;
+   fmpz_t giant;
+   mp_limb_t m;
+   n_pair_t * table;
+} fmpz_discrete_log_ph_entry_struct;
+
+typedef struct
+{
+   fmpz_t p;
+   fmpz_t pm1;
+   fmpz_preinvn_t pinv;
+   fmpz_t g;
+   slong num;
+   fmpz_discrete_log_ph_entry_struct * entries;
+} fmpz_discrete_log_ph_struct;
+
+typedef fmpz_discrete_log_ph_struct fmpz_discrete_log_ph_t[1];
+
+typedef struct
+{
+   ulong hits;          /* mpz's reused from a cache */
+   ulong misses;        /* mpz's newly allocated */
+   ulong batches_in;    /* batches taken from the shared pool */
+   ulong batches_out;   /* batches handed to the shared pool */
+} fmpz_mpz_cache_stats_struct;
+
+typedef fmpz_mpz_cache_stats_struct fmpz_mpz_cache_stats_t[1];
+
 /* maximum positive value a small coefficient can have */
 #define COEFF_MAX ((WORD(1) << (FLINT_BITS - 2)) - WORD(1))
 
@@ -75,6 +130,10 @@ typedef fmpz_preinvn_struct fmpz_preinvn_t[1];
 
 #define COEFF_IS_MPZ(x) (((x) >> (FLINT_BITS - 2)) == WORD(1))  /* is x a pointer not an integer */
 
+/* limbs kept in the same block as the header of a large fmpz, in builds
+   configured with --enable-fmpz-inline */
+#define FMPZ_INLINE_LIMBS 8
+
 __mpz_struct * _fmpz_new_mpz(void);
 
 FLINT_DLL void _fmpz_clear_mpz(fmpz f);
@@ -83,6 +142,10 @@ FLINT_DLL void _fmpz_cleanup_mpz_content(void);
 
 FLINT_DLL void _fmpz_cleanup(void);
 
+FLINT_DLL void _fmpz_mpz_cache_get_stats(fmpz_mpz_cache_stats_t stats);
+
+FLINT_DLL void _fmpz_mpz_cache_reset_stats(void);
+
 __mpz_struct * _fmpz_promote(fmpz_t f);
 
 __mpz_struct * _fmpz_promote_val(fmpz_t f);
@@ -103,6 +166,12 @@ FLINT_DLL void _fmpz_init_readonly_mpz(fmpz_t f, const mpz_t z);
 
 FLINT_DLL void _fmpz_clear_readonly_mpz(mpz_t);
 
+FLINT_DLL mp_size_t _fmpz_mpn_add_signed(mp_ptr r, mp_srcptr x, mp_size_t xs,
+                                                 mp_srcptr y, mp_size_t ys);
+
+FLINT_DLL mp_size_t _fmpz_mpn_mul_signed(mp_ptr r, mp_srcptr x, mp_size_t xs,
+                                                 mp_srcptr y, mp_size_t ys);
+
 FMPZ_INLINE
 void fmpz_init(fmpz_t f)
 {
@@ -457,6 +526,34 @@ FLINT_DLL void fmpz_powm_ui(fmpz_t f, const fmpz_t g, ulong exp, const fmpz_t m)
 
 FLINT_DLL void fmpz_powm(fmpz_t f, const fmpz_t g, const fmpz_t e, const fmpz_t m);
 
+FLINT_DLL void _fmpz_mulmod_preinvn(fmpz_t f, const fmpz_t a, const fmpz_t b,
+                       const fmpz_t m, const fmpz_preinvn_t minv, fmpz_t t);
+
+FLINT_DLL void fmpz_powm_fixed_init(fmpz_powm_fixed_t P, const fmpz_t g,
+                                         const fmpz_t m, mp_bitcnt_t ebits);
+
+FLINT_DLL void fmpz_powm_fixed_clear(fmpz_powm_fixed_t P);
+
+FLINT_DLL void fmpz_powm_fixed(fmpz_t f, const fmpz_t e,
+                                              const fmpz_powm_fixed_t P);
+
+FLINT_DLL void fmpz_powm_fixed_vec(fmpz * f, const fmpz * e, slong len,
+                                              const fmpz_powm_fixed_t P);
+
+FLINT_DLL void fmpz_powm_multi(fmpz_t f, const fmpz * g, const fmpz * e,
+                                                 slong n, const fmpz_t m);
+
+FLINT_DLL int fmpz_discrete_log_ph_init(fmpz_discrete_log_ph_t L,
+                                                           const fmpz_t p);
+
+FLINT_DLL void fmpz_discrete_log_ph_clear(fmpz_discrete_log_ph_t L);
+
+FLINT_DLL void fmpz_discrete_log_ph_run(fmpz_t x,
+                          const fmpz_discrete_log_ph_t L, const fmpz_t b);
+
+FLINT_DLL int fmpz_discrete_log_ph(fmpz_t x, const fmpz_t b,
+                                         const fmpz_t a, const fmpz_t p);
+
 FLINT_DLL void fmpz_setbit(fmpz_t f, ulong i);
 
 FLINT_DLL int fmpz_tstbit(const fmpz_t f, ulong i);
@@ -735,6 +832,8 @@ FLINT_DLL int fmpz_is_strong_probabprime(const fmpz_t n, const fmpz_t a);
 
 FLINT_DLL int fmpz_is_probabprime(const fmpz_t p);
 
+FLINT_DLL void fmpz_is_probabprime_vec(int * res, const fmpz * v, slong len);
+
 FLINT_DLL int fmpz_is_prime_pseudosquare(const fmpz_t n);
 
 FLINT_DLL void _fmpz_nm1_trial_factors(const fmpz_t n, mp_ptr pm1, 
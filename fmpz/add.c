@@ -62,8 +62,17 @@ void fmpz_add(fmpz_t f, const fmpz_t g, const fmpz_t h)
             __mpz_struct * mpz3 = _fmpz_promote(f);  /* aliasing means f is already large */
             __mpz_struct * mpz1 = COEFF_TO_PTR(c1);
             __mpz_struct * mpz2 = COEFF_TO_PTR(c2);
-            mpz_add(mpz3, mpz1, mpz2);
-            _fmpz_demote_val(f);  /* may have cancelled */
+            mp_size_t s1 = mpz1->_mp_size, s2 = mpz2->_mp_size;
+            mp_size_t n = FLINT_MAX(FLINT_ABS(s1), FLINT_ABS(s2)) + 1;
+
+            if (mpz3->_mp_alloc < n)
+                _mpz_realloc(mpz3, n);
+
+            mpz3->_mp_size = _fmpz_mpn_add_signed(mpz3->_mp_d,
+                                      mpz1->_mp_d, s1, mpz2->_mp_d, s2);
+
+            if ((s1 ^ s2) < 0)
+                _fmpz_demote_val(f);  /* may have cancelled */
         }
     }
 }
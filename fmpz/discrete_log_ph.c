@@ -0,0 +1,84 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+
+int fmpz_discrete_log_ph(fmpz_t x, const fmpz_t b, const fmpz_t a,
+                                                            const fmpz_t p)
+{
+    fmpz_discrete_log_ph_t L;
+    fmpz_t la, lb, n, d;
+
+    if (!fmpz_discrete_log_ph_init(L, p))
+    {
+        fmpz_discrete_log_ph_clear(L);
+        return 0;
+    }
+
+    fmpz_init(la);
+    fmpz_init(lb);
+    fmpz_init(n);
+    fmpz_init(d);
+
+    fmpz_discrete_log_ph_run(la, L, a);
+    fmpz_discrete_log_ph_run(lb, L, b);
+
+    /* a^x = b exactly when la x = lb mod p - 1 */
+    fmpz_set(n, L->pm1);
+    fmpz_gcd(d, la, n);
+
+    if (!fmpz_divisible(lb, d))
+    {
+        flint_printf("Exception (fmpz_discrete_log_ph).  "
+                     "discrete log not found.\n");
+        abort();
+    }
+
+    fmpz_divexact(n, n, d);
+    fmpz_divexact(la, la, d);
+    fmpz_divexact(lb, lb, d);
+
+    if (fmpz_is_one(n))
+        fmpz_zero(x);
+    else
+    {
+        fmpz_invmod(la, la, n);
+        fmpz_mul(x, lb, la);
+        fmpz_mod(x, x, n);
+    }
+
+    fmpz_discrete_log_ph_clear(L);
+    fmpz_clear(la);
+    fmpz_clear(lb);
+    fmpz_clear(n);
+    fmpz_clear(d);
+
+    return 1;
+}
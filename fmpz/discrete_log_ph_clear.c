@@ -0,0 +1,56 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+
+void fmpz_discrete_log_ph_clear(fmpz_discrete_log_ph_t L)
+{
+    fmpz_discrete_log_ph_entry_struct * E;
+    slong i;
+
+    for (i = 0; i < L->num; i++)
+    {
+        E = L->entries + i;
+
+        fmpz_clear(E->cofactor);
+        fmpz_clear(E->idem);
+        fmpz_clear(E->gamma);
+        fmpz_clear(E->alphainv);
+        fmpz_clear(E->giant);
+        flint_free(E->table);
+    }
+
+    flint_free(L->entries);
+
+    fmpz_clear(L->p);
+    fmpz_clear(L->pm1);
+    fmpz_preinvn_clear(L->pinv);
+    fmpz_clear(L->g);
+}
@@ -0,0 +1,165 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+
+static int
+_n_pair_cmp(const void * a, const void * b)
+{
+    const n_pair_t * x = (const n_pair_t *) a;
+    const n_pair_t * y = (const n_pair_t *) b;
+
+    if (x->x != y->x)
+        return (x->x < y->x) ? -1 : 1;
+
+    return (x->y < y->y) ? -1 : (x->y > y->y);
+}
+
+int fmpz_discrete_log_ph_init(fmpz_discrete_log_ph_t L, const fmpz_t p)
+{
+    fmpz_discrete_log_ph_entry_struct * E;
+    fmpz_factor_t fac;
+    fmpz_t t, u, c, ginv;
+    mp_limb_t j;
+    ulong g;
+    slong i;
+
+    fmpz_init_set(L->p, p);
+    fmpz_init(L->pm1);
+    fmpz_sub_ui(L->pm1, p, 1);
+    fmpz_preinvn_init(L->pinv, L->p);
+    fmpz_init(L->g);
+    L->num = 0;
+    L->entries = NULL;
+
+    if (fmpz_cmp_ui(p, 2) <= 0)
+    {
+        fmpz_one(L->g);
+        return 1;
+    }
+
+    fmpz_factor_init(fac);
+    fmpz_factor(fac, L->pm1);
+
+    for (i = 0; i < fac->num; i++)
+    {
+        if (!fmpz_abs_fits_ui(fac->p + i))
+        {
+            fmpz_factor_clear(fac);
+            return 0;
+        }
+    }
+
+    fmpz_init(t);
+    fmpz_init(u);
+    fmpz_init(c);
+    fmpz_init(ginv);
+
+    /* the least primitive root */
+    for (g = 2; ; g++)
+    {
+        fmpz_set_ui(L->g, g);
+
+        for (i = 0; i < fac->num; i++)
+        {
+            fmpz_divexact(t, L->pm1, fac->p + i);
+            fmpz_powm(t, L->g, t, L->p);
+            if (fmpz_is_one(t))
+                break;
+        }
+
+        if (i == fac->num)
+            break;
+    }
+
+    fmpz_invmod(ginv, L->g, L->p);
+
+    L->num = fac->num;
+    L->entries = (fmpz_discrete_log_ph_entry_struct *)
+        flint_malloc(fac->num * sizeof(fmpz_discrete_log_ph_entry_struct));
+
+    for (i = 0; i < fac->num; i++)
+    {
+        E = L->entries + i;
+
+        E->q = fmpz_get_ui(fac->p + i);
+        E->e = fac->exp[i];
+
+        fmpz_init(E->cofactor);
+        fmpz_init(E->idem);
+        fmpz_init(E->gamma);
+        fmpz_init(E->alphainv);
+        fmpz_init(E->giant);
+
+        fmpz_pow_ui(t, fac->p + i, E->e);
+        fmpz_divexact(E->cofactor, L->pm1, t);
+        fmpz_invmod(u, E->cofactor, t);
+        fmpz_mul(E->idem, E->cofactor, u);
+
+        fmpz_divexact_ui(u, L->pm1, E->q);
+        fmpz_powm(E->gamma, L->g, u, L->p);
+        fmpz_powm(E->alphainv, ginv, E->cofactor, L->p);
+
+        if (FLINT_BIT_COUNT(E->q) <= FLINT_DISCRETE_LOG_BSGS_BITS)
+        {
+            E->m = n_sqrt(E->q);
+            if (E->m * E->m < E->q)
+                E->m++;
+
+            E->table = (n_pair_t *) flint_malloc(E->m * sizeof(n_pair_t));
+
+            fmpz_one(c);
+            for (j = 0; j < E->m; j++)
+            {
+                E->table[j].x = fmpz_get_ui(c);
+                E->table[j].y = j;
+                _fmpz_mulmod_preinvn(c, c, E->gamma, L->p, L->pinv, t);
+            }
+
+            qsort(E->table, E->m, sizeof(n_pair_t), _n_pair_cmp);
+
+            fmpz_invmod(u, E->gamma, L->p);
+            fmpz_powm_ui(E->giant, u, E->m, L->p);
+        }
+        else
+        {
+            E->m = 0;
+            E->table = NULL;
+        }
+    }
+
+    fmpz_factor_clear(fac);
+    fmpz_clear(t);
+    fmpz_clear(u);
+    fmpz_clear(c);
+    fmpz_clear(ginv);
+
+    return 1;
+}
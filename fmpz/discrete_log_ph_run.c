@@ -0,0 +1,231 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+
+static void
+_fmpz_discrete_log_rho_step(fmpz_t x, mp_limb_t * a, mp_limb_t * b,
+               const fmpz_t h, const fmpz_discrete_log_ph_entry_struct * E,
+               const fmpz_discrete_log_ph_t L, fmpz_t t)
+{
+    switch (fmpz_get_ui(x) % 3)
+    {
+        case 0:
+            _fmpz_mulmod_preinvn(x, x, x, L->p, L->pinv, t);
+            *a = n_addmod(*a, *a, E->q);
+            *b = n_addmod(*b, *b, E->q);
+            break;
+        case 1:
+            _fmpz_mulmod_preinvn(x, x, E->gamma, L->p, L->pinv, t);
+            *a = n_addmod(*a, 1, E->q);
+            break;
+        default:
+            _fmpz_mulmod_preinvn(x, x, h, L->p, L->pinv, t);
+            *b = n_addmod(*b, 1, E->q);
+    }
+}
+
+/* Pollard rho, as for n_discrete_log_ph_run */
+static mp_limb_t
+_fmpz_discrete_log_rho(const fmpz_t h,
+                       const fmpz_discrete_log_ph_entry_struct * E,
+                       const fmpz_discrete_log_ph_t L)
+{
+    mp_limb_t a, b, A, B, start, r;
+    fmpz_t x, X, t;
+
+    if (fmpz_is_one(h))
+        return 0;
+
+    fmpz_init(x);
+    fmpz_init(X);
+    fmpz_init(t);
+
+    for (start = 1; ; start++)
+    {
+        a = A = start;
+        b = B = 0;
+        fmpz_powm_ui(x, E->gamma, start, L->p);
+        fmpz_set(X, x);
+
+        do
+        {
+            _fmpz_discrete_log_rho_step(x, &a, &b, h, E, L, t);
+            _fmpz_discrete_log_rho_step(X, &A, &B, h, E, L, t);
+            _fmpz_discrete_log_rho_step(X, &A, &B, h, E, L, t);
+        } while (!fmpz_equal(x, X));
+
+        if (b != B)
+            break;
+    }
+
+    r = n_mulmod2_preinv(n_submod(A, a, E->q),
+                   n_invmod(n_submod(b, B, E->q), E->q), E->q,
+                   n_preinvert_limb(E->q));
+
+    fmpz_clear(x);
+    fmpz_clear(X);
+    fmpz_clear(t);
+
+    return r;
+}
+
+/*
+    Log of h, an element of the subgroup of order q, with respect to
+    gamma. The table only holds the least significant limbs, so matches
+    are confirmed by recomputing the baby step.
+*/
+static mp_limb_t
+_fmpz_discrete_log_ph_subgroup(const fmpz_t h,
+                               const fmpz_discrete_log_ph_entry_struct * E,
+                               const fmpz_discrete_log_ph_t L)
+{
+    mp_limb_t i, k, lo, hi, mid, c;
+    fmpz_t y, t;
+
+    if (E->m == 0)
+        return _fmpz_discrete_log_rho(h, E, L);
+
+    fmpz_init_set(y, h);
+    fmpz_init(t);
+
+    for (i = 0; i < E->m; i++)
+    {
+        c = fmpz_get_ui(y);
+
+        lo = 0;
+        hi = E->m;
+
+        while (lo < hi)
+        {
+            mid = lo + (hi - lo) / 2;
+
+            if (E->table[mid].x < c)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        for (k = lo; k < E->m && E->table[k].x == c; k++)
+        {
+            fmpz_powm_ui(t, E->gamma, E->table[k].y, L->p);
+
+            if (fmpz_equal(t, y))
+            {
+                c = i * E->m + E->table[k].y;
+                fmpz_clear(y);
+                fmpz_clear(t);
+                return c;
+            }
+        }
+
+        _fmpz_mulmod_preinvn(y, y, E->giant, L->p, L->pinv, t);
+    }
+
+    flint_printf("Exception (fmpz_discrete_log_ph_run).  "
+                 "discrete log not found.\n");
+    abort();
+}
+
+void fmpz_discrete_log_ph_run(fmpz_t x, const fmpz_discrete_log_ph_t L,
+                                                            const fmpz_t b)
+{
+    const fmpz_discrete_log_ph_entry_struct * E;
+    fmpz_t r, beta, ainv, h, t, s, xq, qk;
+    mp_limb_t d;
+    slong i;
+    ulong k;
+
+    fmpz_init(r);
+    fmpz_init(beta);
+    fmpz_init(ainv);
+    fmpz_init(h);
+    fmpz_init(t);
+    fmpz_init(s);
+    fmpz_init(xq);
+    fmpz_init(qk);
+
+    fmpz_mod(s, b, L->p);
+
+    if (fmpz_is_zero(s))
+    {
+        flint_printf("Exception (fmpz_discrete_log_ph_run).  "
+                     "b is zero mod p.\n");
+        abort();
+    }
+
+    for (i = 0; i < L->num; i++)
+    {
+        E = L->entries + i;
+
+        /* x mod q^e, one base q digit at a time */
+        fmpz_powm(beta, s, E->cofactor, L->p);
+        fmpz_set(ainv, E->alphainv);
+        fmpz_zero(xq);
+        fmpz_one(qk);
+
+        for (k = 0; k < E->e; k++)
+        {
+            fmpz_set_ui(t, E->q);
+            fmpz_pow_ui(t, t, E->e - 1 - k);
+            fmpz_powm(h, beta, t, L->p);
+
+            d = _fmpz_discrete_log_ph_subgroup(h, E, L);
+
+            if (d != 0)
+            {
+                fmpz_powm_ui(h, ainv, d, L->p);
+                _fmpz_mulmod_preinvn(beta, beta, h, L->p, L->pinv, t);
+                fmpz_addmul_ui(xq, qk, d);
+            }
+
+            fmpz_mul_ui(qk, qk, E->q);
+
+            if (k + 1 < E->e)
+                fmpz_powm_ui(ainv, ainv, E->q, L->p);
+        }
+
+        fmpz_addmul(r, xq, E->idem);
+    }
+
+    if (L->num == 0)
+        fmpz_zero(x);
+    else
+        fmpz_mod(x, r, L->pm1);
+
+    fmpz_clear(r);
+    fmpz_clear(beta);
+    fmpz_clear(ainv);
+    fmpz_clear(h);
+    fmpz_clear(t);
+    fmpz_clear(s);
+    fmpz_clear(xq);
+    fmpz_clear(qk);
+}
@@ -35,6 +35,7 @@ fmpz_init2(fmpz_t f, ulong limbs)
     {
         __mpz_struct *mpz_ptr = _fmpz_new_mpz();
         *f = PTR_TO_COEFF(mpz_ptr);
+        mpz_ptr->_mp_size = 0;  /* cached mpz's may hold an old value */
         _mpz_realloc(mpz_ptr, limbs);
     }
     else
@@ -0,0 +1,141 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "thread_pool.h"
+
+#define PROBABPRIME_VEC_BLOCK 256
+
+/*
+    Single limb values, whether small fmpz's or one limb mpz's, are
+    collected and handed to _n_is_prime_vec. Larger values are first reduced
+    modulo a product of small odd primes fitting in a limb, so that most
+    composites cost one mpn_mod_1 and a gcd, and the remaining ones are
+    passed to GMP as in fmpz_is_probabprime.
+*/
+static void
+_fmpz_is_probabprime_vec(int * res, const fmpz * v, slong len)
+{
+    mp_limb_t small[PROBABPRIME_VEC_BLOCK], prod, p;
+    slong idx[PROBABPRIME_VEC_BLOCK];
+    int small_res[PROBABPRIME_VEC_BLOCK];
+    slong i, j, k, num;
+    __mpz_struct * z;
+
+    prod = 1;
+    for (k = 1; ; k++)
+    {
+        p = flint_primes_small[k];
+        if (prod > UWORD_MAX / p)
+            break;
+        prod *= p;
+    }
+
+    for (i = 0; i < len; i += PROBABPRIME_VEC_BLOCK)
+    {
+        num = 0;
+
+        for (j = i; j < FLINT_MIN(len, i + PROBABPRIME_VEC_BLOCK); j++)
+        {
+            if (fmpz_sgn(v + j) <= 0)
+            {
+                res[j] = 0;
+            }
+            else if (!COEFF_IS_MPZ(v[j]))
+            {
+                small[num] = v[j];
+                idx[num++] = j;
+            }
+            else if ((z = COEFF_TO_PTR(v[j]))->_mp_size == 1)
+            {
+                small[num] = z->_mp_d[0];
+                idx[num++] = j;
+            }
+            else
+            {
+                if ((z->_mp_d[0] & UWORD(1)) == 0 ||
+                    n_gcd(prod, mpn_mod_1(z->_mp_d, z->_mp_size, prod)) != 1)
+                    res[j] = 0;
+                else
+                    res[j] = (mpz_probab_prime_p(z, 25) != 0);
+            }
+        }
+
+        _n_is_prime_vec(small_res, small, num);
+
+        for (j = 0; j < num; j++)
+            res[idx[j]] = small_res[j];
+    }
+}
+
+typedef struct
+{
+    int * res;
+    const fmpz * v;
+    slong len;
+} _probabprime_vec_arg_t;
+
+static void *
+_fmpz_is_probabprime_vec_worker(void * arg_ptr)
+{
+    _probabprime_vec_arg_t arg = *((_probabprime_vec_arg_t *) arg_ptr);
+
+    _fmpz_is_probabprime_vec(arg.res, arg.v, arg.len);
+
+    return NULL;
+}
+
+void
+fmpz_is_probabprime_vec(int * res, const fmpz * v, slong len)
+{
+    _probabprime_vec_arg_t * args;
+    slong i, num_tasks;
+
+    /* even short batches of multi-limb values are worth splitting */
+    num_tasks = FLINT_MIN(flint_get_num_threads(), len);
+
+    if (num_tasks <= 1)
+    {
+        _fmpz_is_probabprime_vec(res, v, len);
+        return;
+    }
+
+    args = flint_malloc(num_tasks * sizeof(_probabprime_vec_arg_t));
+
+    for (i = 0; i < num_tasks; i++)
+    {
+        args[i].res = res + (i * len) / num_tasks;
+        args[i].v = v + (i * len) / num_tasks;
+        args[i].len = ((i + 1) * len) / num_tasks - (i * len) / num_tasks;
+    }
+
+    flint_parallel_do(_fmpz_is_probabprime_vec_worker, args,
+                      sizeof(_probabprime_vec_arg_t), num_tasks);
+
+    flint_free(args);
+}
@@ -49,6 +49,8 @@ ulong mpz_alloc = 0;
 ulong mpz_free_num = 0;
 ulong mpz_free_alloc = 0;
 
+fmpz_mpz_cache_stats_struct mpz_stats;
+
 #if FLINT_REENTRANT
 void fmpz_lock_init()
 {
@@ -66,10 +68,14 @@ __mpz_struct * _fmpz_new_mpz(void)
 #endif
 
     if (mpz_free_num != 0)
+    {
         z = mpz_free_arr[--mpz_free_num];
+        mpz_stats.hits++;
+    }
     else
     {
         z = flint_malloc(sizeof(__mpz_struct));
+        mpz_stats.misses++;
 
         if (mpz_num == mpz_alloc) /* store pointer to prevent gc cleanup */
         {
@@ -141,6 +147,37 @@ void _fmpz_cleanup(void)
 #endif
 }
 
+void _fmpz_mpz_cache_get_stats(fmpz_mpz_cache_stats_t stats)
+{
+#if FLINT_REENTRANT
+    pthread_once(&fmpz_initialised, fmpz_lock_init);
+    pthread_mutex_lock(&fmpz_lock);
+#endif
+
+    *stats = mpz_stats;
+
+#if FLINT_REENTRANT
+    pthread_mutex_unlock(&fmpz_lock);
+#endif
+}
+
+void _fmpz_mpz_cache_reset_stats(void)
+{
+#if FLINT_REENTRANT
+    pthread_once(&fmpz_initialised, fmpz_lock_init);
+    pthread_mutex_lock(&fmpz_lock);
+#endif
+
+    mpz_stats.hits = 0;
+    mpz_stats.misses = 0;
+    mpz_stats.batches_in = 0;
+    mpz_stats.batches_out = 0;
+
+#if FLINT_REENTRANT
+    pthread_mutex_unlock(&fmpz_lock);
+#endif
+}
+
 __mpz_struct * _fmpz_promote(fmpz_t f)
 {
     if (!COEFF_IS_MPZ(*f)) /* f is small so promote it first */
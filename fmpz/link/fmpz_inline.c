@@ -0,0 +1,426 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "fmpz.h"
+
+/*
+   Large fmpz's in a single block. Each block holds an __mpz_struct followed
+   by FMPZ_INLINE_LIMBS limbs, and a free block has _mp_d pointing at its own
+   limbs, so that values of up to FMPZ_INLINE_LIMBS limbs are read from one
+   place in memory. Blocks are carved from large chunks and never freed one
+   at a time.
+
+   GMP reallocates and frees _mp_d itself, so the GMP memory functions are
+   replaced by wrappers, once for the process when the first large fmpz is
+   created: a pointer into a chunk is never freed, and growing it copies
+   the limbs into memory from the previous allocator. When a block
+   is released its limbs are returned to the previous allocator if they had
+   moved, and _mp_d is pointed back at the block.
+
+   As in the reentrant version, each thread keeps a cache of free blocks and
+   exchanges batches of them with a shared pool.
+*/
+
+typedef struct
+{
+    __mpz_struct z;
+    mp_limb_t d[FMPZ_INLINE_LIMBS];
+} fmpz_block_struct;
+
+/* The number of blocks moved to or from the shared pool at a time */
+#define MPZ_BATCH 64
+
+/* The maximum number of blocks cached by a single thread */
+#define MPZ_LOCAL_MAX (4*MPZ_BATCH)
+
+/* Chunk k holds MPZ_BATCH << k blocks, so a few dozen chunks suffice */
+#define FMPZ_MAX_CHUNKS (FLINT_BITS - 8)
+
+#if defined(__GNUC__)
+#define _LOAD_ACQUIRE(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define _STORE_RELEASE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#else
+#define _LOAD_ACQUIRE(x) (x)
+#define _STORE_RELEASE(x, v) ((x) = (v))
+#endif
+
+typedef struct mpz_batch_s
+{
+    fmpz_block_struct * arr[MPZ_BATCH];
+    slong num;
+    struct mpz_batch_s * next;
+} mpz_batch_struct;
+
+static pthread_mutex_t mpz_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static mpz_batch_struct * mpz_pool = NULL;
+static slong mpz_pool_blocks = 0;
+
+/*
+   The chunks, which are only ever appended while blocks are in use. The
+   GMP wrappers read them without the lock, so a chunk is written before
+   the count which makes it visible. They are released once every block is
+   back in the pool, which like flint_cleanup should only happen when no
+   other thread is using GMP.
+*/
+static char * chunk_start[FMPZ_MAX_CHUNKS];
+static char * chunk_end[FMPZ_MAX_CHUNKS];
+static slong chunk_num = 0;
+static slong chunk_used = 0;    /* blocks carved from the last chunk */
+static slong chunk_blocks = 0;  /* blocks carved from all chunks */
+
+static void * (*gmp_alloc_func)(size_t);
+static void * (*gmp_realloc_func)(void *, size_t, size_t);
+static void (*gmp_free_func)(void *, size_t);
+static pthread_once_t gmp_funcs_once = PTHREAD_ONCE_INIT;
+
+FLINT_TLS_PREFIX fmpz_block_struct * mpz_free_arr[MPZ_LOCAL_MAX];
+FLINT_TLS_PREFIX ulong mpz_free_num = 0;
+
+/* blocks carved for this thread which have never been used */
+FLINT_TLS_PREFIX fmpz_block_struct * mpz_fresh = NULL;
+FLINT_TLS_PREFIX ulong mpz_fresh_num = 0;
+
+FLINT_TLS_PREFIX fmpz_mpz_cache_stats_struct mpz_stats;
+
+static int _fmpz_in_chunk(const void * p)
+{
+    slong i, num = _LOAD_ACQUIRE(chunk_num);
+
+    /* the last chunks are the largest */
+    for (i = num - 1; i >= 0; i--)
+        if ((const char *) p >= chunk_start[i]
+                && (const char *) p < chunk_end[i])
+            return 1;
+
+    return 0;
+}
+
+static void * _fmpz_gmp_realloc(void * p, size_t old_size, size_t new_size)
+{
+    void * q;
+
+    if (!_fmpz_in_chunk(p))
+        return gmp_realloc_func(p, old_size, new_size);
+
+    if (new_size <= FMPZ_INLINE_LIMBS * sizeof(mp_limb_t))
+        return p;
+
+    q = gmp_alloc_func(new_size);
+    memcpy(q, p, FLINT_MIN(old_size, new_size));
+
+    return q;
+}
+
+static void _fmpz_gmp_free(void * p, size_t size)
+{
+    if (!_fmpz_in_chunk(p))
+        gmp_free_func(p, size);
+}
+
+/*
+   wraps the GMP memory functions for the whole process; run once, before
+   the first block is carved, so that GMP never sees inline limbs without
+   the wrappers in place
+*/
+static void _fmpz_set_gmp_funcs(void)
+{
+    mp_get_memory_functions(&gmp_alloc_func, &gmp_realloc_func,
+                                                        &gmp_free_func);
+    mp_set_memory_functions(gmp_alloc_func, _fmpz_gmp_realloc,
+                                                        _fmpz_gmp_free);
+}
+
+/* carves a batch of blocks for this thread; the pool lock must be held */
+static void _fmpz_carve_batch(void)
+{
+    slong size;
+
+    size = (chunk_num == 0) ? 0 : (chunk_end[chunk_num - 1]
+        - chunk_start[chunk_num - 1]) / sizeof(fmpz_block_struct);
+
+    if (chunk_used == size)
+    {
+        if (chunk_num == FMPZ_MAX_CHUNKS)
+        {
+            flint_printf("Exception (fmpz). Too many large integers.\n");
+            abort();
+        }
+
+        size = ((slong) MPZ_BATCH) << chunk_num;
+        chunk_start[chunk_num] =
+            flint_malloc(size * sizeof(fmpz_block_struct));
+        chunk_end[chunk_num] = chunk_start[chunk_num]
+                             + size * sizeof(fmpz_block_struct);
+        _STORE_RELEASE(chunk_num, chunk_num + 1);
+        chunk_used = 0;
+    }
+
+    mpz_fresh = (fmpz_block_struct *) chunk_start[chunk_num - 1] + chunk_used;
+    mpz_fresh_num = MPZ_BATCH;
+    chunk_used += MPZ_BATCH;
+    chunk_blocks += MPZ_BATCH;
+}
+
+/*
+   takes a batch of used blocks from the shared pool into the local cache,
+   returning 0 if there is none; fresh blocks are then carved if this
+   thread has run out of them
+*/
+static int _fmpz_mpz_pool_take(void)
+{
+    mpz_batch_struct * batch;
+
+    pthread_once(&gmp_funcs_once, _fmpz_set_gmp_funcs);
+
+    pthread_mutex_lock(&mpz_pool_lock);
+    batch = mpz_pool;
+    if (batch != NULL)
+    {
+        mpz_pool = batch->next;
+        mpz_pool_blocks -= batch->num;
+    }
+    else if (mpz_fresh_num == 0)
+        _fmpz_carve_batch();
+    pthread_mutex_unlock(&mpz_pool_lock);
+
+    if (batch == NULL)
+        return 0;
+
+    memcpy(mpz_free_arr + mpz_free_num, batch->arr,
+                                batch->num * sizeof(fmpz_block_struct *));
+    mpz_free_num += batch->num;
+    mpz_stats.batches_in++;
+
+    flint_free(batch);
+
+    return 1;
+}
+
+/* hands the top num cached blocks to the shared pool */
+static void _fmpz_mpz_pool_give(ulong num)
+{
+    mpz_batch_struct * batch = flint_malloc(sizeof(mpz_batch_struct));
+
+    mpz_free_num -= num;
+    memcpy(batch->arr, mpz_free_arr + mpz_free_num,
+                                        num * sizeof(fmpz_block_struct *));
+    batch->num = num;
+    mpz_stats.batches_out++;
+
+    pthread_mutex_lock(&mpz_pool_lock);
+    batch->next = mpz_pool;
+    mpz_pool = batch;
+    mpz_pool_blocks += num;
+    pthread_mutex_unlock(&mpz_pool_lock);
+}
+
+__mpz_struct * _fmpz_new_mpz(void)
+{
+    fmpz_block_struct * b;
+
+    if (mpz_free_num != 0 || _fmpz_mpz_pool_take())
+    {
+        mpz_stats.hits++;
+        return &mpz_free_arr[--mpz_free_num]->z;
+    }
+
+    mpz_stats.misses++;
+    b = mpz_fresh++;
+    mpz_fresh_num--;
+
+    b->z._mp_alloc = FMPZ_INLINE_LIMBS;
+    b->z._mp_size = 0;
+    b->z._mp_d = b->d;
+
+    return &b->z;
+}
+
+void _fmpz_clear_mpz(fmpz f)
+{
+    fmpz_block_struct * b = (fmpz_block_struct *) COEFF_TO_PTR(f);
+
+    /* the limbs were moved out by GMP, so give them back */
+    if (b->z._mp_d != b->d)
+    {
+        if (b->z._mp_alloc != 0)
+            _fmpz_gmp_free(b->z._mp_d, b->z._mp_alloc * sizeof(mp_limb_t));
+
+        b->z._mp_d = b->d;
+    }
+
+    b->z._mp_alloc = FMPZ_INLINE_LIMBS;
+    b->z._mp_size = 0;
+
+    if (mpz_free_num == MPZ_LOCAL_MAX)
+        _fmpz_mpz_pool_give(MPZ_BATCH);
+
+    mpz_free_arr[mpz_free_num++] = b;
+}
+
+/*
+   Returns this thread's blocks to the shared pool. If every block carved
+   is then free, the chunks are released.
+*/
+void _fmpz_cleanup_mpz_content(void)
+{
+    mpz_batch_struct * batch;
+
+    while (mpz_fresh_num != 0)
+    {
+        fmpz_block_struct * b = mpz_fresh++;
+        mpz_fresh_num--;
+
+        b->z._mp_alloc = FMPZ_INLINE_LIMBS;
+        b->z._mp_d = b->d;
+
+        if (mpz_free_num == MPZ_LOCAL_MAX)
+            _fmpz_mpz_pool_give(MPZ_BATCH);
+
+        mpz_free_arr[mpz_free_num++] = b;
+    }
+
+    while (mpz_free_num != 0)
+        _fmpz_mpz_pool_give(FLINT_MIN(mpz_free_num, MPZ_BATCH));
+
+    pthread_mutex_lock(&mpz_pool_lock);
+
+    if (mpz_pool_blocks == chunk_blocks)
+    {
+        while (mpz_pool != NULL)
+        {
+            batch = mpz_pool->next;
+            mpz_pool_blocks -= mpz_pool->num;
+            flint_free(mpz_pool);
+            mpz_pool = batch;
+        }
+
+        while (chunk_num != 0)
+        {
+            _STORE_RELEASE(chunk_num, chunk_num - 1);
+            flint_free(chunk_start[chunk_num]);
+        }
+
+        chunk_used = chunk_blocks = 0;
+    }
+
+    pthread_mutex_unlock(&mpz_pool_lock);
+}
+
+void _fmpz_cleanup(void)
+{
+    _fmpz_cleanup_mpz_content();
+}
+
+void _fmpz_mpz_cache_get_stats(fmpz_mpz_cache_stats_t stats)
+{
+    *stats = mpz_stats;
+}
+
+void _fmpz_mpz_cache_reset_stats(void)
+{
+    mpz_stats.hits = 0;
+    mpz_stats.misses = 0;
+    mpz_stats.batches_in = 0;
+    mpz_stats.batches_out = 0;
+}
+
+__mpz_struct * _fmpz_promote(fmpz_t f)
+{
+    if (!COEFF_IS_MPZ(*f))  /* f is small so promote it first */
+    {
+        __mpz_struct * mpz_ptr = _fmpz_new_mpz();
+        *f = PTR_TO_COEFF(mpz_ptr);
+        return mpz_ptr;
+    }
+    else  /* f is large already, just return the pointer */
+        return COEFF_TO_PTR(*f);
+}
+
+__mpz_struct * _fmpz_promote_val(fmpz_t f)
+{
+    fmpz c = *f;
+    if (!COEFF_IS_MPZ(c))  /* f is small so promote it */
+    {
+        __mpz_struct * mpz_ptr = _fmpz_new_mpz();
+        *f = PTR_TO_COEFF(mpz_ptr);
+        flint_mpz_set_si(mpz_ptr, c);
+        return mpz_ptr;
+    }
+    else  /* f is large already, just return the pointer */
+        return COEFF_TO_PTR(*f);
+}
+
+void _fmpz_demote_val(fmpz_t f)
+{
+    __mpz_struct * mpz_ptr = COEFF_TO_PTR(*f);
+    int size = mpz_ptr->_mp_size;
+
+    if (!(((unsigned int) size + 1U) & ~2U))  /* size +-1 */
+    {
+        ulong uval = mpz_ptr->_mp_d[0];
+
+        if (uval <= (ulong) COEFF_MAX)
+        {
+            _fmpz_clear_mpz(*f);
+            *f = size * (fmpz) uval;
+        }
+    }
+    else if (size == 0)  /* value is 0 */
+    {
+        _fmpz_clear_mpz(*f);
+        *f = 0;
+    }
+
+    /* don't do anything if value has to be multi precision */
+}
+
+void _fmpz_init_readonly_mpz(fmpz_t f, const mpz_t z)
+{
+    __mpz_struct * ptr;
+    *f = WORD(0);
+    ptr = _fmpz_promote(f);
+
+    mpz_clear(ptr);
+    *ptr = *z;
+}
+
+void _fmpz_clear_readonly_mpz(mpz_t z)
+{
+    if (((z->_mp_size == 1 || z->_mp_size == -1) && (z->_mp_d[0] <= COEFF_MAX))
+        || (z->_mp_size == 0))
+    {
+        mpz_clear(z);
+    }
+}
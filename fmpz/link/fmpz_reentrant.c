@@ -23,11 +23,174 @@
 
 ******************************************************************************/
 
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
 #include <stdlib.h>
+#include <string.h>
+#undef ulong
 #include <gmp.h>
+#define ulong mp_limb_t
+
 #include "flint.h"
 #include "fmpz.h"
 
+#if HAVE_TLS
+
+/*
+   Each thread keeps its own cache of mpz's, so that promoting and demoting
+   does not need a lock. When a thread's cache overflows (e.g. when mpz's
+   allocated by one thread are released by another), a batch of mpz's is
+   handed to a shared pool, from which threads with an empty cache refill.
+   The shared pool is only locked once per batch.
+*/
+
+#include <pthread.h>
+
+/* Always free larger mpz's to avoid wasting too much heap space */
+#define FLINT_MPZ_MAX_CACHE_LIMBS 64
+
+/* The number of mpz's moved to or from the shared pool at a time */
+#define MPZ_BATCH 64
+
+/* The maximum number of mpz's cached by a single thread */
+#define MPZ_LOCAL_MAX (4*MPZ_BATCH)
+
+typedef struct mpz_batch_s
+{
+    __mpz_struct * arr[MPZ_BATCH];
+    struct mpz_batch_s * next;
+} mpz_batch_struct;
+
+static pthread_mutex_t mpz_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static mpz_batch_struct * mpz_pool = NULL;
+
+FLINT_TLS_PREFIX __mpz_struct * mpz_free_arr[MPZ_LOCAL_MAX];
+FLINT_TLS_PREFIX ulong mpz_free_num = 0;
+
+FLINT_TLS_PREFIX fmpz_mpz_cache_stats_struct mpz_stats;
+
+static int _fmpz_mpz_pool_take(void)
+{
+    mpz_batch_struct * batch;
+
+    pthread_mutex_lock(&mpz_pool_lock);
+    batch = mpz_pool;
+    if (batch != NULL)
+        mpz_pool = batch->next;
+    pthread_mutex_unlock(&mpz_pool_lock);
+
+    if (batch == NULL)
+        return 0;
+
+    memcpy(mpz_free_arr + mpz_free_num, batch->arr,
+                                        MPZ_BATCH * sizeof(__mpz_struct *));
+    mpz_free_num += MPZ_BATCH;
+    mpz_stats.batches_in++;
+
+    flint_free(batch);
+
+    return 1;
+}
+
+static void _fmpz_mpz_pool_give(void)
+{
+    mpz_batch_struct * batch = flint_malloc(sizeof(mpz_batch_struct));
+
+    mpz_free_num -= MPZ_BATCH;
+    memcpy(batch->arr, mpz_free_arr + mpz_free_num,
+                                        MPZ_BATCH * sizeof(__mpz_struct *));
+    mpz_stats.batches_out++;
+
+    pthread_mutex_lock(&mpz_pool_lock);
+    batch->next = mpz_pool;
+    mpz_pool = batch;
+    pthread_mutex_unlock(&mpz_pool_lock);
+}
+
+__mpz_struct * _fmpz_new_mpz(void)
+{
+    __mpz_struct * z;
+
+    if (mpz_free_num != 0 || _fmpz_mpz_pool_take())
+    {
+        mpz_stats.hits++;
+        return mpz_free_arr[--mpz_free_num];
+    }
+
+    mpz_stats.misses++;
+    z = flint_malloc(sizeof(__mpz_struct));
+    mpz_init(z);
+    return z;
+}
+
+void _fmpz_clear_mpz(fmpz f)
+{
+    __mpz_struct * ptr = COEFF_TO_PTR(f);
+
+    if (ptr->_mp_alloc > FLINT_MPZ_MAX_CACHE_LIMBS)
+        mpz_realloc2(ptr, 1);
+
+    if (mpz_free_num == MPZ_LOCAL_MAX)
+        _fmpz_mpz_pool_give();
+
+    mpz_free_arr[mpz_free_num++] = ptr;
+}
+
+void _fmpz_cleanup_mpz_content(void)
+{
+    ulong i;
+
+    for (i = 0; i < mpz_free_num; i++)
+    {
+        mpz_clear(mpz_free_arr[i]);
+        flint_free(mpz_free_arr[i]);
+    }
+
+    mpz_free_num = 0;
+}
+
+void _fmpz_cleanup(void)
+{
+    mpz_batch_struct * batch;
+    ulong i;
+
+    _fmpz_cleanup_mpz_content();
+
+    pthread_mutex_lock(&mpz_pool_lock);
+    batch = mpz_pool;
+    mpz_pool = NULL;
+    pthread_mutex_unlock(&mpz_pool_lock);
+
+    while (batch != NULL)
+    {
+        mpz_batch_struct * next = batch->next;
+
+        for (i = 0; i < MPZ_BATCH; i++)
+        {
+            mpz_clear(batch->arr[i]);
+            flint_free(batch->arr[i]);
+        }
+
+        flint_free(batch);
+        batch = next;
+    }
+}
+
+void _fmpz_mpz_cache_get_stats(fmpz_mpz_cache_stats_t stats)
+{
+    *stats = mpz_stats;
+}
+
+void _fmpz_mpz_cache_reset_stats(void)
+{
+    mpz_stats.hits = 0;
+    mpz_stats.misses = 0;
+    mpz_stats.batches_in = 0;
+    mpz_stats.batches_out = 0;
+}
+
+#else
+
 __mpz_struct * _fmpz_new_mpz(void)
 {
     __mpz_struct * mpz_ptr = (__mpz_struct *) flint_malloc(sizeof(__mpz_struct));
@@ -49,6 +212,21 @@ void _fmpz_cleanup(void)
 {
 }
 
+/* nothing is cached, so no statistics are kept */
+void _fmpz_mpz_cache_get_stats(fmpz_mpz_cache_stats_t stats)
+{
+    stats->hits = 0;
+    stats->misses = 0;
+    stats->batches_in = 0;
+    stats->batches_out = 0;
+}
+
+void _fmpz_mpz_cache_reset_stats(void)
+{
+}
+
+#endif
+
 __mpz_struct * _fmpz_promote(fmpz_t f)
 {
     if (!COEFF_IS_MPZ(*f))  /* f is small so promote it first */
@@ -38,15 +38,19 @@ FLINT_TLS_PREFIX __mpz_struct ** mpz_free_arr = NULL;
 FLINT_TLS_PREFIX ulong mpz_free_num = 0;
 FLINT_TLS_PREFIX ulong mpz_free_alloc = 0;
 
+FLINT_TLS_PREFIX fmpz_mpz_cache_stats_struct mpz_stats;
+
 __mpz_struct * _fmpz_new_mpz(void)
 {
     if (mpz_free_num != 0)
     {
+        mpz_stats.hits++;
         return mpz_free_arr[--mpz_free_num];
     }
     else
     {
         __mpz_struct * z = flint_malloc(sizeof(__mpz_struct));
+        mpz_stats.misses++;
         mpz_init(z);
         return z;
     }
@@ -88,6 +92,19 @@ void _fmpz_cleanup(void)
     mpz_free_arr = NULL;
 }
 
+void _fmpz_mpz_cache_get_stats(fmpz_mpz_cache_stats_t stats)
+{
+    *stats = mpz_stats;
+}
+
+void _fmpz_mpz_cache_reset_stats(void)
+{
+    mpz_stats.hits = 0;
+    mpz_stats.misses = 0;
+    mpz_stats.batches_in = 0;
+    mpz_stats.batches_out = 0;
+}
+
 __mpz_struct * _fmpz_promote(fmpz_t f)
 {
     if (!COEFF_IS_MPZ(*f)) /* f is small so promote it first */
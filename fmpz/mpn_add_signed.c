@@ -0,0 +1,83 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+mp_size_t _fmpz_mpn_add_signed(mp_ptr r, mp_srcptr x, mp_size_t xs,
+                                             mp_srcptr y, mp_size_t ys)
+{
+    mp_size_t xn = FLINT_ABS(xs), yn = FLINT_ABS(ys), rn;
+    mp_limb_t cy;
+
+    if (xn < yn)
+    {
+        mp_srcptr t = x;
+        x = y;
+        y = t;
+        rn = xs, xs = ys, ys = rn;
+        rn = xn, xn = yn, yn = rn;
+    }
+
+    if (yn == 0)
+    {
+        if (r != x)
+            flint_mpn_copyi(r, x, xn);
+        return xs;
+    }
+
+    if ((xs ^ ys) >= 0)  /* same sign, add magnitudes */
+    {
+        cy = mpn_add(r, x, xn, y, yn);
+        r[xn] = cy;
+        rn = xn + (cy != 0);
+    }
+    else  /* opposite signs, subtract the smaller magnitude */
+    {
+        if (xn == yn)
+        {
+            int cmp = mpn_cmp(x, y, xn);
+
+            if (cmp == 0)
+                return 0;
+
+            if (cmp < 0)
+            {
+                mp_srcptr t = x;
+                x = y;
+                y = t;
+                xs = ys;
+            }
+        }
+
+        mpn_sub(r, x, xn, y, yn);
+        rn = xn;
+        while (r[rn - 1] == 0)
+            rn--;
+    }
+
+    return (xs < 0) ? -rn : rn;
+}
@@ -0,0 +1,56 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+mp_size_t _fmpz_mpn_mul_signed(mp_ptr r, mp_srcptr x, mp_size_t xs,
+                                             mp_srcptr y, mp_size_t ys)
+{
+    mp_size_t xn = FLINT_ABS(xs), yn = FLINT_ABS(ys), rn = xn + yn;
+
+    if (xn < yn)
+    {
+        mp_srcptr t = x;
+        x = y;
+        y = t;
+        xn = yn;
+        yn = rn - xn;
+    }
+
+    if (x == y && xn == yn)
+        mpn_sqr(r, x, xn);
+    else if (yn == 1)
+        r[xn] = mpn_mul_1(r, x, xn, y[0]);
+    else if (xn == yn)
+        mpn_mul_n(r, x, y, xn);
+    else
+        mpn_mul(r, x, xn, y, yn);
+
+    rn -= (r[rn - 1] == 0);
+
+    return ((xs ^ ys) < 0) ? -rn : rn;
+}
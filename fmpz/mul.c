@@ -55,5 +55,23 @@ fmpz_mul(fmpz_t f, const fmpz_t g, const fmpz_t h)
     if (!COEFF_IS_MPZ(c2))      /* g is large, h is small */
         flint_mpz_mul_si(mpz_ptr, COEFF_TO_PTR(c1), c2);
     else                        /* c1 and c2 are large */
-        mpz_mul(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
+    {
+        __mpz_struct * mpz1 = COEFF_TO_PTR(c1);
+        __mpz_struct * mpz2 = COEFF_TO_PTR(c2);
+        mp_size_t s1 = mpz1->_mp_size, s2 = mpz2->_mp_size;
+        mp_size_t n = FLINT_ABS(s1) + FLINT_ABS(s2);
+
+        if (mpz_ptr == mpz1 || mpz_ptr == mpz2) /* aliased, need a temporary */
+        {
+            mpz_mul(mpz_ptr, mpz1, mpz2);
+        }
+        else
+        {
+            if (mpz_ptr->_mp_alloc < n)
+                _mpz_realloc(mpz_ptr, n);
+
+            mpz_ptr->_mp_size = _fmpz_mpn_mul_signed(mpz_ptr->_mp_d,
+                                      mpz1->_mp_d, s1, mpz2->_mp_d, s2);
+        }
+    }
 }
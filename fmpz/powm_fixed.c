@@ -0,0 +1,122 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+/*
+    Brickell, Gordon, McCurley and Wilson: with e = sum_i e_i 2^(w i), we
+    have g^e = prod_{j >= 1} (prod_{e_i = j} powers[i])^j, and the outer
+    product is accumulated from the top digit j down, multiplying the
+    running inner product B into the result A once per j.
+*/
+void fmpz_powm_fixed(fmpz_t f, const fmpz_t e, const fmpz_powm_fixed_t P)
+{
+    slong i, j, k, num = P->num, w = P->w;
+    slong * digit, * start, * order;
+    fmpz_t A, B, t;
+    int A_one, B_one;
+
+    if (fmpz_sgn(e) < 0)
+    {
+        flint_printf("Exception (fmpz_powm_fixed). Negative exponent.\n");
+        abort();
+    }
+
+    if (fmpz_is_one(P->m))
+    {
+        fmpz_zero(f);
+        return;
+    }
+
+    if (fmpz_bits(e) > num * w)
+    {
+        fmpz_powm(f, P->powers + 0, e, P->m);
+        return;
+    }
+
+    digit = flint_malloc((2 * num + (WORD(1) << w) + 1) * sizeof(slong));
+    order = digit + num;
+    start = order + num;
+
+    for (j = 0; j <= (WORD(1) << w); j++)
+        start[j] = 0;
+
+    for (i = 0; i < num; i++)
+    {
+        digit[i] = 0;
+        for (k = w - 1; k >= 0; k--)
+            digit[i] = 2 * digit[i] + fmpz_tstbit(e, i * w + k);
+        start[digit[i] + 1]++;
+    }
+
+    /* sort the indices by digit */
+    for (j = 1; j <= (WORD(1) << w); j++)
+        start[j] += start[j - 1];
+    for (i = 0; i < num; i++)
+        order[start[digit[i]]++] = i;
+    /* now start[j] is the end of the indices with digit j */
+
+    fmpz_init(A);
+    fmpz_init(B);
+    fmpz_init(t);
+    A_one = B_one = 1;
+
+    for (j = (WORD(1) << w) - 1; j >= 1; j--)
+    {
+        for (k = start[j - 1]; k < start[j]; k++)
+        {
+            if (B_one)
+                fmpz_set(B, P->powers + order[k]);
+            else
+                _fmpz_mulmod_preinvn(B, B, P->powers + order[k],
+                                     P->m, P->minv, t);
+            B_one = 0;
+        }
+
+        if (!B_one)
+        {
+            if (A_one)
+                fmpz_set(A, B);
+            else
+                _fmpz_mulmod_preinvn(A, A, B, P->m, P->minv, t);
+            A_one = 0;
+        }
+    }
+
+    if (A_one)
+        fmpz_one(f);
+    else
+        fmpz_swap(f, A);
+
+    fmpz_clear(A);
+    fmpz_clear(B);
+    fmpz_clear(t);
+    flint_free(digit);
+}
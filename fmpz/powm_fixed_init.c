@@ -0,0 +1,80 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+void fmpz_powm_fixed_init(fmpz_powm_fixed_t P, const fmpz_t g,
+                                          const fmpz_t m, mp_bitcnt_t ebits)
+{
+    slong i, j, w, cost, best;
+    fmpz_t t;
+
+    if (fmpz_sgn(m) <= 0)
+    {
+        flint_printf("Exception (fmpz_powm_fixed_init). "
+                     "Modulus is less than 1.\n");
+        abort();
+    }
+
+    ebits = FLINT_MAX(ebits, 1);
+
+    /* an exponentiation costs about ceil(ebits / w) + 2^w products */
+    best = WORD_MAX;
+    P->w = 1;
+    for (w = 1; w <= 16; w++)
+    {
+        cost = (ebits + w - 1) / w + (WORD(1) << w);
+        if (cost < best)
+        {
+            best = cost;
+            P->w = w;
+        }
+    }
+
+    P->num = (ebits + P->w - 1) / P->w;
+
+    fmpz_init_set(P->m, m);
+    fmpz_preinvn_init(P->minv, P->m);
+
+    P->powers = _fmpz_vec_init(P->num);
+
+    fmpz_init(t);
+
+    fmpz_mod(P->powers + 0, g, m);
+    for (i = 1; i < P->num; i++)
+    {
+        fmpz_set(P->powers + i, P->powers + i - 1);
+        for (j = 0; j < P->w; j++)
+            _fmpz_mulmod_preinvn(P->powers + i, P->powers + i,
+                                 P->powers + i, P->m, P->minv, t);
+    }
+
+    fmpz_clear(t);
+}
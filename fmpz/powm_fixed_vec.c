@@ -0,0 +1,82 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    fmpz * f;
+    const fmpz * e;
+    slong len;
+    const fmpz_powm_fixed_struct * P;
+} _powm_fixed_arg_t;
+
+static void *
+_fmpz_powm_fixed_vec_worker(void * arg_ptr)
+{
+    _powm_fixed_arg_t arg = *((_powm_fixed_arg_t *) arg_ptr);
+    slong i;
+
+    for (i = 0; i < arg.len; i++)
+        fmpz_powm_fixed(arg.f + i, arg.e + i, arg.P);
+
+    return NULL;
+}
+
+void fmpz_powm_fixed_vec(fmpz * f, const fmpz * e, slong len,
+                                               const fmpz_powm_fixed_t P)
+{
+    _powm_fixed_arg_t * args;
+    slong i, num_tasks;
+
+    num_tasks = FLINT_MIN(flint_get_num_threads(), len);
+
+    if (num_tasks <= 1)
+    {
+        for (i = 0; i < len; i++)
+            fmpz_powm_fixed(f + i, e + i, P);
+        return;
+    }
+
+    args = flint_malloc(num_tasks * sizeof(_powm_fixed_arg_t));
+
+    for (i = 0; i < num_tasks; i++)
+    {
+        args[i].f = f + (i * len) / num_tasks;
+        args[i].e = e + (i * len) / num_tasks;
+        args[i].len = ((i + 1) * len) / num_tasks - (i * len) / num_tasks;
+        args[i].P = P;
+    }
+
+    flint_parallel_do(_fmpz_powm_fixed_vec_worker, args,
+                      sizeof(_powm_fixed_arg_t), num_tasks);
+
+    flint_free(args);
+}
@@ -0,0 +1,167 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+/*
+    Straus' method: the squarings are shared between all the bases, and
+    each base contributes one product per window of w bits, looked up in
+    a table of its first 2^w powers. Below FMPZ_POWM_MULTI_CUTOFF bits
+    the separate calls to mpz_powm, which reduce in Montgomery form, are
+    faster than reducing with a precomputed inverse.
+*/
+
+#define FMPZ_POWM_MULTI_CUTOFF 1024
+void fmpz_powm_multi(fmpz_t f, const fmpz * g, const fmpz * e, slong n,
+                                                            const fmpz_t m)
+{
+    slong i, j, k, w, num, cost, best;
+    mp_bitcnt_t bits;
+    fmpz * T;
+    fmpz_preinvn_t minv;
+    fmpz_t r, t;
+    ulong d;
+    int r_one;
+
+    if (fmpz_sgn(m) <= 0)
+    {
+        flint_printf("Exception (fmpz_powm_multi). Modulus is less than 1.\n");
+        abort();
+    }
+
+    bits = 0;
+    for (i = 0; i < n; i++)
+    {
+        if (fmpz_sgn(e + i) < 0)
+        {
+            flint_printf("Exception (fmpz_powm_multi). Negative exponent.\n");
+            abort();
+        }
+        bits = FLINT_MAX(bits, fmpz_bits(e + i));
+    }
+
+    if (fmpz_is_one(m))
+    {
+        fmpz_zero(f);
+        return;
+    }
+
+    if (bits == 0)
+    {
+        fmpz_one(f);
+        return;
+    }
+
+    if (fmpz_bits(m) < FMPZ_POWM_MULTI_CUTOFF)
+    {
+        fmpz_init(r);
+        fmpz_init(t);
+
+        fmpz_one(r);
+        for (i = 0; i < n; i++)
+        {
+            fmpz_powm(t, g + i, e + i, m);
+            fmpz_mul(r, r, t);
+            fmpz_mod(r, r, m);
+        }
+
+        fmpz_swap(f, r);
+
+        fmpz_clear(r);
+        fmpz_clear(t);
+        return;
+    }
+
+    /* the products cost about n (2^w + bits / w) */
+    best = WORD_MAX;
+    w = 1;
+    for (k = 1; k <= 8; k++)
+    {
+        cost = (WORD(1) << k) + (bits + k - 1) / k;
+        if (cost < best)
+        {
+            best = cost;
+            w = k;
+        }
+    }
+
+    num = (bits + w - 1) / w;
+
+    fmpz_init(r);
+    fmpz_init(t);
+    fmpz_preinvn_init(minv, (fmpz *) m);
+
+    T = _fmpz_vec_init(n << w);
+
+    for (i = 0; i < n; i++)
+    {
+        fmpz * Ti = T + (i << w);
+
+        fmpz_one(Ti + 0);
+        fmpz_mod(Ti + 1, g + i, m);
+        for (j = 2; j < (WORD(1) << w); j++)
+            _fmpz_mulmod_preinvn(Ti + j, Ti + j - 1, Ti + 1, m, minv, t);
+    }
+
+    r_one = 1;
+
+    for (k = num - 1; k >= 0; k--)
+    {
+        if (!r_one)
+            for (j = 0; j < w; j++)
+                _fmpz_mulmod_preinvn(r, r, r, m, minv, t);
+
+        for (i = 0; i < n; i++)
+        {
+            d = 0;
+            for (j = w - 1; j >= 0; j--)
+                d = 2 * d + fmpz_tstbit(e + i, k * w + j);
+
+            if (d != 0)
+            {
+                if (r_one)
+                    fmpz_set(r, T + (i << w) + d);
+                else
+                    _fmpz_mulmod_preinvn(r, r, T + (i << w) + d, m, minv, t);
+                r_one = 0;
+            }
+        }
+    }
+
+    if (r_one)
+        fmpz_one(f);
+    else
+        fmpz_swap(f, r);
+
+    _fmpz_vec_clear(T, n << w);
+    fmpz_preinvn_clear(minv);
+    fmpz_clear(r);
+    fmpz_clear(t);
+}
@@ -148,7 +148,7 @@ fmpz_primorial(fmpz_t res, ulong n)
     mp_size_t len, pi;
     ulong bits;
     __mpz_struct * mpz_ptr;
-    const mp_limb_t * primes;
+    mp_limb_t * primes;
 
     if (n <= LARGEST_ULONG_PRIMORIAL)
     {
@@ -159,9 +159,7 @@ fmpz_primorial(fmpz_t res, ulong n)
         return;
     }
 
-    pi = n_prime_pi(n);
-
-    primes = n_primes_arr_readonly(pi);
+    pi = n_primes_range(&primes, 2, n + 1);
     bits = FLINT_BIT_COUNT(primes[pi - 1]);
     
     mpz_ptr = _fmpz_promote(res);
@@ -169,5 +167,7 @@ fmpz_primorial(fmpz_t res, ulong n)
     
     len = mpn_prod_limbs(mpz_ptr->_mp_d, primes, pi, bits);
     mpz_ptr->_mp_size = len;
+
+    flint_free(primes);
 }
 
@@ -0,0 +1,132 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+/*
+   Compares NUM calls to fmpz_powm with a fixed base and modulus against
+   fmpz_powm_fixed_vec (including the precomputation), and the product
+   of two calls to fmpz_powm against fmpz_powm_multi.
+*/
+
+#define NUM 20
+
+typedef struct
+{
+   mp_bitcnt_t bits;
+   int algo;
+} info_t;
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   mp_bitcnt_t bits = info->bits;
+   fmpz_powm_fixed_t P;
+   fmpz_t g, m, t;
+   fmpz * e, * f, * h;
+   ulong i;
+   slong j;
+   FLINT_TEST_INIT(state);
+
+   fmpz_init(g);
+   fmpz_init(m);
+   fmpz_init(t);
+   e = _fmpz_vec_init(NUM);
+   f = _fmpz_vec_init(NUM);
+   h = _fmpz_vec_init(2);
+
+   for (i = 0; i < count; i++)
+   {
+      fmpz_randbits(m, state, bits);
+      fmpz_abs(m, m);
+      fmpz_setbit(m, 0);
+      fmpz_randm(g, state, m);
+      fmpz_randm(h + 0, state, m);
+      fmpz_randm(h + 1, state, m);
+      for (j = 0; j < NUM; j++)
+         fmpz_randm(e + j, state, m);
+
+      prof_start();
+      if (info->algo == 0)
+      {
+         for (j = 0; j < NUM; j++)
+            fmpz_powm(f + j, g, e + j, m);
+      } else if (info->algo == 1)
+      {
+         fmpz_powm_fixed_init(P, g, m, bits);
+         fmpz_powm_fixed_vec(f, e, NUM, P);
+         fmpz_powm_fixed_clear(P);
+      } else if (info->algo == 2)
+      {
+         for (j = 0; j < NUM; j += 2)
+         {
+            fmpz_powm(f + j, h + 0, e + j, m);
+            fmpz_powm(t, h + 1, e + j + 1, m);
+            fmpz_mul(f + j, f + j, t);
+            fmpz_mod(f + j, f + j, m);
+         }
+      } else
+      {
+         for (j = 0; j < NUM; j += 2)
+            fmpz_powm_multi(f + j, h, e + j, 2, m);
+      }
+      prof_stop();
+   }
+
+   _fmpz_vec_clear(e, NUM);
+   _fmpz_vec_clear(f, NUM);
+   _fmpz_vec_clear(h, 2);
+   fmpz_clear(g);
+   fmpz_clear(m);
+   fmpz_clear(t);
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min[4], max;
+   info_t info;
+
+   flint_printf("times in ns per exponentiation: "
+                "powm, fixed, 2 x powm, multi (per pair)\n");
+
+   for (info.bits = 128; info.bits <= 4096; info.bits *= 2)
+   {
+      for (info.algo = 0; info.algo < 4; info.algo++)
+         prof_repeat(min + info.algo, &max, sample, (void *) &info);
+
+      flint_printf("bits %wu: %.1lf %.1lf %.1lf %.1lf\n", info.bits,
+         1000*min[0]/NUM, 1000*min[1]/NUM,
+         2000*min[2]/NUM, 2000*min[3]/NUM);
+   }
+
+   return 0;
+}
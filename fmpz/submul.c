@@ -52,8 +52,30 @@ fmpz_submul(fmpz_t f, const fmpz_t g, const fmpz_t h)
         else                    /* both g and h are large */
         {
             __mpz_struct *mpz_ptr = _fmpz_promote_val(f);
-            mpz_submul(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
-            _fmpz_demote_val(f);    /* cancellation may have occurred */
+            __mpz_struct *mpz1 = COEFF_TO_PTR(c1);
+            __mpz_struct *mpz2 = COEFF_TO_PTR(c2);
+            mp_size_t s, s1 = mpz1->_mp_size, s2 = mpz2->_mp_size, sp, n;
+            mp_ptr p;
+            TMP_INIT;
+
+            TMP_START;
+
+            p = TMP_ALLOC((FLINT_ABS(s1) + FLINT_ABS(s2)) * sizeof(mp_limb_t));
+            sp = -_fmpz_mpn_mul_signed(p, mpz1->_mp_d, s1, mpz2->_mp_d, s2);
+
+            s = mpz_ptr->_mp_size;
+            n = FLINT_MAX(FLINT_ABS(s), FLINT_ABS(sp)) + 1;
+
+            if (mpz_ptr->_mp_alloc < n)
+                _mpz_realloc(mpz_ptr, n);
+
+            mpz_ptr->_mp_size = _fmpz_mpn_add_signed(mpz_ptr->_mp_d,
+                                                     mpz_ptr->_mp_d, s, p, sp);
+
+            TMP_END;
+
+            if ((s ^ sp) < 0)
+                _fmpz_demote_val(f);    /* cancellation may have occurred */
         }
     }
 }
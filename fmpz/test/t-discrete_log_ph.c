@@ -0,0 +1,232 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+
+int main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("discrete_log_ph....");
+    fflush(stdout);
+
+    /* primes with smooth p - 1 */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_discrete_log_ph_t L;
+        fmpz_t p, a, b, x, y;
+        slong bits;
+
+        fmpz_init(p);
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(x);
+        fmpz_init(y);
+
+        bits = n_randint(state, 160) + 2;
+
+        do
+        {
+            fmpz_set_ui(p, 2);
+            while (fmpz_bits(p) < bits)
+                fmpz_mul_ui(p, p, n_randprime(state,
+                                              n_randint(state, 16) + 2, 0));
+            fmpz_add_ui(p, p, 1);
+        } while (!fmpz_is_probabprime(p));
+
+        result = fmpz_discrete_log_ph_init(L, p);
+
+        for (j = 0; j < 3 && result; j++)
+        {
+            fmpz_randm(b, state, p);
+            if (fmpz_is_zero(b))
+                fmpz_one(b);
+
+            fmpz_discrete_log_ph_run(x, L, b);
+            fmpz_powm(y, L->g, x, p);
+
+            result = fmpz_equal(y, b);
+        }
+
+        fmpz_discrete_log_ph_clear(L);
+
+        /* arbitrary base */
+        if (result)
+        {
+            fmpz_randm(a, state, p);
+            if (fmpz_is_zero(a))
+                fmpz_one(a);
+            fmpz_randtest_unsigned(x, state, 200);
+            fmpz_powm(b, a, x, p);
+
+            result = fmpz_discrete_log_ph(x, b, a, p);
+            fmpz_powm(y, a, x, p);
+            result = result && fmpz_equal(y, b);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("p = "), fmpz_print(p), flint_printf("\n");
+            flint_printf("b = "), fmpz_print(b), flint_printf("\n");
+            flint_printf("x = "), fmpz_print(x), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_clear(p);
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(x);
+        fmpz_clear(y);
+    }
+
+    /* agrees with the word sized version */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p, a, b, x;
+        mp_limb_t q, c, d, y;
+
+        fmpz_init(p);
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(x);
+
+        q = n_randprime(state, n_randint(state, 20) + 2, 1);
+        c = n_randint(state, q - 1) + 1;
+        d = n_randint(state, q - 1) + 1;
+        d = n_powmod2(c, d, q);
+
+        fmpz_set_ui(p, q);
+        fmpz_set_ui(a, c);
+        fmpz_set_ui(b, d);
+
+        result = fmpz_discrete_log_ph(x, b, a, p);
+        y = n_discrete_log_ph(d, c, q);
+
+        if (!result || fmpz_cmp_ui(x, y) != 0)
+        {
+            flint_printf("FAIL (word):\n");
+            flint_printf("p = %wu, a = %wu, b = %wu, y = %wu, x = ",
+                         q, c, d, y), fmpz_print(x), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_clear(p);
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(x);
+    }
+
+#if FLINT64
+    /* subgroups too large for a BSGS table use Pollard rho */
+    for (i = 0; i < flint_test_multiplier(); i++)
+    {
+        fmpz_t p, a, b, x, y;
+        mp_limb_t q;
+
+        fmpz_init(p);
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(x);
+        fmpz_init(y);
+
+        q = n_randprime(state, FLINT_DISCRETE_LOG_BSGS_BITS + 1, 0);
+
+        do
+        {
+            fmpz_set_ui(p, q);
+            fmpz_mul_ui(p, p, n_randprime(state, 20, 0));
+            fmpz_mul_2exp(p, p, 1);
+            fmpz_add_ui(p, p, 1);
+        } while (!fmpz_is_probabprime(p));
+
+        fmpz_randm(a, state, p);
+        if (fmpz_is_zero(a))
+            fmpz_one(a);
+        fmpz_randm(x, state, p);
+        fmpz_powm(b, a, x, p);
+
+        result = fmpz_discrete_log_ph(x, b, a, p);
+        fmpz_powm(y, a, x, p);
+
+        if (!result || !fmpz_equal(y, b))
+        {
+            flint_printf("FAIL (rho):\n");
+            flint_printf("p = "), fmpz_print(p), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_clear(p);
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(x);
+        fmpz_clear(y);
+    }
+#endif
+
+    /* p - 1 with a prime factor that does not fit in a limb */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p, q, x;
+
+        fmpz_init(p);
+        fmpz_init(q);
+        fmpz_init(x);
+
+        do
+        {
+            fmpz_randbits(q, state, FLINT_BITS + 10);
+            fmpz_abs(q, q);
+        } while (!fmpz_is_probabprime(q));
+
+        fmpz_add_ui(p, q, 1);
+        do
+        {
+            fmpz_add(p, p, q);
+        } while (!fmpz_is_probabprime(p));
+
+        if (fmpz_discrete_log_ph(x, p, p, p))
+        {
+            flint_printf("FAIL (not smooth):\n");
+            flint_printf("p = "), fmpz_print(p), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_clear(p);
+        fmpz_clear(q);
+        fmpz_clear(x);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,124 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+static void
+randprime(fmpz_t p, flint_rand_t state, mp_bitcnt_t bits)
+{
+    mpz_t z;
+
+    mpz_init(z);
+    fmpz_randbits(p, state, bits);
+    fmpz_abs(p, p);
+    fmpz_get_mpz(z, p);
+    mpz_nextprime(z, z);
+    fmpz_set_mpz(p, z);
+    mpz_clear(z);
+}
+
+int main(void)
+{
+    int * res;
+    fmpz * v;
+    slong i, j, len;
+    fmpz_t q;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("is_probabprime_vec....");
+    fflush(stdout);
+
+    fmpz_init(q);
+
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        len = n_randint(state, 300);
+
+        v = _fmpz_vec_init(len);
+        res = flint_malloc(len * sizeof(int));
+
+        for (j = 0; j < len; j++)
+        {
+            switch (n_randint(state, 5))
+            {
+                case 0:
+                    randprime(v + j, state, n_randint(state, 150) + 2);
+                    break;
+                case 1:
+                    randprime(v + j, state, n_randint(state, 80) + 2);
+                    randprime(q, state, n_randint(state, 80) + 2);
+                    fmpz_mul(v + j, v + j, q);
+                    break;
+                case 2:
+                    /* one limb values too large for a small fmpz */
+                    if (n_randint(state, 2))
+                        randprime(v + j, state, FLINT_BITS - 1);
+                    else
+                    {
+                        randprime(v + j, state, FLINT_BITS / 2 - 1);
+                        randprime(q, state, FLINT_BITS / 2);
+                        fmpz_mul(v + j, v + j, q);
+                    }
+                    break;
+                default:
+                    fmpz_randtest(v + j, state, n_randint(state, 200) + 1);
+            }
+        }
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        fmpz_is_probabprime_vec(res, v, len);
+
+        for (j = 0; j < len; j++)
+        {
+            if (res[j] != fmpz_is_probabprime(v + j))
+            {
+                flint_printf("FAIL:\n");
+                fmpz_print(v + j);
+                flint_printf("\nres = %d\n", res[j]);
+                abort();
+            }
+        }
+
+        _fmpz_vec_clear(v, len);
+        flint_free(res);
+    }
+
+    flint_set_num_threads(1);
+
+    fmpz_clear(q);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
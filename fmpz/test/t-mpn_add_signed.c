@@ -0,0 +1,116 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mpn_add_signed....");
+    fflush(stdout);
+
+    _flint_rand_init_gmp(state);
+
+    for (i = 0; i < 100000 * flint_test_multiplier(); i++)
+    {
+        mpz_t a, b, c, d;
+        mp_ptr r;
+        mp_size_t n, rs;
+        int alias;
+
+        mpz_init(a);
+        mpz_init(b);
+        mpz_init(c);
+        mpz_init(d);
+
+        mpz_rrandomb(a, state->gmp_state, n_randint(state, 700));
+        if (n_randint(state, 3) == 0)
+            mpz_set(b, a);
+        else
+            mpz_rrandomb(b, state->gmp_state, n_randint(state, 700));
+        if (n_randint(state, 2))
+            mpz_neg(a, a);
+        if (n_randint(state, 2))
+            mpz_neg(b, b);
+
+        mpz_add(c, a, b);
+
+        n = FLINT_MAX(mpz_size(a), mpz_size(b)) + 1;
+        alias = n_randint(state, 3);
+
+        if (alias == 1)  /* r aliases the first operand */
+        {
+            mpz_realloc2(a, n * FLINT_BITS);
+            r = a->_mp_d;
+        }
+        else if (alias == 2)  /* r aliases the second operand */
+        {
+            mpz_realloc2(b, n * FLINT_BITS);
+            r = b->_mp_d;
+        }
+        else
+        {
+            mpz_realloc2(d, n * FLINT_BITS);
+            r = d->_mp_d;
+        }
+
+        rs = _fmpz_mpn_add_signed(r, a->_mp_d, a->_mp_size,
+                                     b->_mp_d, b->_mp_size);
+
+        if (alias == 1)
+            a->_mp_size = rs;
+        else if (alias == 2)
+            b->_mp_size = rs;
+        else
+            d->_mp_size = rs;
+
+        result = (mpz_cmp(c, alias == 1 ? a : alias == 2 ? b : d) == 0);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            gmp_printf("c = %Zd, rs = %wd, alias = %d\n", c, rs, alias);
+            abort();
+        }
+
+        mpz_clear(a);
+        mpz_clear(b);
+        mpz_clear(c);
+        mpz_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mpn_mul_signed....");
+    fflush(stdout);
+
+    _flint_rand_init_gmp(state);
+
+    for (i = 0; i < 100000 * flint_test_multiplier(); i++)
+    {
+        mpz_t a, b, c, d;
+        mp_size_t n;
+        int square;
+
+        mpz_init(a);
+        mpz_init(b);
+        mpz_init(c);
+        mpz_init(d);
+
+        do {
+            mpz_rrandomb(a, state->gmp_state, n_randint(state, 700) + 1);
+        } while (mpz_sgn(a) == 0);
+        do {
+            mpz_rrandomb(b, state->gmp_state, n_randint(state, 700) + 1);
+        } while (mpz_sgn(b) == 0);
+        if (n_randint(state, 2))
+            mpz_neg(a, a);
+        if (n_randint(state, 2))
+            mpz_neg(b, b);
+
+        square = n_randint(state, 4) == 0;
+
+        if (square)
+            mpz_mul(c, a, a);
+        else
+            mpz_mul(c, a, b);
+
+        n = mpz_size(a) + (square ? mpz_size(a) : mpz_size(b));
+        mpz_realloc2(d, n * FLINT_BITS);
+
+        if (square)
+            d->_mp_size = _fmpz_mpn_mul_signed(d->_mp_d,
+                              a->_mp_d, a->_mp_size, a->_mp_d, a->_mp_size);
+        else
+            d->_mp_size = _fmpz_mpn_mul_signed(d->_mp_d,
+                              a->_mp_d, a->_mp_size, b->_mp_d, b->_mp_size);
+
+        result = (mpz_cmp(c, d) == 0);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            gmp_printf("a = %Zd, b = %Zd, c = %Zd, d = %Zd\n", a, b, c, d);
+            abort();
+        }
+
+        mpz_clear(a);
+        mpz_clear(b);
+        mpz_clear(c);
+        mpz_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
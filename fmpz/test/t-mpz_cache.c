@@ -0,0 +1,293 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    fmpz * vec;
+    slong len;
+    ulong seed;
+}
+mpz_cache_arg_t;
+
+/* fills vec with large values which depend only on the seed and index */
+void *
+mpz_cache_producer(void * arg_ptr)
+{
+    mpz_cache_arg_t * arg = (mpz_cache_arg_t *) arg_ptr;
+    slong i;
+
+    for (i = 0; i < arg->len; i++)
+    {
+        fmpz_set_ui(arg->vec + i, arg->seed + i);
+        fmpz_mul_2exp(arg->vec + i, arg->vec + i, 100 + (i % 200));
+    }
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* checks and releases values allocated by another thread */
+void *
+mpz_cache_consumer(void * arg_ptr)
+{
+    mpz_cache_arg_t * arg = (mpz_cache_arg_t *) arg_ptr;
+    fmpz_t t;
+    slong i;
+
+    fmpz_init(t);
+
+    for (i = 0; i < arg->len; i++)
+    {
+        fmpz_set_ui(t, arg->seed + i);
+        fmpz_mul_2exp(t, t, 100 + (i % 200));
+
+        if (!fmpz_equal(t, arg->vec + i))
+            arg->seed = 0;
+
+        fmpz_zero(arg->vec + i);
+    }
+
+    fmpz_clear(t);
+
+    flint_cleanup();
+    return NULL;
+}
+
+int main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mpz_cache....");
+    fflush(stdout);
+
+    /* check that every promotion is counted as a hit or a miss, and
+       that released mpz's are reused */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz * vec;
+        slong j, len;
+        fmpz_mpz_cache_stats_t stats;
+
+        len = n_randint(state, 1000);
+        vec = _fmpz_vec_init(len);
+
+        _fmpz_mpz_cache_reset_stats();
+
+        for (j = 0; j < len; j++)
+            fmpz_set_ui(vec + j, COEFF_MAX + 1 + n_randint(state, 1000));
+
+        _fmpz_vec_zero(vec, len);
+
+        for (j = 0; j < len; j++)
+            fmpz_set_ui(vec + j, COEFF_MAX + 1 + n_randint(state, 1000));
+
+        _fmpz_mpz_cache_get_stats(stats);
+
+        /* nothing is counted if mpz's are not cached */
+        if (stats->hits + stats->misses != 0 &&
+            (stats->hits + stats->misses != 2 * len || stats->hits < len))
+        {
+            flint_printf("FAIL (counts):\n");
+            flint_printf("len = %wd, hits = %wu, misses = %wu\n",
+                len, stats->hits, stats->misses);
+            abort();
+        }
+
+        _fmpz_vec_clear(vec, len);
+    }
+
+    /* release values in other threads than the ones they were created in */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        pthread_t threads[4];
+        mpz_cache_arg_t args[4];
+        slong j, k;
+
+        for (j = 0; j < 4; j++)
+        {
+            args[j].len = n_randint(state, 2000);
+            args[j].vec = _fmpz_vec_init(args[j].len);
+            args[j].seed = 1 + n_randint(state, 1000);
+        }
+
+        for (k = 0; k < 3; k++)
+        {
+            for (j = 0; j < 4; j++)
+                pthread_create(&threads[j], NULL, mpz_cache_producer,
+                                                                 &args[j]);
+            for (j = 0; j < 4; j++)
+                pthread_join(threads[j], NULL);
+
+            /* each consumer gets the values of another producer */
+            for (j = 0; j < 4; j++)
+            {
+                mpz_cache_arg_t t = args[j];
+                args[j] = args[(j + 1) % 4];
+                args[(j + 1) % 4] = t;
+            }
+
+            for (j = 0; j < 4; j++)
+                pthread_create(&threads[j], NULL, mpz_cache_consumer,
+                                                                 &args[j]);
+            for (j = 0; j < 4; j++)
+                pthread_join(threads[j], NULL);
+
+            for (j = 0; j < 4; j++)
+            {
+                if (args[j].seed == 0)
+                {
+                    flint_printf("FAIL (threads):\n");
+                    flint_printf("i = %d, j = %wd, k = %wd\n", i, j, k);
+                    abort();
+                }
+            }
+        }
+
+        for (j = 0; j < 4; j++)
+            _fmpz_vec_clear(args[j].vec, args[j].len);
+    }
+
+    /* values growing past and shrinking below FMPZ_INLINE_LIMBS, with the
+       limbs going through GMP, the fmpz functions and readonly views */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b, c;
+        mpz_t w, x, y, z;
+        slong j;
+
+        fmpz_init(a);
+        fmpz_init(c);
+        if (n_randint(state, 2))
+            fmpz_init2(b, n_randint(state, 3 * FMPZ_INLINE_LIMBS));
+        else
+            fmpz_init(b);
+        mpz_init(x);
+        mpz_init(y);
+        mpz_init(z);
+
+        for (j = 0; j < 20; j++)
+        {
+            mp_bitcnt_t bits;
+
+            bits = n_randint(state, 3 * FMPZ_INLINE_LIMBS * FLINT_BITS) + 1;
+            fmpz_randtest(a, state, bits);
+            fmpz_get_mpz(x, a);
+
+            switch (n_randint(state, 4))
+            {
+                case 0:
+                    fmpz_mul(b, b, a);
+                    fmpz_get_mpz(y, b);
+                    mpz_mul(z, z, x);
+                    break;
+                case 1:
+                    fmpz_add(b, b, a);
+                    mpz_add(z, z, x);
+                    fmpz_get_mpz(y, b);
+                    break;
+                case 2:
+                    /* GMP reallocates the limbs of b directly */
+                    if (COEFF_IS_MPZ(*b))
+                    {
+                        __mpz_struct * m = COEFF_TO_PTR(*b);
+                        ulong e;
+
+                        e = n_randint(state, 2*FMPZ_INLINE_LIMBS*FLINT_BITS);
+                        mpz_mul_2exp(m, m, e);
+                        mpz_mul_2exp(z, z, e);
+                        _fmpz_demote_val(b);
+                    }
+                    fmpz_get_mpz(y, b);
+                    break;
+                default:
+                    /* a readonly view of b, and b back from a copy of it */
+                    if (COEFF_IS_MPZ(*b))
+                        _fmpz_demote_val(b);
+                    flint_mpz_init_set_readonly(w, b);
+                    fmpz_init_set_readonly(c, w);
+                    fmpz_set(a, c);
+                    fmpz_clear_readonly(c);
+                    flint_mpz_clear_readonly(w);
+                    fmpz_swap(a, b);
+                    fmpz_get_mpz(y, b);
+            }
+
+            if (mpz_cmp(y, z) != 0)
+            {
+                flint_printf("FAIL (inline limbs):\n");
+                flint_printf("i = %d, j = %wd\n", i, j);
+                abort();
+            }
+
+#if FLINT_FMPZ_INLINE
+            /* GMP may move the limbs of b out, but a new copy of a value
+               which fits must keep them in its block */
+            fmpz_set(c, b);
+            if (COEFF_IS_MPZ(*c) &&
+                COEFF_TO_PTR(*c)->_mp_alloc <= FMPZ_INLINE_LIMBS &&
+                COEFF_TO_PTR(*c)->_mp_d != (mp_ptr) (COEFF_TO_PTR(*c) + 1))
+            {
+                flint_printf("FAIL (limbs not inline):\n");
+                flint_printf("i = %d, j = %wd\n", i, j);
+                abort();
+            }
+            fmpz_zero(c);
+#endif
+
+            if (n_randint(state, 8) == 0)
+            {
+                fmpz_zero(b);
+                mpz_set_ui(z, 0);
+            }
+        }
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+        mpz_clear(x);
+        mpz_clear(y);
+        mpz_clear(z);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+int main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("powm_fixed....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_powm_fixed_t P;
+        fmpz_t g, m, r;
+        fmpz * e, * f;
+        mp_bitcnt_t ebits;
+        slong j, len;
+
+        fmpz_init(g);
+        fmpz_init(m);
+        fmpz_init(r);
+
+        fmpz_randtest_not_zero(m, state, n_randint(state, 300) + 1);
+        fmpz_abs(m, m);
+        fmpz_randtest(g, state, n_randint(state, 400) + 1);
+        ebits = n_randint(state, 300);
+
+        fmpz_powm_fixed_init(P, g, m, ebits);
+
+        len = n_randint(state, 10);
+        e = _fmpz_vec_init(len);
+        f = _fmpz_vec_init(len);
+
+        /* some exponents exceed ebits */
+        for (j = 0; j < len; j++)
+            fmpz_randtest_unsigned(e + j, state,
+                                   n_randint(state, ebits + 20) + 1);
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+
+        fmpz_powm_fixed_vec(f, e, len, P);
+
+        result = 1;
+        for (j = 0; j < len; j++)
+        {
+            fmpz_powm(r, g, e + j, m);
+            result &= fmpz_equal(r, f + j);
+
+            /* aliasing */
+            fmpz_set(r, e + j);
+            fmpz_powm_fixed(r, r, P);
+            result &= fmpz_equal(r, f + j);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m = "), fmpz_print(m), flint_printf("\n");
+            flint_printf("g = "), fmpz_print(g), flint_printf("\n");
+            flint_printf("ebits = %wu\n", ebits);
+            abort();
+        }
+
+        fmpz_powm_fixed_clear(P);
+
+        _fmpz_vec_clear(e, len);
+        _fmpz_vec_clear(f, len);
+
+        fmpz_clear(g);
+        fmpz_clear(m);
+        fmpz_clear(r);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
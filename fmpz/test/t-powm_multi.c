@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+int main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("powm_multi....");
+    fflush(stdout);
+
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        fmpz_t m, r, s, t;
+        fmpz * g, * e;
+        slong j, n;
+
+        fmpz_init(m);
+        fmpz_init(r);
+        fmpz_init(s);
+        fmpz_init(t);
+
+        n = n_randint(state, 5);
+        g = _fmpz_vec_init(n);
+        e = _fmpz_vec_init(n);
+
+        fmpz_randtest_not_zero(m, state, n_randint(state, 1500) + 1);
+        fmpz_abs(m, m);
+
+        for (j = 0; j < n; j++)
+        {
+            fmpz_randtest(g + j, state, n_randint(state, 300) + 1);
+            fmpz_randtest_unsigned(e + j, state, n_randint(state, 300) + 1);
+        }
+
+        fmpz_powm_multi(r, g, e, n, m);
+
+        fmpz_one(s);
+        for (j = 0; j < n; j++)
+        {
+            fmpz_powm(t, g + j, e + j, m);
+            fmpz_mul(s, s, t);
+        }
+        fmpz_mod(s, s, m);
+
+        result = fmpz_equal(r, s);
+
+        /* aliasing */
+        if (n > 0)
+        {
+            fmpz_powm_multi(g + 0, g, e, n, m);
+            result = result && fmpz_equal(g + 0, s);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wd, m = ", n), fmpz_print(m);
+            flint_printf("\nr = "), fmpz_print(r);
+            flint_printf("\ns = "), fmpz_print(s), flint_printf("\n");
+            abort();
+        }
+
+        _fmpz_vec_clear(g, n);
+        _fmpz_vec_clear(e, n);
+
+        fmpz_clear(m);
+        fmpz_clear(r);
+        fmpz_clear(s);
+        fmpz_clear(t);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
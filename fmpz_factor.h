@@ -63,6 +63,8 @@ FLINT_DLL void _fmpz_factor_set_length(fmpz_factor_t factor, slong newlen);
 
 /* Factoring *****************************************************************/
 
+#define FMPZ_FACTOR_TRIAL_PRIMES 3000
+
 FLINT_DLL void _fmpz_factor_extend_factor_ui(fmpz_factor_t factor, mp_limb_t n);
 
 FLINT_DLL int fmpz_factor_trial_range(fmpz_factor_t factor, const fmpz_t n,
@@ -70,11 +72,17 @@ FLINT_DLL int fmpz_factor_trial_range(fmpz_factor_t factor, const fmpz_t n,
 
 FLINT_DLL void fmpz_factor(fmpz_factor_t factor, const fmpz_t n);
 
+FLINT_DLL void _fmpz_factor_no_trial(fmpz_factor_t factor,
+                                               const fmpz_t n, ulong exp);
+
 FLINT_DLL void fmpz_factor_si(fmpz_factor_t factor, slong n);
 
 FLINT_DLL int fmpz_factor_pp1(fmpz_t factor, const fmpz_t n, 
                                        ulong B1, ulong B2_sqrt, ulong c);
 
+FLINT_DLL int fmpz_factor_ecm(fmpz_t f, ulong curves, ulong B1, ulong B2,
+                                        flint_rand_t state, const fmpz_t n);
+
 /* Expansion *****************************************************************/
 
 FLINT_DLL void fmpz_factor_expand_iterative(fmpz_t n, const fmpz_factor_t factor);
@@ -120,13 +120,30 @@ fmpz_factor(fmpz_factor_t factor, const fmpz_t n)
             trial_stop = trial_start + 1000;
             continue;
         }
-        else
+        else if (trial_stop < FMPZ_FACTOR_TRIAL_PRIMES)
         {
-            /* Insert primality test, perfect power test, other factoring
-               algorithms here... */
             trial_start = trial_stop;
             trial_stop = trial_start + 1000;
         }
+        else
+        {
+            /* No small factors left, hand the cofactor to primality
+               testing, perfect power detection and the quadratic sieve */
+            __mpz_struct m;
+            fmpz_t c;
+
+            m._mp_d = xd;
+            m._mp_size = xsize;
+            m._mp_alloc = xsize;
+
+            fmpz_init(c);
+            fmpz_set_mpz(c, &m);
+            _fmpz_factor_no_trial(factor, c, 1);
+            fmpz_clear(c);
+
+            TMP_END;
+            return;
+        }
     }
 
     /* Any single-limb factor left? */
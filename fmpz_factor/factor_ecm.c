@@ -0,0 +1,440 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_factor.h"
+#include "mpn_extras.h"
+#include "ulong_extras.h"
+
+/*
+   The elliptic curve method with Montgomery curves in x-only coordinates
+   (X : Z), as for n_factor_ecm. Residues are nn limb integers shifted left
+   by norm bits, so that flint_mpn_mulmod_preinvn can be used directly, as
+   in fmpz_factor_pp1.
+*/
+
+typedef struct
+{
+    mp_size_t nn;
+    mp_ptr n;       /* n shifted left by norm bits */
+    mp_ptr ninv;    /* precomputed inverse of the shifted n */
+    ulong norm;
+    mp_ptr a24;     /* (A + 2)/4 */
+    mp_ptr t;       /* temporaries */
+    mp_ptr u;
+    mp_ptr v;
+    mp_ptr w;
+} _ecm_struct;
+
+typedef _ecm_struct _ecm_t[1];
+
+#define ecm_mulmod(r, a, b, E) \
+   flint_mpn_mulmod_preinvn(r, a, b, (E)->nn, (E)->n, (E)->ninv, (E)->norm)
+
+static void
+ecm_addmod(mp_ptr r, mp_srcptr a, mp_srcptr b, const _ecm_t E)
+{
+    if (mpn_add_n(r, a, b, E->nn) || mpn_cmp(r, E->n, E->nn) >= 0)
+        mpn_sub_n(r, r, E->n, E->nn);
+}
+
+static void
+ecm_submod(mp_ptr r, mp_srcptr a, mp_srcptr b, const _ecm_t E)
+{
+    if (mpn_sub_n(r, a, b, E->nn))
+        mpn_add_n(r, r, E->n, E->nn);
+}
+
+/* (x, z) = 2 (x1, z1), aliasing allowed */
+static void
+ecm_double(mp_ptr x, mp_ptr z, mp_srcptr x1, mp_srcptr z1, _ecm_t E)
+{
+    ecm_addmod(E->u, x1, z1, E);
+    ecm_mulmod(E->u, E->u, E->u, E); /* (x + z)^2 */
+    ecm_submod(E->v, x1, z1, E);
+    ecm_mulmod(E->v, E->v, E->v, E); /* (x - z)^2 */
+    ecm_submod(E->t, E->u, E->v, E); /* 4xz */
+
+    ecm_mulmod(x, E->u, E->v, E);
+    ecm_mulmod(E->w, E->a24, E->t, E);
+    ecm_addmod(E->w, E->w, E->v, E);
+    ecm_mulmod(z, E->t, E->w, E);
+}
+
+/*
+   (x, z) = (x1, z1) + (x2, z2) given their difference (xd, zd), where
+   (x, z) may alias (x1, z1) or (x2, z2) but not (xd, zd)
+*/
+static void
+ecm_add(mp_ptr x, mp_ptr z, mp_srcptr x1, mp_srcptr z1, mp_srcptr x2,
+            mp_srcptr z2, mp_srcptr xd, mp_srcptr zd, _ecm_t E)
+{
+    ecm_submod(E->u, x1, z1, E);
+    ecm_addmod(E->t, x2, z2, E);
+    ecm_mulmod(E->u, E->u, E->t, E);
+    ecm_addmod(E->v, x1, z1, E);
+    ecm_submod(E->t, x2, z2, E);
+    ecm_mulmod(E->v, E->v, E->t, E);
+
+    ecm_addmod(E->w, E->u, E->v, E);
+    ecm_mulmod(E->w, E->w, E->w, E);
+    ecm_submod(E->t, E->u, E->v, E);
+    ecm_mulmod(E->t, E->t, E->t, E);
+
+    ecm_mulmod(x, zd, E->w, E);
+    ecm_mulmod(z, xd, E->t, E);
+}
+
+/*
+   Montgomery ladder: (x0, z0) = k (x, z) and (x1, z1) = (k + 1) (x, z)
+   for k >= 1, where (x, z) must not alias the outputs
+*/
+static void
+ecm_ladder(mp_ptr x0, mp_ptr z0, mp_ptr x1, mp_ptr z1,
+                     mp_srcptr x, mp_srcptr z, mp_limb_t k, _ecm_t E)
+{
+    mp_limb_t bit = (UWORD(1) << (FLINT_BIT_COUNT(k) - 1)) >> 1;
+
+    flint_mpn_copyi(x0, x, E->nn);
+    flint_mpn_copyi(z0, z, E->nn);
+    ecm_double(x1, z1, x, z, E);
+
+    for ( ; bit != 0; bit >>= 1)
+    {
+        if (k & bit)
+        {
+            ecm_add(x0, z0, x0, z0, x1, z1, x, z, E);
+            ecm_double(x1, z1, x1, z1, E);
+        } else
+        {
+            ecm_add(x1, z1, x0, z0, x1, z1, x, z, E);
+            ecm_double(x0, z0, x0, z0, E);
+        }
+    }
+}
+
+/* set the residue r to a, where 0 <= a < n */
+static void
+ecm_set_fmpz(mp_ptr r, const fmpz_t a, const _ecm_t E)
+{
+    mp_size_t i, an;
+
+    flint_mpn_zero(r, E->nn);
+
+    if (!COEFF_IS_MPZ(*a))
+        r[0] = *a;
+    else
+    {
+        an = COEFF_TO_PTR(*a)->_mp_size;
+        for (i = 0; i < an; i++)
+            r[i] = COEFF_TO_PTR(*a)->_mp_d[i];
+    }
+
+    if (E->norm)
+        mpn_lshift(r, r, E->nn, E->norm);
+}
+
+/* a = r, where r is a residue */
+static void
+ecm_get_fmpz(fmpz_t a, mp_srcptr r, const _ecm_t E)
+{
+    __mpz_struct * m = _fmpz_promote(a);
+    mp_size_t rn = E->nn;
+
+    mpz_realloc2(m, E->nn*FLINT_BITS);
+
+    if (E->norm)
+        mpn_rshift(m->_mp_d, r, E->nn, E->norm);
+    else
+        flint_mpn_copyi(m->_mp_d, r, E->nn);
+
+    MPN_NORM(m->_mp_d, rn);
+    m->_mp_size = rn;
+    _fmpz_demote_val(a);
+}
+
+/* f = gcd(r, n) */
+static void
+ecm_gcd(fmpz_t f, mp_srcptr r, const fmpz_t n, const _ecm_t E)
+{
+    ecm_get_fmpz(f, r, E);
+    fmpz_gcd(f, f, n);
+}
+
+/*
+   Choose the curve for sigma by Suyama's parametrisation and its starting
+   point. Returns 1 and sets f if this finds a factor of n.
+*/
+static int
+ecm_select_curve(fmpz_t f, mp_ptr x, mp_ptr z, const fmpz_t sigma,
+                                               const fmpz_t n, _ecm_t E)
+{
+    fmpz_t u, v, t, w;
+    int ret = 0;
+
+    fmpz_init(u);
+    fmpz_init(v);
+    fmpz_init(t);
+    fmpz_init(w);
+
+    fmpz_mul(u, sigma, sigma);
+    fmpz_sub_ui(u, u, 5);
+    fmpz_mod(u, u, n);           /* u = sigma^2 - 5 */
+    fmpz_mul_ui(v, sigma, 4);
+    fmpz_mod(v, v, n);           /* v = 4 sigma */
+
+    fmpz_powm_ui(t, u, 3, n);
+    ecm_set_fmpz(x, t, E);       /* x = u^3 */
+    fmpz_mul(w, t, v);
+    fmpz_mul_ui(w, w, 16);
+    fmpz_mod(w, w, n);           /* w = 16 u^3 v */
+    fmpz_powm_ui(t, v, 3, n);
+    ecm_set_fmpz(z, t, E);       /* z = v^3 */
+
+    /* a24 = (v - u)^3 (3u + v) / (16 u^3 v) */
+    fmpz_gcd(f, w, n);
+    if (!fmpz_is_one(f))
+    {
+        ret = !fmpz_equal(f, n);
+        goto cleanup;
+    }
+
+    fmpz_invmod(w, w, n);
+    fmpz_sub(t, v, u);
+    fmpz_powm_ui(t, t, 3, n);
+    fmpz_mul(t, t, w);
+    fmpz_mul_ui(u, u, 3);
+    fmpz_add(u, u, v);
+    fmpz_mul(t, t, u);
+    fmpz_mod(t, t, n);
+    ecm_set_fmpz(E->a24, t, E);
+
+cleanup:
+    fmpz_clear(u);
+    fmpz_clear(v);
+    fmpz_clear(t);
+    fmpz_clear(w);
+
+    return ret;
+}
+
+int
+fmpz_factor_ecm(fmpz_t f, ulong curves, ulong B1, ulong B2,
+                                        flint_rand_t state, const fmpz_t n)
+{
+    _ecm_t E;
+    mp_size_t nn = fmpz_size(n);
+    mp_ptr x, z, x1, z1, dx, dz, gx, gz, hx, hz, acc, baby, pre, tmp;
+    mp_limb_t * prod;
+    unsigned char * tab;
+    ulong * j_arr;
+    ulong D, g0;
+    slong prod_len, num_g, num_j, c, i, k;
+    fmpz_t sigma;
+    int ret = 0;
+
+    if (fmpz_is_even(n))
+    {
+        fmpz_set_ui(f, 2);
+        return 1;
+    }
+
+    if (nn == 1)
+    {
+        mp_limb_t g;
+
+        ret = n_factor_ecm(&g, curves, B1, B2, state, fmpz_get_ui(n));
+        if (ret)
+            fmpz_set_ui(f, g);
+        return ret;
+    }
+
+    E->nn = nn;
+    tmp = flint_malloc(19*nn*sizeof(mp_limb_t));
+    E->n = tmp;
+    E->ninv = E->n + nn;
+    E->a24 = E->ninv + nn;
+    E->t = E->a24 + nn;
+    E->u = E->t + nn;
+    E->v = E->u + nn;
+    E->w = E->v + nn;
+    x = E->w + nn;
+    z = x + nn;
+    x1 = z + nn;
+    z1 = x1 + nn;
+    dx = z1 + nn;
+    dz = dx + nn;
+    gx = dz + nn;
+    gz = gx + nn;
+    hx = gz + nn;
+    hz = hx + nn;
+    acc = hz + nn;
+
+    count_leading_zeros(E->norm, COEFF_TO_PTR(*n)->_mp_d[nn - 1]);
+    if (E->norm)
+        mpn_lshift(E->n, COEFF_TO_PTR(*n)->_mp_d, nn, E->norm);
+    else
+        flint_mpn_copyi(E->n, COEFF_TO_PTR(*n)->_mp_d, nn);
+    flint_mpn_preinvn(E->ninv, E->n, nn);
+
+    prod = _n_factor_ecm_stage1_table(&prod_len, B1);
+    tab = _n_factor_ecm_stage2_table(&num_g, &g0, &D, &num_j, &j_arr, B1, B2);
+    baby = flint_malloc(2*(D/4)*nn*sizeof(mp_limb_t));
+    pre = flint_malloc(num_j*nn*sizeof(mp_limb_t));
+
+    fmpz_init(sigma);
+
+    for (c = 0; c < curves && ret == 0; c++)
+    {
+        /********************** Select curve ************************/
+
+        fmpz_sub_ui(sigma, n, 7);
+        fmpz_randm(sigma, state, sigma);
+        fmpz_add_ui(sigma, sigma, 6);
+
+        if (ecm_select_curve(f, x, z, sigma, n, E))
+        {
+            ret = 1;
+            break;
+        }
+
+        if (!fmpz_is_one(f))
+            continue;
+
+        /************************* Stage I **************************/
+
+        for (i = 0; i < prod_len; i++)
+        {
+            if (prod[i] != 1)
+            {
+                ecm_ladder(x1, z1, dx, dz, x, z, prod[i], E);
+                flint_mpn_copyi(x, x1, nn);
+                flint_mpn_copyi(z, z1, nn);
+            }
+        }
+
+        ecm_gcd(f, z, n, E);
+        if (fmpz_equal(f, n))
+            continue;
+        if (!fmpz_is_one(f))
+        {
+            ret = 1;
+            break;
+        }
+
+        if (num_g == 0)
+            continue;
+
+        /************************* Stage II *************************/
+
+        /* baby steps j Q for odd j < D/2, in the entry for (j - 1)/2 */
+        flint_mpn_copyi(baby, x, nn);
+        flint_mpn_copyi(baby + nn, z, nn);
+        ecm_double(dx, dz, x, z, E);
+        ecm_add(baby + 2*nn, baby + 3*nn, dx, dz, x, z, x, z, E);
+        for (k = 2; k < D/4; k++)
+            ecm_add(baby + 2*k*nn, baby + (2*k + 1)*nn,
+                    baby + (2*k - 2)*nn, baby + (2*k - 1)*nn, dx, dz,
+                    baby + (2*k - 4)*nn, baby + (2*k - 3)*nn, E);
+
+        /*
+           normalise the baby steps which are used to z = 1, with a single
+           inversion, so that each prime needs two multiplications below
+        */
+        flint_mpn_copyi(pre, baby + nn*(j_arr[0] - 1) + nn, nn);
+        for (k = 1; k < num_j; k++)
+            ecm_mulmod(pre + k*nn, pre + (k - 1)*nn,
+                       baby + nn*(j_arr[k] - 1) + nn, E);
+
+        ecm_get_fmpz(sigma, pre + (num_j - 1)*nn, E);
+        if (!fmpz_invmod(sigma, sigma, n))
+        {
+            ecm_gcd(f, pre + (num_j - 1)*nn, n, E);
+            if (!fmpz_equal(f, n))
+                ret = 2;
+            continue;
+        }
+        ecm_set_fmpz(acc, sigma, E);
+
+        for (k = num_j - 1; k >= 0; k--)
+        {
+            mp_ptr b = baby + nn*(j_arr[k] - 1);
+
+            if (k > 0)
+                ecm_mulmod(x1, acc, pre + (k - 1)*nn, E);
+            else
+                flint_mpn_copyi(x1, acc, nn);
+
+            ecm_mulmod(acc, acc, b + nn, E);
+            ecm_mulmod(b, b, x1, E);
+        }
+
+        /* giant steps g D Q, starting from g0 D Q and (g0 + 1) D Q */
+        ecm_ladder(dx, dz, x1, z1, x, z, D, E);
+        ecm_ladder(gx, gz, hx, hz, dx, dz, g0, E);
+
+        flint_mpn_zero(acc, nn);
+        acc[0] = UWORD(1) << E->norm;
+
+        for (i = 0; i < num_g; i++)
+        {
+            for (k = 0; k < num_j; k++)
+            {
+                if (tab[i*num_j + k])
+                {
+                    ecm_mulmod(x1, baby + nn*(j_arr[k] - 1), gz, E);
+                    ecm_submod(x1, gx, x1, E);
+                    ecm_mulmod(acc, acc, x1, E);
+                }
+            }
+
+            /* (g + 2) D Q = (g + 1) D Q + D Q, with difference g D Q */
+            ecm_add(x1, z1, hx, hz, dx, dz, gx, gz, E);
+            MP_PTR_SWAP(gx, hx);
+            MP_PTR_SWAP(gz, hz);
+            MP_PTR_SWAP(hx, x1);
+            MP_PTR_SWAP(hz, z1);
+        }
+
+        ecm_gcd(f, acc, n, E);
+        if (!fmpz_is_one(f) && !fmpz_equal(f, n))
+            ret = 2;
+    }
+
+    if (ret == 0)
+        fmpz_zero(f);
+
+    fmpz_clear(sigma);
+    flint_free(prod);
+    flint_free(tab);
+    flint_free(j_arr);
+    flint_free(baby);
+    flint_free(pre);
+    flint_free(tmp);
+
+    return ret;
+}
@@ -0,0 +1,184 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_factor.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+
+#define PP1_B1 2000
+#define PP1_B2_SQRT 200
+
+/*
+   ECM runs before the quadratic sieve, with effort growing with the size
+   of n: { minimum bits of n, B1, curves }, the three levels being enough
+   to find most factors of up to 15, 20 and 25 digits
+*/
+static const ulong ecm_tab[][3] =
+{
+    { 140,  2000,  25 },
+    { 200, 11000,  40 },
+    { 230, 11000,  50 },
+    { 260, 50000, 300 }
+};
+
+#define ECM_TAB_SIZE (sizeof(ecm_tab)/(3*sizeof(ulong)))
+
+/* sets r and returns e > 1 if n = r^e for a multi-limb n, otherwise 0 */
+static ulong
+_fmpz_perfect_power(fmpz_t r, const fmpz_t n)
+{
+    ulong e;
+    fmpz_t t;
+
+    if (!mpz_perfect_power_p(COEFF_TO_PTR(*n)))
+        return 0;
+
+    fmpz_init(t);
+
+    for (e = 2; ; e = n_nextprime(e, 0))
+    {
+        fmpz_root(r, n, e);
+        fmpz_pow_ui(t, r, e);
+        if (fmpz_equal(t, n))
+            break;
+    }
+
+    fmpz_clear(t);
+
+    return e;
+}
+
+/* appends the prime factors of n > 1 with their exponents times exp */
+static void
+_fmpz_factor_no_trial_rec(fmpz_factor_t factor, const fmpz_t n, ulong exp)
+{
+    fmpz_t f, g;
+    ulong e, B1;
+    slong i;
+
+    if (fmpz_abs_fits_ui(n))
+    {
+        n_factor_t nfac;
+
+        n_factor_init(&nfac);
+        n_factor(&nfac, fmpz_get_ui(n), 0);
+
+        for (i = 0; i < nfac.num; i++)
+            _fmpz_factor_append_ui(factor, nfac.p[i], nfac.exp[i]*exp);
+
+        return;
+    }
+
+    if (fmpz_is_probabprime(n))
+    {
+        _fmpz_factor_append(factor, (fmpz *) n, exp);
+        return;
+    }
+
+    fmpz_init(f);
+    fmpz_init(g);
+
+    if ((e = _fmpz_perfect_power(f, n)) != 0)
+    {
+        _fmpz_factor_no_trial_rec(factor, f, exp*e);
+    }
+    else
+    {
+        /* catch factors p with p + 1 or p - 1 smooth cheaply */
+        if (!fmpz_factor_pp1(f, n, PP1_B1, PP1_B2_SQRT, 3)
+            || fmpz_cmp_ui(f, 1) <= 0 || fmpz_cmp(f, n) >= 0)
+        {
+            flint_rand_t state;
+            slong bits = fmpz_bits(n);
+            int found = 0;
+
+            flint_randinit(state);
+
+            for (i = 0; i < ECM_TAB_SIZE && bits >= ecm_tab[i][0]
+                                         && !found; i++)
+            {
+                found = fmpz_factor_ecm(f, ecm_tab[i][2], ecm_tab[i][1],
+                                        100*ecm_tab[i][1], state, n);
+            }
+
+            if (!found)
+                qsieve_factor(f, n);
+
+            /* the sieve failed, fall back to ECM with growing bounds */
+            for (B1 = 2*ecm_tab[ECM_TAB_SIZE - 1][1]; fmpz_is_zero(f);
+                                                                  B1 *= 2)
+                fmpz_factor_ecm(f, 100, B1, 100*B1, state, n);
+
+            flint_randclear(state);
+        }
+
+        fmpz_divexact(g, n, f);
+        _fmpz_factor_no_trial_rec(factor, f, exp);
+        _fmpz_factor_no_trial_rec(factor, g, exp);
+    }
+
+    fmpz_clear(f);
+    fmpz_clear(g);
+}
+
+void
+_fmpz_factor_no_trial(fmpz_factor_t factor, const fmpz_t n, ulong exp)
+{
+    slong i, j, start = factor->num;
+    ulong e;
+
+    _fmpz_factor_no_trial_rec(factor, n, exp);
+
+    /* sort the new factors, merging repeated ones */
+    for (i = start + 1; i < factor->num; i++)
+    {
+        for (j = i; j > start && fmpz_cmp(factor->p + j - 1,
+                                           factor->p + j) > 0; j--)
+        {
+            fmpz_swap(factor->p + j - 1, factor->p + j);
+            e = factor->exp[j - 1];
+            factor->exp[j - 1] = factor->exp[j];
+            factor->exp[j] = e;
+        }
+    }
+
+    for (i = j = start; i < factor->num; i++)
+    {
+        if (j > start && fmpz_equal(factor->p + j - 1, factor->p + i))
+            factor->exp[j - 1] += factor->exp[i];
+        else
+        {
+            fmpz_swap(factor->p + j, factor->p + i);
+            factor->exp[j] = factor->exp[i];
+            j++;
+        }
+    }
+
+    _fmpz_factor_set_length(factor, j);
+}
@@ -38,8 +38,8 @@ fmpz_factor_trial_range(fmpz_factor_t factor, const fmpz_t n, ulong start, ulong
     mpz_t x;
     mp_ptr xd;
     mp_size_t xsize;
-    slong found;
-    slong trial_start, trial_stop;
+    ulong k;
+    n_primes_t iter;
     int ret = 1;
 
     if (!COEFF_IS_MPZ(*n))
@@ -67,62 +67,57 @@ fmpz_factor_trial_range(fmpz_factor_t factor, const fmpz_t n, ulong start, ulong
     xd = x->_mp_d;
     xsize = x->_mp_size;
 
+    /* Primes are taken from a segmented sieve, so that no table of
+       num_primes primes is kept in memory */
+    n_primes_init(iter);
+
     /* Factor out powers of two */
     if (start == 0)
     {
        xsize = flint_mpn_remove_2exp(xd, xsize, &exp);
        if (exp != 0)
            _fmpz_factor_append_ui(factor, UWORD(2), exp);
-    }
 
-    trial_start = FLINT_MAX(1, start);
-    trial_stop = FLINT_MIN(start + 1000, start + num_primes);
+       n_primes_next(iter);
+       k = 1;
+    }
+    else
+    {
+       n_primes_jump_after(iter, n_nth_prime(start));
+       k = start;
+    }
 
-    do
+    for ( ; k < start + num_primes && (xsize > 1 || xd[0] != 1); k++)
     {
-        found = flint_mpn_factor_trial(xd, xsize, trial_start, trial_stop);
+        p = n_primes_next(iter);
+
+        if (!flint_mpn_divisible_1_p(xd, xsize, p))
+            continue;
 
-        if (found)
+        exp = 1;
+        xsize = flint_mpn_divexact_1(xd, xsize, p);
+
+        /* Check if p^2 divides n */
+        if (flint_mpn_divisible_1_p(xd, xsize, p))
         {
-            p = n_primes_arr_readonly(found+1)[found];
-            exp = 1;
+            /* TODO: when searching for squarefree numbers
+               (Moebius function, etc), we can abort here. */
             xsize = flint_mpn_divexact_1(xd, xsize, p);
-
-            /* Check if p^2 divides n */
-            if (flint_mpn_divisible_1_p(xd, xsize, p))
-            {
-                /* TODO: when searching for squarefree numbers
-                   (Moebius function, etc), we can abort here. */
-                xsize = flint_mpn_divexact_1(xd, xsize, p);
-                exp = 2;
-            }
-
-            /* If we're up to cubes, then maybe there are higher powers */
-            if (exp == 2 && flint_mpn_divisible_1_p(xd, xsize, p))
-            {
-                xsize = flint_mpn_divexact_1(xd, xsize, p);
-                xsize = flint_mpn_remove_power_ascending(xd, xsize, &p, 1, &exp);
-                exp += 3;
-            }
-
-            _fmpz_factor_append_ui(factor, p, exp);
-            /* flint_printf("added %wu %wu\n", p, exp); */
-
-            /* Continue using only trial division whilst it is successful.
-               This allows quickly factoring huge highly composite numbers
-               such as factorials, which can arise in some applications. */
-            trial_start = found + 1;
-            trial_stop = FLINT_MIN(trial_start + 1000, start + num_primes);
-            continue;
+            exp = 2;
         }
-        else
+
+        /* If we're up to cubes, then maybe there are higher powers */
+        if (exp == 2 && flint_mpn_divisible_1_p(xd, xsize, p))
         {
-            /* Insert primality test, perfect power test, other factoring
-               algorithms here... */
-            trial_start = trial_stop;
-            trial_stop = FLINT_MIN(trial_start + 1000, start + num_primes);
+            xsize = flint_mpn_divexact_1(xd, xsize, p);
+            xsize = flint_mpn_remove_power_ascending(xd, xsize, &p, 1, &exp);
+            exp += 3;
         }
-    } while ((xsize > 1 || xd[0] != 1) && trial_start != trial_stop);
+
+        _fmpz_factor_append_ui(factor, p, exp);
+    }
+
+    n_primes_clear(iter);
 
     /* Any factor left? */
     if (xsize > 1 || xd[0] != 1)
@@ -166,6 +166,30 @@ int main(void)
     fmpz_set_mpz(x, y);
     check(x);
 
+    /* Products of large primes, or powers of a large prime */
+    for (i = 0; i < 5 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong num = n_randint(state, 3) + 1;
+
+        fmpz_init(p);
+        fmpz_randtest_not_zero(x, state, 14);
+
+        for (j = 0; j < num; j++)
+        {
+            fmpz_randbits(p, state, n_randint(state, 80 / num) + 20);
+            fmpz_get_mpz(y, p);
+            mpz_abs(y, y);
+            mpz_nextprime(y, y);
+            fmpz_set_mpz(p, y);
+            fmpz_pow_ui(p, p, num == 1 ? n_randint(state, 3) + 1 : 1);
+            fmpz_mul(x, x, p);
+        }
+
+        check(x);
+        fmpz_clear(p);
+    }
+
     fmpz_clear(x);
     mpz_clear(y);
 
@@ -0,0 +1,100 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_factor.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+   int i, result;
+   ulong count = UWORD(0);
+   FLINT_TEST_INIT(state);
+   
+
+   flint_printf("factor_ecm....");
+   fflush(stdout);
+
+   for (i = 0; i < 50 * flint_test_multiplier(); i++) /* Test random numbers */
+   {
+      fmpz_t n, p, f, r;
+      int found;
+
+      fmpz_init(n);
+      fmpz_init(p);
+      fmpz_init(f);
+      fmpz_init(r);
+
+      /* a factor of up to 40 bits of a number of up to 200 bits */
+      fmpz_set_ui(p, n_randprime(state, n_randint(state, 28) + 13, 0));
+      do {
+         fmpz_randbits(n, state, n_randint(state, 150) + 10);
+         fmpz_abs(n, n);
+      } while (fmpz_cmp_ui(n, 2) < 0);
+      if (fmpz_is_even(n))
+         fmpz_add_ui(n, n, 1);
+      fmpz_mul(n, n, p);
+
+      found = fmpz_factor_ecm(f, 100, 2000, 200000, state, n);
+
+      if (found)
+      {
+         count++;
+         fmpz_mod(r, n, f);
+         result = (fmpz_cmp_ui(f, 1) > 0 && fmpz_cmp(f, n) < 0
+                                         && fmpz_is_zero(r));
+         if (!result)
+         {
+            flint_printf("FAIL:\n");
+            flint_printf("n = ");
+            fmpz_print(n);
+            flint_printf(", f = ");
+            fmpz_print(f);
+            flint_printf("\n"); 
+            abort();
+         }
+      }
+
+      fmpz_clear(n);
+      fmpz_clear(p);
+      fmpz_clear(f);
+      fmpz_clear(r);
+   }
+   
+   if (count < 48 * flint_test_multiplier())
+   {
+      flint_printf("FAIL:\n");
+      flint_printf("Only %wu numbers factored\n", count); 
+      abort();
+   }
+
+   FLINT_TEST_CLEANUP(state);
+   flint_printf("PASS\n");
+   return 0;
+}
@@ -51,6 +51,13 @@
  extern "C" {
 #endif
 
+/* defaults for the tuning parameters, see flint_get_tuning() */
+#define FMPZ_MAT_MUL_CLASSICAL_CUTOFF 12 /* dim: classical -> others */
+#define FMPZ_MAT_MUL_STRASSEN_CUTOFF 60  /* dim: Strassen -> multi-mod */
+
+/* m*n*k below which the multi-modular product uses a single thread */
+#define FMPZ_MAT_MUL_MULTI_MOD_THREADED_CUTOFF 32768
+
 typedef struct
 {
     fmpz * entries;
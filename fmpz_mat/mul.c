@@ -29,6 +29,7 @@ void
 fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
 {
     slong dim, m, n, k;
+    const flint_tuning_struct * T;
 
     m = A->r;
     n = A->c;
@@ -45,8 +46,9 @@ fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
     }
 
     dim = FLINT_MIN(FLINT_MIN(m, n), k);
+    T = flint_get_tuning();
 
-    if (dim < 12)
+    if (dim < T->fmpz_mat_mul_classical_cutoff)
     {
         /* The inline version only benefits from large n */
         if (n <= 2)
@@ -66,7 +68,8 @@ fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
 
         bits = ab + bb + FLINT_BIT_COUNT(n) + 1;
 
-        if (5*(ab + bb) > dim * dim || (bits > FLINT_BITS - 3 && dim < 60))
+        if (5*(ab + bb) > dim * dim || (bits > FLINT_BITS - 3
+                                && dim < T->fmpz_mat_mul_strassen_cutoff))
         {
             fmpz_mat_mul_strassen(C, A, B);
         }
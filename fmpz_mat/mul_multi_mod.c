@@ -24,24 +24,128 @@
 ******************************************************************************/
 
 #include "fmpz_mat.h"
+#include "thread_pool.h"
+
+/*
+   The reductions and the reconstruction are split by rows of the matrix
+   between the tasks, and the products by prime and by rows of A and C.
+   Each task has its own temporaries for the comb.
+*/
+
+typedef struct
+{
+    fmpz_mat_struct * M;
+    nmod_mat_struct * mod;
+    slong num_primes;
+    const fmpz_comb_struct * comb;
+    slong start;
+    slong end;
+    int crt;
+} _multi_mod_arg_t;
+
+static void *
+_fmpz_mat_multi_mod_worker(void * arg_ptr)
+{
+    _multi_mod_arg_t * arg = (_multi_mod_arg_t *) arg_ptr;
+    fmpz_mat_struct * M = arg->M;
+    nmod_mat_struct * mod = arg->mod;
+    slong i, j, k, num_primes = arg->num_primes;
+    fmpz_comb_temp_t comb_temp;
+    mp_limb_t * residues;
+
+    residues = flint_malloc(sizeof(mp_limb_t) * num_primes);
+    fmpz_comb_temp_init(comb_temp, arg->comb);
+
+    for (i = arg->start; i < arg->end; i++)
+    {
+        for (j = 0; j < M->c; j++)
+        {
+            if (arg->crt)
+            {
+                for (k = 0; k < num_primes; k++)
+                    residues[k] = mod[k].rows[i][j];
+                fmpz_multi_CRT_ui(&M->rows[i][j], residues, arg->comb,
+                                  comb_temp, 1);
+            }
+            else
+            {
+                fmpz_multi_mod_ui(residues, &M->rows[i][j], arg->comb,
+                                  comb_temp);
+                for (k = 0; k < num_primes; k++)
+                    mod[k].rows[i][j] = residues[k];
+            }
+        }
+    }
+
+    fmpz_comb_temp_clear(comb_temp);
+    flint_free(residues);
+
+    return NULL;
+}
+
+typedef struct
+{
+    nmod_mat_t A;
+    nmod_mat_struct * B;
+    nmod_mat_t C;
+} _mul_arg_t;
+
+static void *
+_fmpz_mat_mul_multi_mod_worker(void * arg_ptr)
+{
+    _mul_arg_t * arg = (_mul_arg_t *) arg_ptr;
+
+    nmod_mat_mul(arg->C, arg->A, arg->B);
+
+    return NULL;
+}
+
+static void
+_multi_mod_args(_multi_mod_arg_t * args, slong num_tasks,
+    const fmpz_mat_t M, nmod_mat_struct * mod, slong num_primes,
+    const fmpz_comb_t comb, int crt)
+{
+    slong i;
+
+    for (i = 0; i < num_tasks; i++)
+    {
+        args[i].M = (fmpz_mat_struct *) M;
+        args[i].mod = mod;
+        args[i].num_primes = num_primes;
+        args[i].comb = comb;
+        args[i].start = (i * M->r) / num_tasks;
+        args[i].end = ((i + 1) * M->r) / num_tasks;
+        args[i].crt = crt;
+    }
+}
 
 void
 _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
     mp_bitcnt_t bits)
 {
-    slong i, j, k;
+    slong i, j, num_threads, num_tasks, num_blocks;
 
     fmpz_comb_t comb;
-    fmpz_comb_temp_t comb_temp;
 
     slong num_primes;
     mp_bitcnt_t primes_bits;
     mp_limb_t * primes;
-    mp_limb_t * residues;
 
-    nmod_mat_t * mod_C;
-    nmod_mat_t * mod_A;
-    nmod_mat_t * mod_B;
+    nmod_mat_struct * mod_C;
+    nmod_mat_struct * mod_A;
+    nmod_mat_struct * mod_B;
+
+    _multi_mod_arg_t * mod_args;
+    _mul_arg_t * mul_args;
+
+    if (C->r == 0 || C->c == 0)
+        return;
+
+    if (A->c == 0)
+    {
+        fmpz_mat_zero(C);
+        return;
+    }
 
     primes_bits = NMOD_MAT_OPTIMAL_MODULUS_BITS;
 
@@ -56,76 +160,90 @@ _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
         num_primes = (bits + primes_bits - 1) / primes_bits;
     }
 
+    num_threads = flint_get_num_threads();
+    if (A->r * A->c * B->c < FMPZ_MAT_MUL_MULTI_MOD_THREADED_CUTOFF)
+        num_threads = 1;
+
+    num_tasks = FLINT_MIN(num_threads, FLINT_MAX(A->r, B->r));
+
+    /* split the products by rows if there are fewer primes than threads */
+    num_blocks = (num_threads + num_primes - 1) / num_primes;
+    num_blocks = FLINT_MIN(num_blocks, A->r);
+
     /* Initialize */
     primes = flint_malloc(sizeof(mp_limb_t) * num_primes);
     primes[0] = n_nextprime(UWORD(1) << primes_bits, 0);
     for (i = 1; i < num_primes; i++)
         primes[i] = n_nextprime(primes[i-1], 0);
 
-    residues = flint_malloc(sizeof(mp_limb_t) * num_primes);
-
-    mod_A = flint_malloc(sizeof(nmod_mat_t) * num_primes);
-    mod_B = flint_malloc(sizeof(nmod_mat_t) * num_primes);
-    mod_C = flint_malloc(sizeof(nmod_mat_t) * num_primes);
+    mod_A = flint_malloc(sizeof(nmod_mat_struct) * num_primes);
+    mod_B = flint_malloc(sizeof(nmod_mat_struct) * num_primes);
+    mod_C = flint_malloc(sizeof(nmod_mat_struct) * num_primes);
     for (i = 0; i < num_primes; i++)
     {
-        nmod_mat_init(mod_A[i], A->r, A->c, primes[i]);
-        nmod_mat_init(mod_B[i], B->r, B->c, primes[i]);
-        nmod_mat_init(mod_C[i], C->r, C->c, primes[i]);
+        nmod_mat_init(mod_A + i, A->r, A->c, primes[i]);
+        nmod_mat_init(mod_B + i, B->r, B->c, primes[i]);
+        nmod_mat_init(mod_C + i, C->r, C->c, primes[i]);
     }
 
     fmpz_comb_init(comb, primes, num_primes);
-    fmpz_comb_temp_init(comb_temp, comb);
-
-    /* Calculate residues of A */
-    for (i = 0; i < A->r; i++)
-    {   for (j = 0; j < A->c; j++)
-        {   fmpz_multi_mod_ui(residues, &(A->rows[i][j]), comb, comb_temp);
-            for (k = 0; k < num_primes; k++)
-                mod_A[k]->rows[i][j] = residues[k];
-        }
-    }
 
-    /* Calculate residues of B */
-    for (i = 0; i < B->r; i++)
-    {   for (j = 0; j < B->c; j++)
-        {   fmpz_multi_mod_ui(residues, &B->rows[i][j], comb, comb_temp);
-            for (k = 0; k < num_primes; k++)
-                mod_B[k]->rows[i][j] = residues[k];
-        }
-    }
+    mod_args = flint_malloc(sizeof(_multi_mod_arg_t) * 2 * num_tasks);
+    mul_args = flint_malloc(sizeof(_mul_arg_t) * num_primes * num_blocks);
+
+    /* Calculate residues of A and B */
+    _multi_mod_args(mod_args, num_tasks, A, mod_A, num_primes, comb, 0);
+    _multi_mod_args(mod_args + num_tasks, num_tasks, B, mod_B,
+                    num_primes, comb, 0);
+    flint_parallel_do(_fmpz_mat_multi_mod_worker, mod_args,
+                      sizeof(_multi_mod_arg_t), 2 * num_tasks);
 
     /* Multiply */
     for (i = 0; i < num_primes; i++)
     {
-        nmod_mat_mul(mod_C[i], mod_A[i], mod_B[i]);
-    }
+        for (j = 0; j < num_blocks; j++)
+        {
+            _mul_arg_t * arg = mul_args + i * num_blocks + j;
+            slong r1 = (j * A->r) / num_blocks;
+            slong r2 = ((j + 1) * A->r) / num_blocks;
 
-    /* Chinese remaindering */
-    for (i = 0; i < C->r; i++)
-    {   for (j = 0; j < C->c; j++)
-        {   for (k = 0; k < num_primes; k++)
-                residues[k] = mod_C[k]->rows[i][j];
-            fmpz_multi_CRT_ui(&C->rows[i][j], residues, comb, comb_temp, 1);
+            nmod_mat_window_init(arg->A, mod_A + i, r1, 0, r2, A->c);
+            nmod_mat_window_init(arg->C, mod_C + i, r1, 0, r2, C->c);
+            arg->B = mod_B + i;
         }
     }
 
+    flint_parallel_do(_fmpz_mat_mul_multi_mod_worker, mul_args,
+                      sizeof(_mul_arg_t), num_primes * num_blocks);
+
+    for (i = 0; i < num_primes * num_blocks; i++)
+    {
+        nmod_mat_window_clear(mul_args[i].A);
+        nmod_mat_window_clear(mul_args[i].C);
+    }
+
+    /* Chinese remaindering */
+    num_tasks = FLINT_MIN(num_threads, C->r);
+    _multi_mod_args(mod_args, num_tasks, C, mod_C, num_primes, comb, 1);
+    flint_parallel_do(_fmpz_mat_multi_mod_worker, mod_args,
+                      sizeof(_multi_mod_arg_t), num_tasks);
+
     /* Cleanup */
     for (i = 0; i < num_primes; i++)
     {
-        nmod_mat_clear(mod_A[i]);
-        nmod_mat_clear(mod_B[i]);
-        nmod_mat_clear(mod_C[i]);
+        nmod_mat_clear(mod_A + i);
+        nmod_mat_clear(mod_B + i);
+        nmod_mat_clear(mod_C + i);
     }
 
     flint_free(mod_A);
     flint_free(mod_B);
     flint_free(mod_C);
+    flint_free(mod_args);
+    flint_free(mul_args);
 
-    fmpz_comb_temp_clear(comb_temp);
     fmpz_comb_clear(comb);
 
-    flint_free(residues);
     flint_free(primes);
 }
 
@@ -0,0 +1,80 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "fmpz_mat.h"
+#include "fmpz.h"
+#include "ulong_extras.h"
+
+/*
+    Times fmpz_mat_mul_multi_mod on square matrices with 200-bit entries
+    with 1, 2, 4 and 8 threads.
+*/
+
+int
+main(void)
+{
+    fmpz_mat_t A, B, C;
+    slong dim, num_threads;
+    timeit_t t0;
+
+    FLINT_TEST_INIT(state);
+
+    for (dim = 125; dim <= 500; dim *= 2)
+    {
+        fmpz_mat_init(A, dim, dim);
+        fmpz_mat_init(B, dim, dim);
+        fmpz_mat_init(C, dim, dim);
+
+        fmpz_mat_randbits(A, state, 200);
+        fmpz_mat_randbits(B, state, 200);
+
+        for (num_threads = 1; num_threads <= 8; num_threads *= 2)
+        {
+            flint_set_num_threads(num_threads);
+
+            timeit_start(t0);
+            fmpz_mat_mul_multi_mod(C, A, B);
+            timeit_stop(t0);
+
+            flint_printf("dim = %wd, threads = %wd: cpu = %wd ms, "
+                         "wall = %wd ms\n", dim, num_threads,
+                         t0->cpu, t0->wall);
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(C);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    return 0;
+}
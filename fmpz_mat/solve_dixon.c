@@ -23,16 +23,59 @@
 
 ******************************************************************************/
 
+#include "fmpz_vec.h"
 #include "fmpz_mat.h"
+#include "thread_pool.h"
+
+/*
+   The solution is lifted one p-adic digit y = A^(-1) d mod p at a time,
+   for all columns of B at once. The residual d = (d - A y) / p is never
+   formed as an integer matrix: it is kept modulo word primes q_j > p whose
+   product exceeds four times a bound for its entries, so that the update
+   is a multiplication by A mod q_j followed by a scaling by p^(-1) mod q_j.
+   The next right hand side d mod p is then obtained by mixed radix
+   conversion in word arithmetic.
+
+   Each run of DIXON_CHUNK digits is converted to integers by Horner's
+   rule, and the chunks are merged by binary splitting, with level l
+   holding 2^l chunks, so that forming the solution costs quasilinear
+   time in its size.
+
+   When there are enough columns, contiguous blocks of them are lifted
+   independently by different threads.
+*/
+
+#define DIXON_CHUNK 16
+#define DIXON_THREADED_MIN_COLS 16
+
+typedef struct
+{
+    fmpz_mat_struct * X;
+    const fmpz_mat_struct * B;
+    const nmod_mat_struct * Ainv;
+    const nmod_mat_struct * A_mod;
+    mp_srcptr primes;
+    mp_srcptr pinv;
+    mp_srcptr qinv;
+    mp_srcptr Qmodp;
+    const fmpz * ppow;
+    slong num_primes;
+    slong num_digits;
+    slong num_levels;
+    slong c0;
+    slong c1;
+    mp_limb_t p;
+}
+_dixon_arg_t;
 
 static mp_limb_t
 find_good_prime_and_invert(nmod_mat_t Ainv,
-                                const fmpz_mat_t A, const fmpz_t det_bound)
+                const fmpz_mat_t A, const fmpz_t det_bound, slong bits)
 {
     mp_limb_t p;
     fmpz_t tested;
 
-    p = UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS;
+    p = UWORD(1) << bits;
     fmpz_init(tested);
     fmpz_one(tested);
 
@@ -55,37 +98,47 @@ find_good_prime_and_invert(nmod_mat_t Ainv,
     return p;
 }
 
-/* We need to perform several matrix-vector products Ay, and speed them
-   up by using modular multiplication (this is only faster if we
-   precompute the modular matrices). Note: we assume that all
-   primes are >= p. This allows reusing y_mod as the right-hand
-   side without reducing it. */
-
-#define USE_SLOW_MULTIPLICATION 0
-
-mp_limb_t * get_crt_primes(slong * num_primes, const fmpz_mat_t A, mp_limb_t p)
+/* Sets bound to four times a bound for the entries of all residuals,
+   |d| <= max|B| + 2 n max|A|. */
+static void
+_dixon_residual_bound(fmpz_t bound, const fmpz_mat_t A, const fmpz_mat_t B)
 {
-    fmpz_t bound, prod;
-    mp_limb_t * primes;
+    fmpz_t t;
     slong i, j;
 
-    fmpz_init(bound);
-    fmpz_init(prod);
+    fmpz_init(t);
+    fmpz_zero(bound);
 
     for (i = 0; i < A->r; i++)
         for (j = 0; j < A->c; j++)
             if (fmpz_cmpabs(bound, fmpz_mat_entry(A, i, j)) < 0)
                 fmpz_abs(bound, fmpz_mat_entry(A, i, j));
 
-    fmpz_mul_ui(bound, bound, p - UWORD(1));
-    fmpz_mul_ui(bound, bound, A->r);
-    fmpz_mul_ui(bound, bound, UWORD(2));  /* signs */
+    for (i = 0; i < B->r; i++)
+        for (j = 0; j < B->c; j++)
+            if (fmpz_cmpabs(t, fmpz_mat_entry(B, i, j)) < 0)
+                fmpz_abs(t, fmpz_mat_entry(B, i, j));
+
+    fmpz_mul_ui(bound, bound, 2 * A->r);
+    fmpz_add(bound, bound, t);
+    fmpz_mul_2exp(bound, bound, 2);
+
+    fmpz_clear(t);
+}
+
+/* Primes q_j > p whose product exceeds the given bound. */
+static mp_limb_t *
+_dixon_residual_primes(slong * num_primes, const fmpz_t bound, mp_limb_t p)
+{
+    fmpz_t prod;
+    mp_limb_t * primes;
+
+    fmpz_init(prod);
 
     primes = flint_malloc(sizeof(mp_limb_t) * (fmpz_bits(bound) /
                                             (FLINT_BIT_COUNT(p) - 1) + 2));
-    primes[0] = p;
-    fmpz_set_ui(prod, p);
-    *num_primes = 1;
+    fmpz_one(prod);
+    *num_primes = 0;
 
     while (fmpz_cmp(prod, bound) <= 0)
     {
@@ -94,38 +147,293 @@ mp_limb_t * get_crt_primes(slong * num_primes, const fmpz_mat_t A, mp_limb_t p)
         fmpz_mul_ui(prod, prod, p);
     }
 
-    fmpz_clear(bound);
     fmpz_clear(prod);
 
     return primes;
 }
 
+/* Sets dp to the residual given by its images d[j] modulo the primes,
+   reduced modulo p. The entries are signed and less than a quarter of
+   the product of the primes in absolute value, so the sign can be read
+   from the leading mixed radix digit. The mixed radix digits c[j] are
+   computed a row at a time with vector operations; c[0] is not used
+   since it equals d[0]. */
+static void
+_dixon_residual_mod_p(nmod_mat_t dp, const nmod_mat_struct * d,
+    nmod_mat_struct * c, mp_srcptr primes, mp_srcptr qinv,
+    mp_srcptr Qmodp, slong num_primes, mp_ptr tmp)
+{
+    nmod_t mod = dp->mod, qmod;
+    mp_limb_t half;
+    slong i, j, r, e, cols = dp->c;
+
+    for (j = 1; j < num_primes; j++)
+    {
+        nmod_init(&qmod, primes[j]);
+
+        for (r = 0; r < dp->r; r++)
+        {
+            mp_ptr t = c[j].rows[r];
+
+            _nmod_vec_set(t, d[j].rows[r], cols);
+
+            for (i = 0; i < j; i++)
+            {
+                _nmod_vec_sub(t, t, (i == 0) ? d[0].rows[r] : c[i].rows[r],
+                                                                cols, qmod);
+                _nmod_vec_scalar_mul_nmod(t, t, cols,
+                                            qinv[i * num_primes + j], qmod);
+            }
+        }
+    }
+
+    half = primes[num_primes - 1] / 2;
+
+    for (r = 0; r < dp->r; r++)
+    {
+        mp_ptr s = dp->rows[r];
+        mp_srcptr top;
+
+        _nmod_vec_reduce(s, d[0].rows[r], cols, mod);
+
+        for (j = 1; j < num_primes; j++)
+        {
+            _nmod_vec_reduce(tmp, c[j].rows[r], cols, mod);
+            _nmod_vec_scalar_addmul_nmod(s, tmp, cols, Qmodp[j], mod);
+        }
+
+        top = (num_primes == 1) ? d[0].rows[r] : c[num_primes - 1].rows[r];
+
+        for (e = 0; e < cols; e++)
+            if (top[e] >= half)
+                s[e] = nmod_sub(s[e], Qmodp[num_primes], mod);
+    }
+}
+
+/* Sets x to the chunk of digits y[0] + y[1] p + ... + y[len-1] p^(len-1),
+   evaluated by Horner's rule on limb arrays, two digits at a time if
+   p^2 fits in a limb. */
+static void
+_dixon_chunk_to_fmpz_mat(fmpz_mat_t x, const nmod_mat_struct * y,
+                                                    slong len, mp_limb_t p)
+{
+    mp_limb_t t[DIXON_CHUNK + 1];
+    mp_limb_t m, c, u, v;
+    slong i, j, k, sz;
+    int pairs;
+
+    pairs = (p < (UWORD(1) << (FLINT_BITS / 2)));
+    m = pairs ? p * p : p;
+
+    for (i = 0; i < x->r; i++)
+    {
+        for (j = 0; j < x->c; j++)
+        {
+            fmpz * e = fmpz_mat_entry(x, i, j);
+
+            sz = 0;
+            k = len - 1;
+
+            if (pairs && len % 2 == 0)
+            {
+                u = nmod_mat_entry(y + k, i, j) * p
+                    + nmod_mat_entry(y + k - 1, i, j);
+                k -= 2;
+            }
+            else
+                u = nmod_mat_entry(y + k--, i, j);
+
+            if (u != 0)
+                t[sz++] = u;
+
+            for ( ; k >= 0; k -= (pairs ? 2 : 1))
+            {
+                if (pairs)
+                    v = nmod_mat_entry(y + k, i, j) * p
+                        + nmod_mat_entry(y + k - 1, i, j);
+                else
+                    v = nmod_mat_entry(y + k, i, j);
+
+                if (sz != 0)
+                {
+                    c = mpn_mul_1(t, t, sz, m);
+                    if (c != 0)
+                        t[sz++] = c;
+                    c = mpn_add_1(t, t, sz, v);
+                    if (c != 0)
+                        t[sz++] = c;
+                }
+                else if (v != 0)
+                    t[sz++] = v;
+            }
+
+            if (sz <= 1)
+                fmpz_set_ui(e, sz ? t[0] : UWORD(0));
+            else
+            {
+                __mpz_struct * z = _fmpz_promote(e);
+                if (z->_mp_alloc < sz)
+                    _mpz_realloc(z, sz);
+                flint_mpn_copyi(z->_mp_d, t, sz);
+                z->_mp_size = sz;
+            }
+        }
+    }
+}
+
+static void *
+_dixon_worker(void * arg_ptr)
+{
+    _dixon_arg_t arg = *((_dixon_arg_t *) arg_ptr);
+    fmpz_mat_t Xw, Bw, cur;
+    fmpz_mat_struct * level;
+    int * occupied;
+    nmod_mat_struct * d;
+    nmod_mat_struct * c;
+    nmod_mat_struct * y;
+    nmod_mat_t dp;
+    mp_ptr tmp;
+    mp_limb_t p = arg.p;
+    slong i, j, l, n, cols, len;
+
+    n = arg.B->r;
+    cols = arg.c1 - arg.c0;
+
+    fmpz_mat_window_init(Xw, arg.X, 0, arg.c0, n, arg.c1);
+    fmpz_mat_window_init(Bw, arg.B, 0, arg.c0, n, arg.c1);
+
+    d = flint_malloc(sizeof(nmod_mat_struct) * arg.num_primes);
+    c = flint_malloc(sizeof(nmod_mat_struct) * arg.num_primes);
+    tmp = _nmod_vec_init(cols);
+    y = flint_malloc(sizeof(nmod_mat_struct) * DIXON_CHUNK);
+    level = flint_malloc(sizeof(fmpz_mat_struct) * arg.num_levels);
+    occupied = flint_calloc(arg.num_levels, sizeof(int));
+
+    nmod_mat_init(dp, n, cols, p);
+    fmpz_mat_get_nmod_mat(dp, Bw);
+
+    for (j = 0; j < arg.num_primes; j++)
+    {
+        nmod_mat_init(d + j, n, cols, arg.primes[j]);
+        fmpz_mat_get_nmod_mat(d + j, Bw);
+        if (j != 0)
+            nmod_mat_init(c + j, n, cols, arg.primes[j]);
+    }
+
+    for (i = 0; i < DIXON_CHUNK; i++)
+        nmod_mat_init(y + i, n, cols, p);
+
+    fmpz_mat_init(cur, n, cols);
+
+    for (i = 0; i < arg.num_digits; i++)
+    {
+        nmod_mat_struct * yi = y + (i % DIXON_CHUNK);
+
+        /* y = A^(-1) d mod p */
+        if (i != 0)
+            _dixon_residual_mod_p(dp, d, c, arg.primes, arg.qinv,
+                                            arg.Qmodp, arg.num_primes, tmp);
+        nmod_mat_mul(yi, arg.Ainv, dp);
+
+        /* d = (d - A y) / p, modulo each q_j > p so that y is reduced */
+        if (i + 1 < arg.num_digits)
+        {
+            for (j = 0; j < arg.num_primes; j++)
+            {
+                _nmod_mat_set_mod(yi, arg.primes[j]);
+                nmod_mat_submul(d + j, d + j, arg.A_mod + j, yi);
+                nmod_mat_scalar_mul(d + j, d + j, arg.pinv[j]);
+            }
+
+            _nmod_mat_set_mod(yi, p);
+        }
+
+        /* a full chunk is merged with the chunks before it */
+        if ((i + 1) % DIXON_CHUNK == 0)
+        {
+            _dixon_chunk_to_fmpz_mat(cur, y, DIXON_CHUNK, p);
+
+            for (l = 0; occupied[l]; l++)
+            {
+                fmpz_mat_scalar_addmul_fmpz(level + l, cur, arg.ppow + l);
+                fmpz_mat_swap(cur, level + l);
+                fmpz_mat_clear(level + l);
+                occupied[l] = 0;
+            }
+
+            fmpz_mat_init(level + l, n, cols);
+            fmpz_mat_swap(cur, level + l);
+            occupied[l] = 1;
+        }
+    }
+
+    /* x = level[L - 1] + p^(...) (... (level[0] + p^(...) partial)) */
+    len = arg.num_digits % DIXON_CHUNK;
+    if (len != 0)
+        _dixon_chunk_to_fmpz_mat(cur, y, len, p);
+    else
+        fmpz_mat_zero(cur);
+
+    for (l = 0; l < arg.num_levels; l++)
+    {
+        if (occupied[l])
+        {
+            fmpz_mat_scalar_addmul_fmpz(level + l, cur, arg.ppow + l);
+            fmpz_mat_swap(cur, level + l);
+            fmpz_mat_clear(level + l);
+        }
+    }
+
+    for (i = 0; i < n; i++)
+        for (j = 0; j < cols; j++)
+            fmpz_swap(fmpz_mat_entry(Xw, i, j), fmpz_mat_entry(cur, i, j));
+
+    fmpz_mat_clear(cur);
+
+    for (i = 0; i < DIXON_CHUNK; i++)
+        nmod_mat_clear(y + i);
+
+    for (j = 0; j < arg.num_primes; j++)
+    {
+        nmod_mat_clear(d + j);
+        if (j != 0)
+            nmod_mat_clear(c + j);
+    }
+
+    nmod_mat_clear(dp);
+
+    flint_free(occupied);
+    flint_free(level);
+    flint_free(y);
+    flint_free(d);
+    flint_free(c);
+    _nmod_vec_clear(tmp);
+
+    fmpz_mat_window_clear(Xw);
+    fmpz_mat_window_clear(Bw);
+
+    return NULL;
+}
 
 static void
 _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
                         const fmpz_mat_t A, const fmpz_mat_t B,
                     const nmod_mat_t Ainv, mp_limb_t p,
-                    const fmpz_t N, const fmpz_t D)
+                    const fmpz_t N, const fmpz_t D, const fmpz_t res_bound)
 {
-    fmpz_t bound, ppow;
-    fmpz_mat_t x, d, y, Ay;
-    fmpz_t prod;
-    mp_limb_t * crt_primes;
-    nmod_mat_t * A_mod;
-    nmod_mat_t Ay_mod, d_mod, y_mod;
-    slong i, n, cols, num_primes;
+    fmpz_t bound;
+    mp_limb_t * primes, * pinv, * qinv, * Qmodp;
+    nmod_mat_struct * A_mod;
+    fmpz * ppow;
+    _dixon_arg_t * args;
+    slong i, j, n, cols, num_primes, num_digits, num_levels;
+    slong num_threads, num_tasks;
+    nmod_t pmod;
 
     n = A->r;
     cols = B->c;
 
     fmpz_init(bound);
-    fmpz_init(ppow);
-    fmpz_init(prod);
-
-    fmpz_mat_init(x, n, cols);
-    fmpz_mat_init(y, n, cols);
-    fmpz_mat_init(Ay, n, cols);
-    fmpz_mat_init_set(d, B);
 
     /* Compute bound for the needed modulus. TODO: if one of N and D
        is much smaller than the other, we could use a tighter bound (i.e. 2ND).
@@ -138,83 +446,76 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
         fmpz_mul(bound, N, N);
     fmpz_mul_ui(bound, bound, UWORD(2));  /* signs */
 
-    crt_primes = get_crt_primes(&num_primes, A, p);
-    A_mod = flint_malloc(sizeof(nmod_mat_t) * num_primes);
-    for (i = 0; i < num_primes; i++)
+    /* the smallest number of digits with p^num_digits > bound */
+    fmpz_one(mod);
+    for (num_digits = 0; fmpz_cmp(mod, bound) <= 0; num_digits++)
+        fmpz_mul_ui(mod, mod, p);
+
+    num_levels = FLINT_BIT_COUNT(num_digits / DIXON_CHUNK) + 1;
+    ppow = _fmpz_vec_init(num_levels);
+    fmpz_set_ui(ppow + 0, p);
+    fmpz_pow_ui(ppow + 0, ppow + 0, DIXON_CHUNK);
+    for (i = 1; i < num_levels; i++)
+        fmpz_mul(ppow + i, ppow + i - 1, ppow + i - 1);
+
+    nmod_init(&pmod, p);
+    primes = _dixon_residual_primes(&num_primes, res_bound, p);
+    pinv = flint_malloc(sizeof(mp_limb_t) * num_primes);
+    qinv = flint_malloc(sizeof(mp_limb_t) * num_primes * num_primes);
+    Qmodp = flint_malloc(sizeof(mp_limb_t) * (num_primes + 1));
+    A_mod = flint_malloc(sizeof(nmod_mat_struct) * num_primes);
+
+    Qmodp[0] = UWORD(1);
+    for (j = 0; j < num_primes; j++)
     {
-        nmod_mat_init(A_mod[i], n, n, crt_primes[i]);
-        fmpz_mat_get_nmod_mat(A_mod[i], A);
+        pinv[j] = n_invmod(p, primes[j]);
+        for (i = 0; i < j; i++)
+            qinv[i * num_primes + j] = n_invmod(primes[i], primes[j]);
+        Qmodp[j + 1] = n_mulmod2_preinv(Qmodp[j], primes[j],
+                                                    pmod.n, pmod.ninv);
+
+        nmod_mat_init(A_mod + j, n, n, primes[j]);
+        fmpz_mat_get_nmod_mat(A_mod + j, A);
     }
 
-    nmod_mat_init(Ay_mod, n, cols, UWORD(1));
-    nmod_mat_init(d_mod, n, cols, p);
-    nmod_mat_init(y_mod, n, cols, p);
+    num_threads = flint_get_num_threads();
+    num_tasks = FLINT_MIN(num_threads, cols / DIXON_THREADED_MIN_COLS);
+    num_tasks = FLINT_MAX(num_tasks, 1);
+    args = flint_malloc(sizeof(_dixon_arg_t) * num_tasks);
 
-    fmpz_one(ppow);
-
-    while (fmpz_cmp(ppow, bound) <= 0)
+    for (i = 0; i < num_tasks; i++)
     {
-        /* y = A^(-1) * d  (mod p) */
-        fmpz_mat_get_nmod_mat(d_mod, d);
-        nmod_mat_mul(y_mod, Ainv, d_mod);
-
-        /* x = x + y * p^i    [= A^(-1) * b mod p^(i+1)] */
-        fmpz_mat_scalar_addmul_nmod_mat_fmpz(x, y_mod, ppow);
-
-        /* ppow = p^(i+1) */
-        fmpz_mul_ui(ppow, ppow, p);
-        if (fmpz_cmp(ppow, bound) > 0)
-            break;
-
-        /* d = (d - Ay) / p */
-#if USE_SLOW_MULTIPLICATION
-        fmpz_mat_set_nmod_mat_unsigned(y, y_mod);
-        fmpz_mat_mul(Ay, A, y);
-#else
-        for (i = 0; i < num_primes; i++)
-        {
-            _nmod_mat_set_mod(y_mod, crt_primes[i]);
-            _nmod_mat_set_mod(Ay_mod, crt_primes[i]);
-            nmod_mat_mul(Ay_mod, A_mod[i], y_mod);
-            if (i == 0)
-            {
-                fmpz_mat_set_nmod_mat(Ay, Ay_mod);
-                fmpz_set_ui(prod, crt_primes[0]);
-            }
-            else
-            {
-                fmpz_mat_CRT_ui(Ay, Ay, prod, Ay_mod, 1);
-                fmpz_mul_ui(prod, prod, crt_primes[i]);
-            }
-        }
-#endif
-
-        _nmod_mat_set_mod(y_mod, p);
-        fmpz_mat_sub(d, d, Ay);
-        fmpz_mat_scalar_divexact_ui(d, d, p);
+        args[i].X = X;
+        args[i].B = B;
+        args[i].Ainv = Ainv;
+        args[i].A_mod = A_mod;
+        args[i].primes = primes;
+        args[i].pinv = pinv;
+        args[i].qinv = qinv;
+        args[i].Qmodp = Qmodp;
+        args[i].ppow = ppow;
+        args[i].num_primes = num_primes;
+        args[i].num_digits = num_digits;
+        args[i].num_levels = num_levels;
+        args[i].c0 = (i * cols) / num_tasks;
+        args[i].c1 = ((i + 1) * cols) / num_tasks;
+        args[i].p = p;
     }
 
-    fmpz_set(mod, ppow);
-    fmpz_mat_set(X, x);
-
-    nmod_mat_clear(y_mod);
-    nmod_mat_clear(d_mod);
-    nmod_mat_clear(Ay_mod);
+    flint_parallel_do(_dixon_worker, args, sizeof(_dixon_arg_t), num_tasks);
 
-    for (i = 0; i < num_primes; i++)
-        nmod_mat_clear(A_mod[i]);
+    for (j = 0; j < num_primes; j++)
+        nmod_mat_clear(A_mod + j);
 
+    flint_free(args);
     flint_free(A_mod);
-    flint_free(crt_primes);
+    flint_free(Qmodp);
+    flint_free(qinv);
+    flint_free(pinv);
+    flint_free(primes);
+    _fmpz_vec_clear(ppow, num_levels);
 
     fmpz_clear(bound);
-    fmpz_clear(ppow);
-    fmpz_clear(prod);
-
-    fmpz_mat_clear(x);
-    fmpz_mat_clear(y);
-    fmpz_mat_clear(d);
-    fmpz_mat_clear(Ay);
 }
 
 int
@@ -222,8 +523,9 @@ fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
                         const fmpz_mat_t A, const fmpz_mat_t B)
 {
     nmod_mat_t Ainv;
-    fmpz_t N, D;
+    fmpz_t N, D, res_bound;
     mp_limb_t p;
+    slong bits;
 
     if (!fmpz_mat_is_square(A))
     {
@@ -236,16 +538,28 @@ fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
 
     fmpz_init(N);
     fmpz_init(D);
+    fmpz_init(res_bound);
     fmpz_mat_solve_bound(N, D, A, B);
+    _dixon_residual_bound(res_bound, A, B);
+
+    /* Primes small enough for double precision multiplication give the
+       most bits per unit of time, but only if a single one of them
+       suffices for the residual; otherwise the work of updating the
+       residual grows faster than the digits shrink. */
+    if (fmpz_bits(res_bound) < NMOD_MAT_MUL_DOUBLE_AUTO_BITS)
+        bits = NMOD_MAT_MUL_DOUBLE_AUTO_BITS - 1;
+    else
+        bits = NMOD_MAT_OPTIMAL_MODULUS_BITS;
 
     nmod_mat_init(Ainv, A->r, A->r, 1);
-    p = find_good_prime_and_invert(Ainv, A, D);
+    p = find_good_prime_and_invert(Ainv, A, D, bits);
     if (p != 0)
-        _fmpz_mat_solve_dixon(X, mod, A, B, Ainv, p, N, D);
+        _fmpz_mat_solve_dixon(X, mod, A, B, Ainv, p, N, D, res_bound);
 
     nmod_mat_clear(Ainv);
     fmpz_clear(N);
     fmpz_clear(D);
+    fmpz_clear(res_bound);
 
     return p != 0;
 }
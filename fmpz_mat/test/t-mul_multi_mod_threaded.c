@@ -0,0 +1,89 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    fmpz_mat_t A, B, C, D;
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_multi_mod_threaded....");
+    fflush(stdout);
+
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        slong m, n, k, num_threads;
+
+        m = n_randint(state, 80);
+        n = n_randint(state, 80);
+        k = n_randint(state, 80);
+
+        num_threads = 2 + n_randint(state, 4);
+        flint_set_num_threads(num_threads);
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(B, n, k);
+        fmpz_mat_init(C, m, k);
+        fmpz_mat_init(D, m, k);
+
+        fmpz_mat_randtest(A, state, n_randint(state, 400) + 1);
+        fmpz_mat_randtest(B, state, n_randint(state, 400) + 1);
+
+        /* Make sure noise in the output is ok */
+        fmpz_mat_randtest(D, state, n_randint(state, 200) + 1);
+
+        fmpz_mat_mul_classical_inline(C, A, B);
+        fmpz_mat_mul_multi_mod(D, A, B);
+
+        if (!fmpz_mat_equal(C, D))
+        {
+            flint_printf("FAIL: results not equal\n");
+            flint_printf("m = %wd, n = %wd, k = %wd, threads = %wd\n",
+                         m, n, k, num_threads);
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(C);
+        fmpz_mat_clear(D);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
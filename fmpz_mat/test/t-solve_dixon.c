@@ -50,6 +50,12 @@ main(void)
         m = n_randint(state, 20);
         n = n_randint(state, 20);
 
+        /* enough columns to be split between threads */
+        if (n_randint(state, 10) == 0)
+            n = n_randint(state, 80);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         fmpz_mat_init(A, m, m);
         fmpz_mat_init(B, m, n);
         fmpz_mat_init(Bm, m, n);
@@ -127,6 +133,8 @@ main(void)
         fmpz_clear(mod);
     }
 
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -34,13 +34,13 @@
 #undef ulong
 
 #include <gmp.h>
-#include <pthread.h>
 
 #define ulong mp_limb_t
 
 #include "flint.h"
 #include "fmpz_mod_poly.h"
 #include "ulong_extras.h"
+#include "thread_pool.h"
 
 int
 main(void)
@@ -59,13 +59,11 @@ main(void)
         fmpz_mat_t B, *C;
         slong j, num_threads;
         fmpz_mod_poly_matrix_precompute_arg_t * args1;
-        pthread_t *threads;
 
         flint_set_num_threads(1 + n_randint(state, 3));
 
         num_threads = flint_get_num_threads();
 
-        threads = flint_malloc(sizeof(pthread_t) * num_threads);
         tmp = flint_malloc(sizeof(fmpz_mod_poly_t) * num_threads);
 
         fmpz_init(p);
@@ -111,12 +109,10 @@ main(void)
             args1[j].poly1    = *tmp[j];
             args1[j].poly2    = *c;
             args1[j].poly2inv = *cinv;
-
-            pthread_create(&threads[j], NULL,
-                           _fmpz_mod_poly_precompute_matrix_worker, &args1[j]);
         }
-        for (j = 0; j < num_threads; j++)
-            pthread_join(threads[j], NULL);
+
+        flint_parallel_do(_fmpz_mod_poly_precompute_matrix_worker,
+                          args1, sizeof(fmpz_mod_poly_matrix_precompute_arg_t), num_threads);
 
         for (j = 0; j < num_threads; j++)
         {
@@ -146,7 +142,6 @@ main(void)
         flint_free(C);
         flint_free(tmp);
         flint_free(args1);
-        flint_free(threads);
     }
 
     /* check composition */
@@ -157,13 +152,11 @@ main(void)
         fmpz_mat_t B;
         slong j, num_threads;
         fmpz_mod_poly_compose_mod_precomp_preinv_arg_t * args1;
-        pthread_t *threads;
 
         flint_set_num_threads(1 + n_randint(state, 3));
 
         num_threads = flint_get_num_threads();
 
-        threads = flint_malloc(sizeof(pthread_t) * num_threads);
         res = flint_malloc(sizeof(fmpz_mod_poly_t) * num_threads);
 
         fmpz_init(p);
@@ -205,15 +198,12 @@ main(void)
             args1[j].poly1    = *a;
             args1[j].poly3    = *c;
             args1[j].poly3inv = *cinv;
-
-            pthread_create(&threads[j], NULL,
-                           _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker, &args1[j]);
         }
+
+        flint_parallel_do(_fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker,
+                          args1, sizeof(fmpz_mod_poly_compose_mod_precomp_preinv_arg_t), num_threads);
         for (j = 0; j < num_threads; j++)
-        {
-            pthread_join(threads[j], NULL);
             _fmpz_mod_poly_normalise(res[j]);
-        }
 
         for (j = 0; j < num_threads; j++)
         {
@@ -240,7 +230,6 @@ main(void)
             fmpz_mod_poly_clear(res[j]);
         flint_free(res);
         flint_free(args1);
-        flint_free(threads);
     }
 
     FLINT_TEST_CLEANUP(state);
@@ -28,7 +28,6 @@
 #define ulong ulongxx/* interferes with system includes */
 
 #include <math.h>
-#include <pthread.h>
 
 #undef ulong
 
@@ -37,6 +36,7 @@
 #define ulong mp_limb_t
 
 #include "fmpz_mod_poly.h"
+#include "thread_pool.h"
 
 void *
 _fmpz_mod_poly_interval_poly_worker(void* arg_ptr)
@@ -74,7 +74,6 @@ _fmpz_mod_poly_interval_poly_worker(void* arg_ptr)
 
     _fmpz_vec_clear(tmp, arg.v.length - 1);
     fmpz_clear(invV);
-    flint_cleanup();
     return NULL;
 }
 
@@ -89,7 +88,6 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
     fmpz_t p;
     fmpz_mat_t * HH;
     double beta;
-    pthread_t *threads;
     fmpz_mod_poly_matrix_precompute_arg_t * args1;
     fmpz_mod_poly_compose_mod_precomp_preinv_arg_t * args2;
     fmpz_mod_poly_interval_poly_arg_t * args3;
@@ -139,14 +137,13 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
     for (i = 0; i < num_threads; i++)
         fmpz_mod_poly_init(scratch[i], p);
 
-    HH      = flint_malloc(sizeof(fmpz_mat_t) * (num_threads + 1));
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
-    args1   = flint_malloc(num_threads *
-                           sizeof(fmpz_mod_poly_matrix_precompute_arg_t));
-    args2   = flint_malloc(num_threads *
-                        sizeof(fmpz_mod_poly_compose_mod_precomp_preinv_arg_t));
-    args3   = flint_malloc(num_threads *
-                           sizeof(fmpz_mod_poly_interval_poly_arg_t));
+    HH    = flint_malloc(sizeof(fmpz_mat_t) * (num_threads + 1));
+    args1 = flint_malloc(num_threads *
+                         sizeof(fmpz_mod_poly_matrix_precompute_arg_t));
+    args2 = flint_malloc(num_threads *
+                      sizeof(fmpz_mod_poly_compose_mod_precomp_preinv_arg_t));
+    args3 = flint_malloc(num_threads *
+                         sizeof(fmpz_mod_poly_interval_poly_arg_t));
 
     fmpz_mod_poly_reverse(vinv, v, v->length);
     fmpz_mod_poly_inv_series_newton(vinv, vinv, v->length);
@@ -261,12 +258,11 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
                 args1[i].poly1    = *scratch[i];
                 args1[i].poly2    = *v;
                 args1[i].poly2inv = *vinv;
-
-                pthread_create(&threads[i], NULL,
-                            _fmpz_mod_poly_precompute_matrix_worker, &args1[i]);
             }
-            for (i = 1; i < c1; i++)
-                pthread_join(threads[i], NULL);
+
+            flint_parallel_do(_fmpz_mod_poly_precompute_matrix_worker,
+                args1 + 1, sizeof(fmpz_mod_poly_matrix_precompute_arg_t),
+                c1 - 1);
 
             fmpz_mod_poly_rem(tmp, H[num_threads - 1], v);
             for (i = 0; i < c1; i++)
@@ -278,15 +274,15 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
                 args2[i].poly1    = *tmp;
                 args2[i].poly3    = *v;
                 args2[i].poly3inv = *vinv;
-
-                pthread_create(&threads[i], NULL,
-        _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker, &args2[i]);
             }
+
+            flint_parallel_do(
+                _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker,
+                args2,
+                sizeof(fmpz_mod_poly_compose_mod_precomp_preinv_arg_t), c1);
+
             for (i = 0; i < c1; i++)
-            {
-                pthread_join(threads[i], NULL);
                 _fmpz_mod_poly_normalise(H[num_threads + i]);
-            }
 
             for (i = 0; i < c1; i++)
             {
@@ -299,16 +295,13 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
                 args3[i].res  = *I[num_threads + i];
                 args3[i].v    = *v;
                 args3[i].vinv = *vinv;
-
-                pthread_create(&threads[i], NULL,
-                               _fmpz_mod_poly_interval_poly_worker, &args3[i]);
             }
 
+            flint_parallel_do(_fmpz_mod_poly_interval_poly_worker,
+                args3, sizeof(fmpz_mod_poly_interval_poly_arg_t), c1);
+
             for (i = 0; i < c1; i++)
-            {
-                pthread_join(threads[i], NULL);
                 _fmpz_mod_poly_normalise(I[num_threads + i]);
-            }
 
             fmpz_mod_poly_set_ui(II, UWORD(1));
 
@@ -365,15 +358,15 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
                 args2[i].poly1    = *tmp;
                 args2[i].poly3    = *v;
                 args2[i].poly3inv = *vinv;
-
-                pthread_create(&threads[i], NULL,
-        _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker, &args2[i]);
             }
+
+            flint_parallel_do(
+                _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker,
+                args2,
+                sizeof(fmpz_mod_poly_compose_mod_precomp_preinv_arg_t), c2);
+
             for (i = 0; i < c2; i++)
-            {
-                pthread_join(threads[i], NULL);
                 _fmpz_mod_poly_normalise(H[j * num_threads + i]);
-            }
 
             for (i = 0; i < c2; i++)
             {
@@ -387,16 +380,13 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
                 args3[i].res  = *I[j * num_threads + i];
                 args3[i].v    = *v;
                 args3[i].vinv = *vinv;
-
-                pthread_create(&threads[i], NULL,
-                               _fmpz_mod_poly_interval_poly_worker, &args3[i]);
             }
 
+            flint_parallel_do(_fmpz_mod_poly_interval_poly_worker,
+                args3, sizeof(fmpz_mod_poly_interval_poly_arg_t), c2);
+
             for (i = 0; i < c2; i++)
-            {
-                pthread_join(threads[i], NULL);
                 _fmpz_mod_poly_normalise(I[j * num_threads + i]);
-            }
 
             fmpz_mod_poly_set_ui(II, UWORD(1));
 
@@ -489,5 +479,4 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
     flint_free(args1);
     flint_free(args2);
     flint_free(args3);
-    flint_free(threads);
 }
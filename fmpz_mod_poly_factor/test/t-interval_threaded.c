@@ -32,13 +32,13 @@
 #undef ulong
 
 #include <gmp.h>
-#include <pthread.h>
 
 #define ulong mp_limb_t
 
 #include "flint.h"
 #include "fmpz_mod_poly.h"
 #include "ulong_extras.h"
+#include "thread_pool.h"
 
 int
 main(void)
@@ -56,14 +56,12 @@ main(void)
         fmpz_t p;
         slong j, num_threads, l;
         fmpz_mod_poly_interval_poly_arg_t * args1;
-        pthread_t *threads;
 
         flint_set_num_threads(1 + n_randint(state, 3));
 
         num_threads = flint_get_num_threads();
 
         l = n_randint(state, 20) + 1;
-        threads = flint_malloc(sizeof(pthread_t) * num_threads);
         e = flint_malloc(sizeof(fmpz_mod_poly_struct) * num_threads);
         tmp = flint_malloc(sizeof(fmpz_mod_poly_struct) * l);
         args1 = flint_malloc(num_threads *
@@ -116,11 +114,10 @@ main(void)
             args1[j].v = *c;
             args1[j].vinv = *cinv;
             args1[j].m = l;
-
-            pthread_create(&threads[j], NULL, _fmpz_mod_poly_interval_poly_worker, &args1[j]);
         }
-        for (j = 0; j < num_threads; j++)
-            pthread_join(threads[j], NULL);
+
+        flint_parallel_do(_fmpz_mod_poly_interval_poly_worker,
+                          args1, sizeof(fmpz_mod_poly_interval_poly_arg_t), num_threads);
         for (j = 0; j < num_threads; j++)
             _fmpz_mod_poly_normalise(e[j]);
 
@@ -150,7 +147,6 @@ main(void)
         flint_free(e);
         flint_free(tmp);
         flint_free(args1);
-        flint_free(threads);
     }
 
     FLINT_TEST_CLEANUP(state);
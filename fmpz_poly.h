@@ -55,6 +55,10 @@
 
 #define FMPZ_POLY_INV_NEWTON_CUTOFF 32
 
+/* defaults for the tuning parameters, see flint_get_tuning() */
+#define FMPZ_POLY_MUL_KS_LIMBS 8        /* total limbs: KS -> SS */
+#define FMPZ_POLY_MUL_KS_LEN_RATIO 4    /* KS if len1 + len2 > ratio * bits */
+
 /*  Type definitions *********************************************************/
 
 typedef struct
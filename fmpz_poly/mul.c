@@ -113,6 +113,7 @@ _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
 {
     mp_size_t limbs1, limbs2;
     slong bits1, bits2, rbits;
+    const flint_tuning_struct * T;
 
     if (len2 == 1)
     {
@@ -157,13 +158,16 @@ _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
     limbs1 = (bits1 + FLINT_BITS - 1) / FLINT_BITS;
     limbs2 = (bits2 + FLINT_BITS - 1) / FLINT_BITS;
 
+    T = flint_get_tuning();
+
     if (len1 < 16 && (limbs1 > 12 || limbs2 > 12))
         _fmpz_poly_mul_karatsuba(res, poly1, len1, poly2, len2);
-    else if (limbs1 + limbs2 <= 8)
+    else if (limbs1 + limbs2 <= T->fmpz_poly_mul_KS_limbs)
         _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2);
     else if ((limbs1+limbs2)/2048 > len1 + len2)
         _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2);
-    else if ((limbs1 + limbs2)*FLINT_BITS*4 < len1 + len2)
+    else if ((limbs1 + limbs2)*FLINT_BITS*T->fmpz_poly_mul_KS_len_ratio
+                                                            < len1 + len2)
        _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2);
     else
        _fmpz_poly_mul_SS(res, poly1, len1, poly2, len2);
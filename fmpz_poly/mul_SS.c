@@ -25,7 +25,6 @@
 
 #include "fmpz_poly.h"
 #include "fft.h"
-#include "fft_tuning.h"
 
 void _fmpz_poly_mul_SS(fmpz *output, const fmpz *input1, slong len1, 
                        const fmpz *input2, slong len2)
@@ -26,7 +26,6 @@
 #include <stdlib.h>
 #include "fmpz_poly.h"
 #include "fft.h"
-#include "fft_tuning.h"
 
 void _fmpz_poly_mullow_SS(fmpz * output, const fmpz * input1, slong len1, 
                const fmpz * input2, slong len2, slong trunc)
@@ -56,7 +55,7 @@ void _fmpz_poly_mullow_SS(fmpz * output, const fmpz * input1, slong len1,
     output_bits = (((output_bits - 1) >> (loglen - 2)) + 1) << (loglen - 2);
 
     limbs = (output_bits - 1) / FLINT_BITS + 1; /* initial size of FFT coeffs */
-    if (limbs > FFT_MULMOD_2EXPP1_CUTOFF) /* can't be worse than next power of 2 limbs */
+    if (limbs > flint_get_tuning()->fft_mulmod_2expp1_cutoff) /* can't be worse than next power of 2 limbs */
         limbs = (WORD(1) << FLINT_CLOG2(limbs));
     size = limbs + 1;
 
@@ -23,11 +23,11 @@
 
 ******************************************************************************/
 
-#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_poly.h"
+#include "thread_pool.h"
 
 typedef struct
 {
@@ -75,7 +75,6 @@ _fmpz_vec_multi_mod_ui_worker(void * arg_ptr)
     fmpz_comb_clear(comb);
     fmpz_comb_temp_clear(comb_temp);
 
-    flint_cleanup();
     return NULL;
 }
 
@@ -83,12 +82,10 @@ void
 _fmpz_vec_multi_mod_ui_threaded(mp_ptr * residues, fmpz * vec, slong len,
     mp_srcptr primes, slong num_primes, int crt)
 {
-    pthread_t * threads;
     mod_ui_arg_t * args;
     slong i, num_threads;
 
     num_threads = flint_get_num_threads();
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
     args = flint_malloc(sizeof(mod_ui_arg_t) * num_threads);
 
     for (i = 0; i < num_threads; i++)
@@ -100,15 +97,11 @@ _fmpz_vec_multi_mod_ui_threaded(mp_ptr * residues, fmpz * vec, slong len,
         args[i].primes = (mp_ptr) primes;
         args[i].num_primes = num_primes;
         args[i].crt = crt;
-
-        pthread_create(&threads[i], NULL,
-            _fmpz_vec_multi_mod_ui_worker, &args[i]);
     }
 
-    for (i = 0; i < num_threads; i++)
-        pthread_join(threads[i], NULL);
+    flint_parallel_do(_fmpz_vec_multi_mod_ui_worker,
+                                  args, sizeof(mod_ui_arg_t), num_threads);
 
-    flint_free(threads);
     flint_free(args);
 }
 
@@ -141,7 +134,6 @@ _fmpz_poly_multi_taylor_shift_worker(void * arg_ptr)
         _nmod_poly_taylor_shift(arg.residues[i], cm, arg.len, mod);
     }
 
-    flint_cleanup();
     return NULL;
 }
 
@@ -149,32 +141,27 @@ void
 _fmpz_poly_multi_taylor_shift_threaded(mp_ptr * residues, slong len,
     const fmpz_t c, mp_srcptr primes, slong num_primes)
 {
-    pthread_t * threads;
     taylor_shift_arg_t * args;
-    slong i, num_threads;
+    slong i;
 
-    num_threads = flint_get_num_threads();
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
-    args = flint_malloc(sizeof(taylor_shift_arg_t) * num_threads);
+    /* one task per prime, so that threads which finish early pick up
+       the remaining primes */
+    args = flint_malloc(sizeof(taylor_shift_arg_t) * num_primes);
 
-    for (i = 0; i < num_threads; i++)
+    for (i = 0; i < num_primes; i++)
     {
         args[i].residues = residues;
         args[i].len = len;
-        args[i].p0 = (num_primes * i) / num_threads;
-        args[i].p1 = (num_primes * (i + 1)) / num_threads;
+        args[i].p0 = i;
+        args[i].p1 = i + 1;
         args[i].primes = (mp_ptr) primes;
         args[i].num_primes = num_primes;
         args[i].c = (fmpz *) c;
-
-        pthread_create(&threads[i], NULL,
-            _fmpz_poly_multi_taylor_shift_worker, &args[i]);
     }
 
-    for (i = 0; i < num_threads; i++)
-        pthread_join(threads[i], NULL);
+    flint_parallel_do(_fmpz_poly_multi_taylor_shift_worker,
+                              args, sizeof(taylor_shift_arg_t), num_primes);
 
-    flint_free(threads);
     flint_free(args);
 }
 
@@ -0,0 +1,196 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#ifndef GF2_MAT_H
+#define GF2_MAT_H
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "longlong.h"
+#include "nmod_mat.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Dense matrices over GF(2), packed FLINT_BITS entries to a limb. Entry
+    (i, j) is bit j % FLINT_BITS of rows[i][j / FLINT_BITS]. The unused
+    high bits of the last limb of each row are always zero.
+*/
+typedef struct
+{
+    mp_limb_t * entries;
+    slong r;
+    slong c;
+    mp_limb_t ** rows;
+}
+gf2_mat_struct;
+
+typedef gf2_mat_struct gf2_mat_t[1];
+
+#define gf2_mat_nrows(mat) ((mat)->r)
+#define gf2_mat_ncols(mat) ((mat)->c)
+
+/* number of limbs holding a row of c entries */
+#define GF2_MAT_LIMBS(c) (((c) + FLINT_BITS - 1) / FLINT_BITS)
+
+/* the bits in use in the last limb of a row of c entries */
+#define GF2_MAT_LAST_MASK(c) (((c) % FLINT_BITS == 0) ? ~UWORD(0) : \
+                              (UWORD(1) << ((c) % FLINT_BITS)) - 1)
+
+#define gf2_mat_entry(mat, i, j) \
+    (((mat)->rows[i][(j) / FLINT_BITS] >> ((j) % FLINT_BITS)) & UWORD(1))
+
+static __inline__
+void gf2_mat_set_entry(gf2_mat_t mat, slong i, slong j, mp_limb_t x)
+{
+    mp_limb_t bit = UWORD(1) << (j % FLINT_BITS);
+
+    if (x & 1)
+        mat->rows[i][j / FLINT_BITS] |= bit;
+    else
+        mat->rows[i][j / FLINT_BITS] &= ~bit;
+}
+
+/* returns the len <= FLINT_BITS bits of row starting at column pos */
+static __inline__
+mp_limb_t _gf2_mat_row_bits(const mp_limb_t * row, slong pos, slong len)
+{
+    slong w = pos / FLINT_BITS, s = pos % FLINT_BITS;
+    mp_limb_t x = row[w] >> s;
+
+    if (s + len > FLINT_BITS)
+        x |= row[w + 1] << (FLINT_BITS - s);
+
+    return (len == FLINT_BITS) ? x : x & ((UWORD(1) << len) - 1);
+}
+
+/* number of columns handled by one Four Russians table */
+#define GF2_MAT_M4RI_K 8
+
+/* number of tables used together in a pass of M4RM multiplication */
+#define GF2_MAT_M4RM_TABLES 4
+
+/* limbs of a row of B handled at once by M4RM, to keep tables in cache */
+#define GF2_MAT_M4RM_CHUNK 64
+
+/* rows of A from which multiplication uses M4RM */
+#define GF2_MAT_MUL_M4RM_CUTOFF 64
+
+/* dimensions from which multiplication uses Strassen-Winograd */
+#define GF2_MAT_MUL_STRASSEN_CUTOFF 4096
+
+/* products and eliminations of cost at least this many limb operations,
+   measured as rows times columns times limbs per row, use threads */
+#define GF2_MAT_THREADED_CUTOFF 1048576
+
+/* vector lengths from which the XOR kernel uses SIMD instructions */
+#define GF2_VEC_SIMD_CUTOFF 8
+
+/* Vector kernels ************************************************************/
+
+FLINT_DLL void _gf2_vec_add(mp_ptr res, mp_srcptr vec1, mp_srcptr vec2,
+                                                                  slong len);
+
+FLINT_DLL void _gf2_vec_add_avx2(mp_ptr res, mp_srcptr vec1, mp_srcptr vec2,
+                                                                  slong len);
+
+FLINT_DLL void _gf2_vec_add_avx512(mp_ptr res, mp_srcptr vec1,
+                                                  mp_srcptr vec2, slong len);
+
+/* Memory management *********************************************************/
+
+FLINT_DLL void gf2_mat_init(gf2_mat_t mat, slong rows, slong cols);
+FLINT_DLL void gf2_mat_init_set(gf2_mat_t mat, const gf2_mat_t src);
+FLINT_DLL void gf2_mat_clear(gf2_mat_t mat);
+FLINT_DLL void gf2_mat_swap(gf2_mat_t mat1, gf2_mat_t mat2);
+
+/* Windows *******************************************************************/
+
+FLINT_DLL void gf2_mat_window_init(gf2_mat_t window, const gf2_mat_t mat,
+                                     slong r1, slong c1, slong r2, slong c2);
+FLINT_DLL void gf2_mat_window_clear(gf2_mat_t window);
+
+/* Basic properties and manipulation *****************************************/
+
+FLINT_DLL void gf2_mat_set(gf2_mat_t B, const gf2_mat_t A);
+FLINT_DLL void gf2_mat_zero(gf2_mat_t mat);
+FLINT_DLL void gf2_mat_one(gf2_mat_t mat);
+FLINT_DLL int gf2_mat_equal(const gf2_mat_t A, const gf2_mat_t B);
+FLINT_DLL int gf2_mat_is_zero(const gf2_mat_t mat);
+FLINT_DLL void gf2_mat_transpose(gf2_mat_t B, const gf2_mat_t A);
+
+/* Random generation *********************************************************/
+
+FLINT_DLL void gf2_mat_randtest(gf2_mat_t mat, flint_rand_t state);
+
+/* Conversion ****************************************************************/
+
+FLINT_DLL void gf2_mat_set_nmod_mat(gf2_mat_t B, const nmod_mat_t A);
+FLINT_DLL void gf2_mat_get_nmod_mat(nmod_mat_t B, const gf2_mat_t A);
+
+/* Input and output **********************************************************/
+
+FLINT_DLL void gf2_mat_print_pretty(const gf2_mat_t mat);
+
+/* Arithmetic ****************************************************************/
+
+FLINT_DLL void gf2_mat_add(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_mul(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_mul_classical(gf2_mat_t C, const gf2_mat_t A,
+                                                         const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_mul_m4rm(gf2_mat_t C, const gf2_mat_t A,
+                                                         const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_mul_strassen(gf2_mat_t C, const gf2_mat_t A,
+                                                         const gf2_mat_t B);
+
+/* Elimination ***************************************************************/
+
+FLINT_DLL slong _gf2_mat_echelon_m4ri(gf2_mat_t A, slong * pivots,
+                                                              int reduced);
+
+FLINT_DLL slong gf2_mat_rref(gf2_mat_t A);
+
+FLINT_DLL slong gf2_mat_rank(const gf2_mat_t A);
+
+FLINT_DLL slong gf2_mat_nullspace(gf2_mat_t X, const gf2_mat_t A);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,214 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "thread_pool.h"
+
+/*
+    Gaussian elimination with the Method of the Four Russians (M4RI). The
+    columns are taken in strips of K = GF2_MAT_M4RI_K, which lie within one
+    limb. For each strip:
+
+    1. Up to K pivots are found among the rows below the current rank.
+       Candidate rows are reduced lazily by the pivots found so far, and
+       each new pivot is eliminated from the earlier pivot rows, so that
+       the pivot rows restricted to the pivot columns form an identity.
+    2. A table of all 2^k sums of the k pivot rows is built, and every
+       other row below (and, for the reduced form, above) is cleared in
+       the pivot columns by adding the table entry selected by its bits
+       in those columns. This step is split between threads by rows.
+
+    The rows below the current rank are zero in all earlier columns, so
+    only the limbs from the strip onwards take part.
+*/
+
+#define K GF2_MAT_M4RI_K
+
+typedef struct
+{
+    gf2_mat_struct * A;
+    mp_srcptr T;
+    const slong * cmap;
+    slong col;
+    slong w;
+    slong skip_start;
+    slong skip_len;
+    slong start;
+    slong end;
+} _echelon_arg_t;
+
+static void *
+_gf2_mat_echelon_worker(void * arg_ptr)
+{
+    _echelon_arg_t arg = *((_echelon_arg_t *) arg_ptr);
+    slong v, i, l0 = arg.col / FLINT_BITS, x;
+    mp_ptr row;
+
+    for (v = arg.start; v < arg.end; v++)
+    {
+        /* virtual row v skips the rows of the current pivots */
+        i = (v < arg.skip_start) ? v : v + arg.skip_len;
+        row = arg.A->rows[i] + l0;
+
+        x = arg.cmap[(row[0] >> (arg.col % FLINT_BITS))
+                                                & ((WORD(1) << K) - 1)];
+        if (x != 0)
+            _gf2_vec_add(row, row, arg.T + x * arg.w, arg.w);
+    }
+
+    return NULL;
+}
+
+slong
+_gf2_mat_echelon_m4ri(gf2_mat_t A, slong * pivots, int reduced)
+{
+    slong m, n, limbs, r, col, width, l0, w, kk, i, j, t, x, v0, nv;
+    slong num_threads, num_tasks;
+    slong pc[K], cmap[WORD(1) << K];
+    slong * done;
+    mp_ptr T, row, prow;
+    mp_limb_t bit;
+    unsigned int z;
+    _echelon_arg_t * args;
+
+    m = A->r;
+    n = A->c;
+    limbs = GF2_MAT_LIMBS(n);
+
+    if (m == 0 || n == 0)
+        return 0;
+
+    done = flint_malloc(m * sizeof(slong));
+    T = flint_malloc((WORD(1) << K) * limbs * sizeof(mp_limb_t));
+    args = flint_malloc(flint_get_num_threads() * sizeof(_echelon_arg_t));
+
+    r = 0;
+    for (col = 0; col < n && r < m; col += K)
+    {
+        width = FLINT_MIN(K, n - col);
+        l0 = col / FLINT_BITS;
+        w = limbs - l0;
+
+        for (i = r; i < m; i++)
+            done[i] = 0;
+
+        /* find the pivots of the strip */
+        kk = 0;
+        for (j = col; j < col + width && r + kk < m; j++)
+        {
+            bit = UWORD(1) << (j % FLINT_BITS);
+
+            for (i = r + kk; i < m; i++)
+            {
+                row = A->rows[i] + l0;
+
+                for (t = done[i]; t < kk; t++)
+                    if (row[0] & (UWORD(1) << (pc[t] % FLINT_BITS)))
+                        _gf2_vec_add(row, row, A->rows[r + t] + l0, w);
+                done[i] = kk;
+
+                if (row[0] & bit)
+                    break;
+            }
+
+            if (i == m)
+                continue;
+
+            MP_PTR_SWAP(A->rows[i], A->rows[r + kk]);
+            t = done[i];
+            done[i] = done[r + kk];
+            done[r + kk] = t;
+
+            row = A->rows[r + kk] + l0;
+            for (t = 0; t < kk; t++)
+            {
+                prow = A->rows[r + t] + l0;
+                if (prow[0] & bit)
+                    _gf2_vec_add(prow, prow, row, w);
+            }
+
+            pc[kk++] = j;
+        }
+
+        if (kk == 0)
+            continue;
+
+        /* sums of the pivot rows, and their index by bits of the strip */
+        flint_mpn_zero(T, w);
+        for (x = 1; x < (WORD(1) << kk); x++)
+        {
+            count_trailing_zeros(z, (mp_limb_t) x);
+            _gf2_vec_add(T + x * w, T + (x & (x - 1)) * w,
+                                                A->rows[r + z] + l0, w);
+        }
+
+        for (x = 0; x < (WORD(1) << width); x++)
+        {
+            cmap[x] = 0;
+            for (t = 0; t < kk; t++)
+                cmap[x] |= ((x >> (pc[t] - col)) & 1) << t;
+        }
+
+        /* clear the pivot columns in the other rows */
+        v0 = reduced ? 0 : r;
+        nv = m - kk - v0;
+
+        num_threads = flint_get_num_threads();
+        if (nv * K * w < GF2_MAT_THREADED_CUTOFF)
+            num_threads = 1;
+        num_tasks = FLINT_MAX(FLINT_MIN(num_threads, nv), 1);
+
+        for (t = 0; t < num_tasks; t++)
+        {
+            args[t].A = A;
+            args[t].T = T;
+            args[t].cmap = cmap;
+            args[t].col = col;
+            args[t].w = w;
+            args[t].skip_start = r;
+            args[t].skip_len = kk;
+            args[t].start = v0 + (t * nv) / num_tasks;
+            args[t].end = v0 + ((t + 1) * nv) / num_tasks;
+        }
+
+        flint_parallel_do(_gf2_mat_echelon_worker, args,
+                          sizeof(_echelon_arg_t), num_tasks);
+
+        if (pivots != NULL)
+            for (t = 0; t < kk; t++)
+                pivots[r + t] = pc[t];
+
+        r += kk;
+    }
+
+    flint_free(done);
+    flint_free(T);
+    flint_free(args);
+
+    return r;
+}
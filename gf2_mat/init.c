@@ -0,0 +1,47 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_init(gf2_mat_t mat, slong rows, slong cols)
+{
+    slong i, limbs = GF2_MAT_LIMBS(cols);
+
+    /* the row pointers are always allocated, so that loops over the rows
+       need no special case for zero columns */
+    mat->entries = (rows && cols) ?
+        flint_calloc(rows * limbs, sizeof(mp_limb_t)) : NULL;
+    mat->rows = (rows) ? flint_malloc(rows * sizeof(mp_limb_t *)) : NULL;
+
+    for (i = 0; i < rows; i++)
+        mat->rows[i] = mat->entries + i * limbs;
+
+    mat->r = rows;
+    mat->c = cols;
+}
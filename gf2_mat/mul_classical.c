@@ -0,0 +1,56 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_mul_classical(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i, k, limbs;
+
+    if (C == A || C == B)
+    {
+        gf2_mat_t T;
+        gf2_mat_init(T, A->r, B->c);
+        gf2_mat_mul_classical(T, A, B);
+        gf2_mat_swap(C, T);
+        gf2_mat_clear(T);
+        return;
+    }
+
+    limbs = GF2_MAT_LIMBS(B->c);
+
+    for (i = 0; i < A->r; i++)
+    {
+        flint_mpn_zero(C->rows[i], limbs);
+
+        for (k = 0; k < A->c; k++)
+            if (gf2_mat_entry(A, i, k))
+                _gf2_vec_add(C->rows[i], C->rows[i], B->rows[k], limbs);
+    }
+}
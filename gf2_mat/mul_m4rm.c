@@ -0,0 +1,191 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "thread_pool.h"
+
+/*
+    Method of the Four Russians. For every GF2_MAT_M4RI_K rows of B, a
+    table of all 2^K sums of those rows is built with one addition per
+    entry, and row i of C is then updated with the entry selected by the
+    corresponding K bits of row i of A. GF2_MAT_M4RM_TABLES tables are
+    used together, so that each row of C is read and written once for
+    every K * GF2_MAT_M4RM_TABLES rows of B.
+
+    The limbs of the rows of B and C are processed in chunks of
+    GF2_MAT_M4RM_CHUNK so that the tables stay in cache, and threads
+    take disjoint ranges of limbs, which need no synchronisation.
+*/
+
+#define K GF2_MAT_M4RI_K
+#define NT GF2_MAT_M4RM_TABLES
+
+typedef struct
+{
+    gf2_mat_struct * C;
+    const gf2_mat_struct * A;
+    const gf2_mat_struct * B;
+    slong start;
+    slong end;
+} _mul_m4rm_arg_t;
+
+/* T[x] = sum of the rows kb + t of B, limbs l0 to l0 + w, for bits t of x */
+static void
+_gf2_mat_m4rm_table(mp_ptr T, const gf2_mat_struct * B, slong kb,
+                                                        slong l0, slong w)
+{
+    slong x, len = FLINT_MIN(K, B->r - kb);
+    unsigned int z;
+
+    flint_mpn_zero(T, w);
+
+    for (x = 1; x < (WORD(1) << len); x++)
+    {
+        count_trailing_zeros(z, (mp_limb_t) x);
+        _gf2_vec_add(T + x * w, T + (x & (x - 1)) * w,
+                     B->rows[kb + z] + l0, w);
+    }
+}
+
+static void *
+_gf2_mat_mul_m4rm_worker(void * arg_ptr)
+{
+    _mul_m4rm_arg_t arg = *((_mul_m4rm_arg_t *) arg_ptr);
+    gf2_mat_struct * C = arg.C;
+    const gf2_mat_struct * A = arg.A;
+    const gf2_mat_struct * B = arg.B;
+    slong i, j, t, l0, w, kb, len;
+    mp_ptr T, c;
+    mp_srcptr T0;
+    mp_limb_t a;
+
+    T = flint_malloc(NT * (WORD(1) << K) * GF2_MAT_M4RM_CHUNK
+                                                    * sizeof(mp_limb_t));
+
+    for (l0 = arg.start; l0 < arg.end; l0 += GF2_MAT_M4RM_CHUNK)
+    {
+        w = FLINT_MIN(GF2_MAT_M4RM_CHUNK, arg.end - l0);
+
+        for (i = 0; i < A->r; i++)
+            flint_mpn_zero(C->rows[i] + l0, w);
+
+        for (kb = 0; kb < A->c; kb += NT * K)
+        {
+            len = FLINT_MIN(NT * K, A->c - kb);
+
+            /* past the end of B only the zero entry of a table is used */
+            for (t = 0; t < NT; t++)
+            {
+                if (t * K < len)
+                    _gf2_mat_m4rm_table(T + t * (WORD(1) << K) * w, B,
+                                                       kb + t * K, l0, w);
+                else
+                    flint_mpn_zero(T + t * (WORD(1) << K) * w, w);
+            }
+
+            for (i = 0; i < A->r; i++)
+            {
+                a = _gf2_mat_row_bits(A->rows[i], kb, len);
+                if (a == 0)
+                    continue;
+
+                c = C->rows[i] + l0;
+                T0 = T + (a & ((WORD(1) << K) - 1)) * w;
+#if NT == 4 && 4 * K <= FLINT_BITS
+                {
+                    mp_srcptr T1, T2, T3;
+
+                    T1 = T + ((WORD(1) << K)
+                              + ((a >> K) & ((WORD(1) << K) - 1))) * w;
+                    T2 = T + (2 * (WORD(1) << K)
+                              + ((a >> (2 * K)) & ((WORD(1) << K) - 1))) * w;
+                    T3 = T + (3 * (WORD(1) << K)
+                              + ((a >> (3 * K)) & ((WORD(1) << K) - 1))) * w;
+
+                    for (j = 0; j < w; j++)
+                        c[j] ^= T0[j] ^ T1[j] ^ T2[j] ^ T3[j];
+                }
+#else
+                for (t = 0; t < NT && t * K < len; t++)
+                {
+                    T0 = T + (t * (WORD(1) << K)
+                              + ((a >> (t * K)) & ((WORD(1) << K) - 1))) * w;
+                    _gf2_vec_add(c, c, T0, w);
+                }
+#endif
+            }
+        }
+    }
+
+    flint_free(T);
+
+    return NULL;
+}
+
+void
+gf2_mat_mul_m4rm(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i, limbs, num_threads, num_tasks;
+    _mul_m4rm_arg_t * args;
+
+    if (C == A || C == B)
+    {
+        gf2_mat_t T;
+        gf2_mat_init(T, A->r, B->c);
+        gf2_mat_mul_m4rm(T, A, B);
+        gf2_mat_swap(C, T);
+        gf2_mat_clear(T);
+        return;
+    }
+
+    limbs = GF2_MAT_LIMBS(B->c);
+
+    if (A->r == 0 || limbs == 0)
+        return;
+
+    num_threads = flint_get_num_threads();
+    if (A->r * A->c * limbs < GF2_MAT_THREADED_CUTOFF)
+        num_threads = 1;
+    num_tasks = FLINT_MIN(num_threads, limbs);
+
+    args = flint_malloc(num_tasks * sizeof(_mul_m4rm_arg_t));
+
+    for (i = 0; i < num_tasks; i++)
+    {
+        args[i].C = C;
+        args[i].A = A;
+        args[i].B = B;
+        args[i].start = (i * limbs) / num_tasks;
+        args[i].end = ((i + 1) * limbs) / num_tasks;
+    }
+
+    flint_parallel_do(_gf2_mat_mul_m4rm_worker, args,
+                      sizeof(_mul_m4rm_arg_t), num_tasks);
+
+    flint_free(args);
+}
@@ -0,0 +1,177 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+/*
+    As nmod_mat_mul_strassen, with additions and subtractions both XOR.
+    Windows can only start at columns divisible by FLINT_BITS, so the inner
+    dimension and the columns of B are split at multiples of FLINT_BITS,
+    and the leftover strips are handled separately.
+*/
+void
+gf2_mat_mul_strassen(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong a, b, c;
+    slong anr, anc, bnr, bnc;
+
+    gf2_mat_t A11, A12, A21, A22;
+    gf2_mat_t B11, B12, B21, B22;
+    gf2_mat_t C11, C12, C21, C22;
+    gf2_mat_t X1, X2;
+
+    if (C == A || C == B)
+    {
+        gf2_mat_t T;
+        gf2_mat_init(T, A->r, B->c);
+        gf2_mat_mul_strassen(T, A, B);
+        gf2_mat_swap(C, T);
+        gf2_mat_clear(T);
+        return;
+    }
+
+    a = A->r;
+    b = A->c;
+    c = B->c;
+
+    anr = a / 2;
+    anc = (b / (2 * FLINT_BITS)) * FLINT_BITS;
+    bnr = anc;
+    bnc = (c / (2 * FLINT_BITS)) * FLINT_BITS;
+
+    if (anr == 0 || anc == 0 || bnc == 0)
+    {
+        gf2_mat_mul_m4rm(C, A, B);
+        return;
+    }
+
+    gf2_mat_window_init(A11, A, 0, 0, anr, anc);
+    gf2_mat_window_init(A12, A, 0, anc, anr, 2*anc);
+    gf2_mat_window_init(A21, A, anr, 0, 2*anr, anc);
+    gf2_mat_window_init(A22, A, anr, anc, 2*anr, 2*anc);
+
+    gf2_mat_window_init(B11, B, 0, 0, bnr, bnc);
+    gf2_mat_window_init(B12, B, 0, bnc, bnr, 2*bnc);
+    gf2_mat_window_init(B21, B, bnr, 0, 2*bnr, bnc);
+    gf2_mat_window_init(B22, B, bnr, bnc, 2*bnr, 2*bnc);
+
+    gf2_mat_window_init(C11, C, 0, 0, anr, bnc);
+    gf2_mat_window_init(C12, C, 0, bnc, anr, 2*bnc);
+    gf2_mat_window_init(C21, C, anr, 0, 2*anr, bnc);
+    gf2_mat_window_init(C22, C, anr, bnc, 2*anr, 2*bnc);
+
+    gf2_mat_init(X1, anr, FLINT_MAX(bnc, anc));
+    gf2_mat_init(X2, anc, bnc);
+
+    X1->c = anc;
+
+    gf2_mat_add(X1, A11, A21);
+    gf2_mat_add(X2, B22, B12);
+    gf2_mat_mul(C21, X1, X2);
+
+    gf2_mat_add(X1, A21, A22);
+    gf2_mat_add(X2, B12, B11);
+    gf2_mat_mul(C22, X1, X2);
+
+    gf2_mat_add(X1, X1, A11);
+    gf2_mat_add(X2, B22, X2);
+    gf2_mat_mul(C12, X1, X2);
+
+    gf2_mat_add(X1, A12, X1);
+    gf2_mat_mul(C11, X1, B22);
+
+    X1->c = bnc;
+    gf2_mat_mul(X1, A11, B11);
+
+    gf2_mat_add(C12, X1, C12);
+    gf2_mat_add(C21, C12, C21);
+    gf2_mat_add(C12, C12, C22);
+    gf2_mat_add(C22, C21, C22);
+    gf2_mat_add(C12, C12, C11);
+    gf2_mat_add(X2, X2, B21);
+    gf2_mat_mul(C11, A22, X2);
+
+    gf2_mat_clear(X2);
+
+    gf2_mat_add(C21, C21, C11);
+    gf2_mat_mul(C11, A12, B21);
+
+    gf2_mat_add(C11, X1, C11);
+
+    gf2_mat_clear(X1);
+
+    gf2_mat_window_clear(A11);
+    gf2_mat_window_clear(A12);
+    gf2_mat_window_clear(A21);
+    gf2_mat_window_clear(A22);
+
+    gf2_mat_window_clear(B11);
+    gf2_mat_window_clear(B12);
+    gf2_mat_window_clear(B21);
+    gf2_mat_window_clear(B22);
+
+    gf2_mat_window_clear(C11);
+    gf2_mat_window_clear(C12);
+    gf2_mat_window_clear(C21);
+    gf2_mat_window_clear(C22);
+
+    if (c > 2*bnc) /* A by last cols of B -> last cols of C */
+    {
+        gf2_mat_t Bc, Cc;
+        gf2_mat_window_init(Bc, B, 0, 2*bnc, b, c);
+        gf2_mat_window_init(Cc, C, 0, 2*bnc, a, c);
+        gf2_mat_mul(Cc, A, Bc);
+        gf2_mat_window_clear(Bc);
+        gf2_mat_window_clear(Cc);
+    }
+
+    if (a > 2*anr) /* last row of A by B -> last row of C */
+    {
+        gf2_mat_t Ar, Cr;
+        gf2_mat_window_init(Ar, A, 2*anr, 0, a, b);
+        gf2_mat_window_init(Cr, C, 2*anr, 0, a, c);
+        gf2_mat_mul(Cr, Ar, B);
+        gf2_mat_window_clear(Ar);
+        gf2_mat_window_clear(Cr);
+    }
+
+    if (b > 2*anc) /* last cols of A by last rows of B -> C */
+    {
+        gf2_mat_t Ac, Br, Cb, T;
+        gf2_mat_window_init(Ac, A, 0, 2*anc, 2*anr, b);
+        gf2_mat_window_init(Br, B, 2*bnr, 0, b, 2*bnc);
+        gf2_mat_window_init(Cb, C, 0, 0, 2*anr, 2*bnc);
+        gf2_mat_init(T, 2*anr, 2*bnc);
+        gf2_mat_mul(T, Ac, Br);
+        gf2_mat_add(Cb, Cb, T);
+        gf2_mat_clear(T);
+        gf2_mat_window_clear(Ac);
+        gf2_mat_window_clear(Br);
+        gf2_mat_window_clear(Cb);
+    }
+}
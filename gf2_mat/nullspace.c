@@ -0,0 +1,71 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+slong
+gf2_mat_nullspace(gf2_mat_t X, const gf2_mat_t A)
+{
+    slong i, j, k, n, rank, nullity;
+    slong * pivots, * nonpivots;
+    gf2_mat_t tmp;
+
+    n = A->c;
+
+    pivots = flint_malloc(sizeof(slong) * (n + 1));
+
+    gf2_mat_init_set(tmp, A);
+    rank = _gf2_mat_echelon_m4ri(tmp, pivots, 1);
+    nullity = n - rank;
+    nonpivots = pivots + rank;
+
+    /* the pivots are increasing, so the other columns fill in after them */
+    for (i = j = k = 0; j < n; j++)
+    {
+        if (i < rank && pivots[i] == j)
+            i++;
+        else
+            nonpivots[k++] = j;
+    }
+
+    gf2_mat_zero(X);
+
+    for (i = 0; i < nullity; i++)
+    {
+        for (j = 0; j < rank; j++)
+            if (gf2_mat_entry(tmp, j, nonpivots[i]))
+                gf2_mat_set_entry(X, pivots[j], i, 1);
+
+        gf2_mat_set_entry(X, nonpivots[i], i, 1);
+    }
+
+    flint_free(pivots);
+    gf2_mat_clear(tmp);
+
+    return nullity;
+}
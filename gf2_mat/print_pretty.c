@@ -0,0 +1,47 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_print_pretty(const gf2_mat_t mat)
+{
+    slong i, j;
+
+    flint_printf("<%wd x %wd matrix over GF(2)>\n", mat->r, mat->c);
+
+    for (i = 0; i < mat->r && mat->c != 0; i++)
+    {
+        flint_printf("[");
+        for (j = 0; j < mat->c; j++)
+            flint_printf("%c", gf2_mat_entry(mat, i, j) ? '1' : '.');
+        flint_printf("]\n");
+    }
+}
@@ -0,0 +1,95 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+
+/*
+   Compares nmod_mat_mul_blocked modulo 2 with the M4RM and Strassen-Winograd
+   multiplications of the bit-packed matrices, for square matrices.
+*/
+
+int main(void)
+{
+    slong n;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("times in ms: nmod_mat, m4rm, strassen\n");
+
+    for (n = 256; n <= 8192; n *= 2)
+    {
+        gf2_mat_t A, B, C;
+        nmod_mat_t MA, MB, MC;
+        timeit_t t0, t1, t2;
+
+        gf2_mat_init(A, n, n);
+        gf2_mat_init(B, n, n);
+        gf2_mat_init(C, n, n);
+        gf2_mat_randtest(A, state);
+        gf2_mat_randtest(B, state);
+
+        /* the word sized product is too slow beyond this */
+        t0->cpu = -1;
+        if (n <= 2048)
+        {
+            nmod_mat_init(MA, n, n, 2);
+            nmod_mat_init(MB, n, n, 2);
+            nmod_mat_init(MC, n, n, 2);
+            gf2_mat_get_nmod_mat(MA, A);
+            gf2_mat_get_nmod_mat(MB, B);
+
+            timeit_start(t0);
+            nmod_mat_mul_blocked(MC, MA, MB);
+            timeit_stop(t0);
+
+            nmod_mat_clear(MA);
+            nmod_mat_clear(MB);
+            nmod_mat_clear(MC);
+        }
+
+        timeit_start(t1);
+        gf2_mat_mul_m4rm(C, A, B);
+        timeit_stop(t1);
+
+        timeit_start(t2);
+        gf2_mat_mul_strassen(C, A, B);
+        timeit_stop(t2);
+
+        flint_printf("n = %wd: %wd %wd %wd\n", n, t0->cpu, t1->cpu, t2->cpu);
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+
+/*
+   Compares the rank of a square matrix modulo 2 computed by LU
+   decomposition of the word sized matrix with gf2_mat_rank.
+*/
+
+int main(void)
+{
+    slong n;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("times in ms: nmod_mat_lu, gf2_mat_rank\n");
+
+    for (n = 256; n <= 16384; n *= 2)
+    {
+        gf2_mat_t A;
+        nmod_mat_t M;
+        slong * P, rank1, rank2;
+        timeit_t t0, t1;
+
+        gf2_mat_init(A, n, n);
+        gf2_mat_randtest(A, state);
+
+        /* the word sized elimination is too slow beyond this */
+        rank1 = -1;
+        t0->cpu = -1;
+        if (n <= 4096)
+        {
+            nmod_mat_init(M, n, n, 2);
+            gf2_mat_get_nmod_mat(M, A);
+            P = flint_malloc(sizeof(slong) * n);
+
+            timeit_start(t0);
+            rank1 = nmod_mat_lu(P, M, 0);
+            timeit_stop(t0);
+
+            flint_free(P);
+            nmod_mat_clear(M);
+        }
+
+        timeit_start(t1);
+        rank2 = gf2_mat_rank(A);
+        timeit_stop(t1);
+
+        flint_printf("n = %wd, rank = %wd, %wd: %wd %wd\n",
+            n, rank1, rank2, t0->cpu, t1->cpu);
+
+        gf2_mat_clear(A);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    return 0;
+}
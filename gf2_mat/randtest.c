@@ -0,0 +1,62 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_randtest(gf2_mat_t mat, flint_rand_t state)
+{
+    slong i, j, limbs = GF2_MAT_LIMBS(mat->c);
+    int density = n_randint(state, 4);
+
+    if (limbs == 0)
+        return;
+
+    for (i = 0; i < mat->r; i++)
+    {
+        for (j = 0; j < limbs; j++)
+        {
+            mp_limb_t x = n_randlimb(state);
+
+            /* about 1/2, 1/4, 1/16 or 1/256 of the bits set */
+            if (density >= 1)
+                x &= n_randlimb(state);
+            if (density >= 2)
+                x &= n_randlimb(state) & n_randlimb(state);
+            if (density == 3)
+                x &= n_randlimb(state) & n_randlimb(state)
+                   & n_randlimb(state) & n_randlimb(state);
+
+            mat->rows[i][j] = x;
+        }
+
+        mat->rows[i][limbs - 1] &= GF2_MAT_LAST_MASK(mat->c);
+    }
+}
@@ -0,0 +1,50 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_set_nmod_mat(gf2_mat_t B, const nmod_mat_t A)
+{
+    slong i, j, k, len;
+    mp_limb_t x;
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < A->c; j += FLINT_BITS)
+        {
+            len = FLINT_MIN(FLINT_BITS, A->c - j);
+            x = 0;
+            for (k = 0; k < len; k++)
+                x |= (A->rows[i][j + k] & UWORD(1)) << k;
+            B->rows[i][j / FLINT_BITS] = x;
+        }
+    }
+}
@@ -0,0 +1,132 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "thread_pool.h"
+#include "gf2_mat.h"
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B, C, D;
+        nmod_mat_t MA, MB, MC;
+        slong m, k, n, bound;
+        int alg;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+        flint_set_cpu_features(n_randlimb(state));
+
+        /* now and then large enough for Strassen to split several times */
+        bound = n_randint(state, 20) == 0 ? 300 : 150;
+        m = n_randint(state, bound);
+        k = n_randint(state, bound);
+        n = n_randint(state, bound);
+
+        gf2_mat_init(A, m, k);
+        gf2_mat_init(B, k, n);
+        gf2_mat_init(C, m, n);
+        gf2_mat_init(D, m, n);
+        nmod_mat_init(MA, m, k, 2);
+        nmod_mat_init(MB, k, n, 2);
+        nmod_mat_init(MC, m, n, 2);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_randtest(B, state);
+        gf2_mat_randtest(C, state);
+
+        gf2_mat_get_nmod_mat(MA, A);
+        gf2_mat_get_nmod_mat(MB, B);
+        nmod_mat_mul_classical(MC, MA, MB);
+        gf2_mat_set_nmod_mat(D, MC);
+
+        alg = n_randint(state, 4);
+        if (alg == 0)
+            gf2_mat_mul_classical(C, A, B);
+        else if (alg == 1)
+            gf2_mat_mul_m4rm(C, A, B);
+        else if (alg == 2)
+            gf2_mat_mul_strassen(C, A, B);
+        else
+            gf2_mat_mul(C, A, B);
+
+        if (!gf2_mat_equal(C, D))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m = %wd, k = %wd, n = %wd, alg = %d\n",
+                m, k, n, alg);
+            abort();
+        }
+
+        /* aliasing */
+        if (m == k && k == n)
+        {
+            if (n_randint(state, 2))
+            {
+                gf2_mat_set(C, A);
+                gf2_mat_mul(C, C, B);
+            }
+            else
+            {
+                gf2_mat_set(C, B);
+                gf2_mat_mul(C, A, C);
+            }
+
+            if (!gf2_mat_equal(C, D))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("aliasing, n = %wd\n", n);
+                abort();
+            }
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+        gf2_mat_clear(D);
+        nmod_mat_clear(MA);
+        nmod_mat_clear(MB);
+        nmod_mat_clear(MC);
+    }
+
+    flint_set_num_threads(1);
+    flint_set_cpu_features(~UWORD(0));
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
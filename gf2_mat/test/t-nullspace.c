@@ -0,0 +1,88 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "thread_pool.h"
+#include "gf2_mat.h"
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, X, AX;
+        nmod_mat_t M;
+        slong m, n, r, nullity;
+
+        m = n_randint(state, 150);
+        n = n_randint(state, 150);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(X, n, n);
+        gf2_mat_init(AX, m, n);
+        nmod_mat_init(M, m, n, 2);
+
+        nmod_mat_randrank(M, state, r);
+        if (n_randint(state, 2))
+            nmod_mat_randops(M, n_randint(state, 1 + 8 * (m + n)), state);
+        gf2_mat_set_nmod_mat(A, M);
+
+        gf2_mat_randtest(X, state);
+        nullity = gf2_mat_nullspace(X, A);
+        gf2_mat_mul(AX, A, X);
+
+        if (nullity + r != n || gf2_mat_rank(X) != nullity
+                             || !gf2_mat_is_zero(AX))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m = %wd, n = %wd, r = %wd, nullity = %wd\n",
+                m, n, r, nullity);
+            gf2_mat_print_pretty(A);
+            gf2_mat_print_pretty(X);
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(X);
+        gf2_mat_clear(AX);
+        nmod_mat_clear(M);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
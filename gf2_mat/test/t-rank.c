@@ -0,0 +1,84 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "thread_pool.h"
+#include "gf2_mat.h"
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rank....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A;
+        nmod_mat_t M;
+        slong m, n, r, bound, rank;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        /* now and then large enough to be threaded */
+        bound = n_randint(state, 20) == 0 ? 1200 : 200;
+        m = n_randint(state, bound);
+        n = n_randint(state, bound);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+
+        gf2_mat_init(A, m, n);
+        nmod_mat_init(M, m, n, 2);
+
+        nmod_mat_randrank(M, state, r);
+        nmod_mat_randops(M, n_randint(state, 1 + 8 * (m + n)), state);
+        gf2_mat_set_nmod_mat(A, M);
+
+        rank = gf2_mat_rank(A);
+
+        if (rank != r)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m = %wd, n = %wd, r = %wd, rank = %wd\n",
+                m, n, r, rank);
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        nmod_mat_clear(M);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
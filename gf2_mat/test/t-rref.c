@@ -0,0 +1,125 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "thread_pool.h"
+#include "gf2_mat.h"
+
+/* plain Gauss-Jordan elimination modulo 2, as a reference */
+slong
+rref_naive(nmod_mat_t A)
+{
+    slong i, j, k, rank = 0;
+
+    for (j = 0; j < A->c && rank < A->r; j++)
+    {
+        for (i = rank; i < A->r && A->rows[i][j] == 0; i++) ;
+
+        if (i == A->r)
+            continue;
+
+        MP_PTR_SWAP(A->rows[i], A->rows[rank]);
+
+        for (i = 0; i < A->r; i++)
+            if (i != rank && A->rows[i][j] != 0)
+                for (k = j; k < A->c; k++)
+                    A->rows[i][k] ^= A->rows[rank][k];
+
+        rank++;
+    }
+
+    return rank;
+}
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rref....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B;
+        nmod_mat_t M;
+        slong m, n, r, rank1, rank2;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+        flint_set_cpu_features(n_randlimb(state));
+
+        m = n_randint(state, 200);
+        n = n_randint(state, 200);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(B, m, n);
+        nmod_mat_init(M, m, n, 2);
+
+        if (n_randint(state, 2))
+        {
+            nmod_mat_randrank(M, state, r);
+            if (n_randint(state, 2))
+                nmod_mat_randops(M, n_randint(state, 1 + 8 * (m + n)), state);
+            gf2_mat_set_nmod_mat(A, M);
+        }
+        else
+        {
+            gf2_mat_randtest(A, state);
+            gf2_mat_get_nmod_mat(M, A);
+        }
+
+        rank1 = rref_naive(M);
+        gf2_mat_set_nmod_mat(B, M);
+        rank2 = gf2_mat_rref(A);
+
+        if (rank1 != rank2 || !gf2_mat_equal(A, B))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m = %wd, n = %wd, rank1 = %wd, rank2 = %wd\n",
+                m, n, rank1, rank2);
+            gf2_mat_print_pretty(A);
+            gf2_mat_print_pretty(B);
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        nmod_mat_clear(M);
+    }
+
+    flint_set_num_threads(1);
+    flint_set_cpu_features(~UWORD(0));
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
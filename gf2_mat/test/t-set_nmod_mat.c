@@ -0,0 +1,106 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_nmod_mat....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B;
+        nmod_mat_t M, N;
+        slong j, k, r, c;
+
+        r = n_randint(state, 100);
+        c = n_randint(state, 200);
+
+        gf2_mat_init(A, r, c);
+        gf2_mat_init(B, r, c);
+        nmod_mat_init(M, r, c, 2);
+        nmod_mat_init(N, r, c, 2);
+
+        nmod_mat_randtest(M, state);
+        gf2_mat_randtest(A, state);
+
+        gf2_mat_set_nmod_mat(A, M);
+        gf2_mat_get_nmod_mat(N, A);
+
+        if (!nmod_mat_equal(M, N))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("round trip\n");
+            nmod_mat_print_pretty(M);
+            gf2_mat_print_pretty(A);
+            abort();
+        }
+
+        /* entries one at a time, and the unused bits stay clear */
+        gf2_mat_randtest(B, state);
+        for (j = 0; j < r; j++)
+            for (k = 0; k < c; k++)
+                gf2_mat_set_entry(B, j, k, nmod_mat_entry(M, j, k));
+
+        if (!gf2_mat_equal(A, B))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("set_entry\n");
+            gf2_mat_print_pretty(A);
+            gf2_mat_print_pretty(B);
+            abort();
+        }
+
+        for (j = 0; j < r && c != 0; j++)
+        {
+            if (A->rows[j][GF2_MAT_LIMBS(c) - 1] & ~GF2_MAT_LAST_MASK(c))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("unused bits set\n");
+                abort();
+            }
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        nmod_mat_clear(M);
+        nmod_mat_clear(N);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("transpose....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B, C;
+        nmod_mat_t M, T;
+        slong r, c;
+
+        r = n_randint(state, 200);
+        c = n_randint(state, 200);
+
+        gf2_mat_init(A, r, c);
+        gf2_mat_init(B, c, r);
+        gf2_mat_init(C, c, r);
+        nmod_mat_init(M, r, c, 2);
+        nmod_mat_init(T, c, r, 2);
+
+        nmod_mat_randtest(M, state);
+        nmod_mat_transpose(T, M);
+        gf2_mat_set_nmod_mat(A, M);
+        gf2_mat_set_nmod_mat(C, T);
+
+        gf2_mat_randtest(B, state);
+        if (n_randint(state, 2))
+        {
+            gf2_mat_transpose(B, A);
+        }
+        else
+        {
+            gf2_mat_transpose(A, A);
+            gf2_mat_swap(A, B);
+        }
+
+        if (!gf2_mat_equal(B, C))
+        {
+            flint_printf("FAIL:\n");
+            gf2_mat_print_pretty(B);
+            gf2_mat_print_pretty(C);
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+        nmod_mat_clear(M);
+        nmod_mat_clear(T);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
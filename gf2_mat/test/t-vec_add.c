@@ -0,0 +1,92 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "gf2_mat.h"
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("vec_add....");
+    fflush(stdout);
+
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        slong j, len = n_randint(state, 100);
+        mp_ptr a, b, c, d;
+        int alias = n_randint(state, 3);
+
+        a = flint_malloc((4 * len + 1) * sizeof(mp_limb_t));
+        b = a + len;
+        c = b + len;
+        d = c + len;
+
+        /* exercise each of the kernels available on this machine */
+        flint_set_cpu_features(n_randlimb(state));
+
+        for (j = 0; j < len; j++)
+        {
+            a[j] = n_randtest(state);
+            b[j] = n_randtest(state);
+            d[j] = a[j] ^ b[j];
+        }
+
+        if (alias == 0)
+            _gf2_vec_add(c, a, b, len);
+        else if (alias == 1)
+        {
+            flint_mpn_copyi(c, a, len);
+            _gf2_vec_add(c, c, b, len);
+        }
+        else
+        {
+            flint_mpn_copyi(c, b, len);
+            _gf2_vec_add(c, a, c, len);
+        }
+
+        if (len != 0 && mpn_cmp(c, d, len) != 0)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("len = %wd, alias = %d\n", len, alias);
+            abort();
+        }
+
+        flint_free(a);
+    }
+
+    flint_set_cpu_features(~UWORD(0));
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
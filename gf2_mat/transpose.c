@@ -0,0 +1,86 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "gf2_mat.h"
+
+/*
+    Transposes a FLINT_BITS x FLINT_BITS bit matrix in place, by swapping
+    the off-diagonal blocks of sizes FLINT_BITS / 2, FLINT_BITS / 4, ...
+    within all diagonal blocks at once.
+*/
+static void
+_gf2_mat_transpose_block(mp_limb_t * x)
+{
+    mp_limb_t m, t;
+    slong j, k;
+
+    m = (UWORD(1) << (FLINT_BITS / 2)) - 1;
+
+    for (j = FLINT_BITS / 2; j != 0; j >>= 1, m ^= (m << j))
+    {
+        for (k = 0; k < FLINT_BITS; k = ((k | j) + 1) & ~j)
+        {
+            t = ((x[k] >> j) ^ x[k | j]) & m;
+            x[k] ^= t << j;
+            x[k | j] ^= t;
+        }
+    }
+}
+
+void
+gf2_mat_transpose(gf2_mat_t B, const gf2_mat_t A)
+{
+    mp_limb_t x[FLINT_BITS];
+    slong bi, bj, t;
+
+    if (B == A)
+    {
+        gf2_mat_t T;
+        gf2_mat_init(T, A->c, A->r);
+        gf2_mat_transpose(T, A);
+        gf2_mat_swap(B, T);
+        gf2_mat_clear(T);
+        return;
+    }
+
+    for (bi = 0; bi < A->r; bi += FLINT_BITS)
+    {
+        for (bj = 0; bj < A->c; bj += FLINT_BITS)
+        {
+            for (t = 0; t < FLINT_BITS; t++)
+                x[t] = (bi + t < A->r) ? A->rows[bi + t][bj / FLINT_BITS] : 0;
+
+            _gf2_mat_transpose_block(x);
+
+            for (t = 0; t < FLINT_BITS && bj + t < A->c; t++)
+                B->rows[bj + t][bi / FLINT_BITS] = x[t];
+        }
+    }
+}
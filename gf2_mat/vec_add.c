@@ -0,0 +1,56 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+void
+_gf2_vec_add(mp_ptr res, mp_srcptr vec1, mp_srcptr vec2, slong len)
+{
+    slong i;
+
+#if HAVE_AVX2
+    if (len >= GF2_VEC_SIMD_CUTOFF)
+    {
+        ulong features = flint_get_cpu_features();
+
+        if (features & FLINT_CPU_AVX512F)
+        {
+            _gf2_vec_add_avx512(res, vec1, vec2, len);
+            return;
+        }
+
+        if (features & FLINT_CPU_AVX2)
+        {
+            _gf2_vec_add_avx2(res, vec1, vec2, len);
+            return;
+        }
+    }
+#endif
+
+    for (i = 0; i < len; i++)
+        res[i] = vec1[i] ^ vec2[i];
+}
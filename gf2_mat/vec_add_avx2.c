@@ -0,0 +1,68 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+#if HAVE_AVX2
+
+#include <immintrin.h>
+
+__attribute__((target("avx2")))
+void _gf2_vec_add_avx2(mp_ptr res, mp_srcptr vec1, mp_srcptr vec2,
+                                                                  slong len)
+{
+    slong i;
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        __m256i a0, a1, b0, b1;
+
+        a0 = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+        a1 = _mm256_loadu_si256((const __m256i *) (vec1 + i + 4));
+        b0 = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+        b1 = _mm256_loadu_si256((const __m256i *) (vec2 + i + 4));
+        _mm256_storeu_si256((__m256i *) (res + i), _mm256_xor_si256(a0, b0));
+        _mm256_storeu_si256((__m256i *) (res + i + 4),
+                                                  _mm256_xor_si256(a1, b1));
+    }
+
+    for ( ; i < len; i++)
+        res[i] = vec1[i] ^ vec2[i];
+}
+
+#else
+
+void _gf2_vec_add_avx2(mp_ptr res, mp_srcptr vec1, mp_srcptr vec2,
+                                                                  slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        res[i] = vec1[i] ^ vec2[i];
+}
+
+#endif
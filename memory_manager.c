@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 The FLINT development team
 
 ******************************************************************************/
 
@@ -44,15 +45,71 @@ static void flint_memory_error()
     abort();
 }
 
-void * flint_malloc(size_t size)
+static void * _flint_malloc(size_t size)
 {
-   void * ptr;
+#if HAVE_GC
+    return GC_malloc(size);
+#else
+    return malloc(size);
+#endif
+}
 
+static void * _flint_realloc(void * ptr, size_t size)
+{
 #if HAVE_GC
-   ptr = GC_malloc(size);
+    return GC_realloc(ptr, size);
 #else
-   ptr = malloc(size);
+    return realloc(ptr, size);
 #endif
+}
+
+static void * _flint_calloc(size_t num, size_t size)
+{
+#if HAVE_GC
+    return GC_malloc(num*size);
+#else
+    return calloc(num, size);
+#endif
+}
+
+static void _flint_free(void * ptr)
+{
+#if !HAVE_GC
+    free(ptr);
+#endif
+}
+
+static void * (*__flint_allocate_func)(size_t) = _flint_malloc;
+static void * (*__flint_callocate_func)(size_t, size_t) = _flint_calloc;
+static void * (*__flint_reallocate_func)(void *, size_t) = _flint_realloc;
+static void (*__flint_free_func)(void *) = _flint_free;
+
+void __flint_set_memory_functions(void *(*alloc_func) (size_t),
+            void *(*calloc_func) (size_t, size_t),
+            void *(*realloc_func) (void *, size_t), void (*free_func) (void *))
+{
+    __flint_allocate_func = (alloc_func == NULL) ? _flint_malloc : alloc_func;
+    __flint_callocate_func =
+                        (calloc_func == NULL) ? _flint_calloc : calloc_func;
+    __flint_reallocate_func =
+                        (realloc_func == NULL) ? _flint_realloc : realloc_func;
+    __flint_free_func = (free_func == NULL) ? _flint_free : free_func;
+}
+
+void __flint_get_memory_functions(void *(**alloc_func) (size_t),
+            void *(**calloc_func) (size_t, size_t),
+            void *(**realloc_func) (void *, size_t),
+            void (**free_func) (void *))
+{
+    *alloc_func = __flint_allocate_func;
+    *calloc_func = __flint_callocate_func;
+    *realloc_func = __flint_reallocate_func;
+    *free_func = __flint_free_func;
+}
+
+void * flint_malloc(size_t size)
+{
+    void * ptr = (*__flint_allocate_func)(size);
 
     if (ptr == NULL)
         flint_memory_error();
@@ -62,13 +119,7 @@ void * flint_malloc(size_t size)
 
 void * flint_realloc(void * ptr, size_t size)
 {
-    void * ptr2;
-
-#if HAVE_GC
-    ptr2 = GC_realloc(ptr, size);
-#else
-    ptr2 = realloc(ptr, size);
-#endif
+    void * ptr2 = (*__flint_reallocate_func)(ptr, size);
 
     if (ptr2 == NULL)
         flint_memory_error();
@@ -78,13 +129,7 @@ void * flint_realloc(void * ptr, size_t size)
 
 void * flint_calloc(size_t num, size_t size)
 {
-   void * ptr;
-
-#if HAVE_GC
-    ptr = GC_malloc(num*size);
-#else
-    ptr = calloc(num, size);
-#endif
+    void * ptr = (*__flint_callocate_func)(num, size);
 
     if (ptr == NULL)
         flint_memory_error();
@@ -94,11 +139,134 @@ void * flint_calloc(size_t num, size_t size)
 
 void flint_free(void * ptr)
 {
-#if !HAVE_GC
-    free(ptr);
-#endif
+    (*__flint_free_func)(ptr);
 }
 
+#if HAVE_TLS
+
+/*
+    The scratch stack used by TMP_ALLOC for allocations too large for alloca.
+    It is a thread local list of chunks, each used as a bump allocator. A
+    TMP_START/TMP_END block records the position of the stack at its first
+    large allocation and rewinds to it at the end. Chunks above the top are
+    kept for reuse until flint_cleanup() is called, except very large ones,
+    which are returned to the allocator as soon as they are released.
+*/
+
+#define FLINT_STACK_ALIGN 16
+#define FLINT_STACK_CHUNK (WORD(1) << 16)
+#define FLINT_STACK_CHUNK_MAX (WORD(1) << 24)
+
+typedef struct flint_stack_chunk_struct
+{
+    struct flint_stack_chunk_struct * prev;
+    struct flint_stack_chunk_struct * next;
+    size_t size;
+    size_t used;
+} flint_stack_chunk_struct;
+
+static FLINT_TLS_PREFIX flint_stack_chunk_struct * flint_stack_top = NULL;
+
+static void _flint_stack_free_chunks(flint_stack_chunk_struct * c)
+{
+    flint_stack_chunk_struct * next;
+
+    while (c != NULL)
+    {
+        next = c->next;
+        flint_free(c);
+        c = next;
+    }
+}
+
+void * _flint_tmp_alloc(flint_tmp_mark_t mark, size_t size)
+{
+    flint_stack_chunk_struct * c = flint_stack_top, * d;
+    void * ptr;
+
+    size = (size + FLINT_STACK_ALIGN - 1) & ~((size_t) FLINT_STACK_ALIGN - 1);
+
+    if (!mark->active)
+    {
+        mark->chunk = c;
+        mark->used = (c == NULL) ? 0 : c->used;
+        mark->active = 1;
+    }
+
+    if (c == NULL || c->size - c->used < size)
+    {
+        d = (c == NULL) ? NULL : c->next;
+
+        if (d == NULL || d->size < size)
+        {
+            size_t n = (c == NULL) ? FLINT_STACK_CHUNK
+                                : FLINT_MIN(2*c->size, FLINT_STACK_CHUNK_MAX);
+
+            n = FLINT_MAX(n, size);
+
+            _flint_stack_free_chunks(d);
+
+            d = flint_malloc(sizeof(flint_stack_chunk_struct) + n);
+            d->prev = c;
+            d->next = NULL;
+            d->size = n;
+
+            if (c != NULL)
+                c->next = d;
+        }
+
+        d->used = 0;
+        flint_stack_top = c = d;
+    }
+
+    ptr = (char *) (c + 1) + c->used;
+    c->used += size;
+
+    return ptr;
+}
+
+void _flint_tmp_release(flint_tmp_mark_t mark)
+{
+    flint_stack_chunk_struct * c = mark->chunk, * d;
+
+    if (c == NULL)
+    {
+        for (c = flint_stack_top; c->prev != NULL; c = c->prev) ;
+        c->used = 0;
+    }
+    else
+        c->used = mark->used;
+
+    flint_stack_top = c;
+
+    for (d = c->next; d != NULL; d = d->next)
+    {
+        if (d->size > FLINT_STACK_CHUNK_MAX)
+        {
+            d->prev->next = NULL;
+            _flint_stack_free_chunks(d);
+            break;
+        }
+    }
+
+    mark->active = 0;
+}
+
+static void _flint_stack_cleanup(void)
+{
+    flint_stack_chunk_struct * c = flint_stack_top;
+
+    if (c != NULL)
+    {
+        while (c->prev != NULL)
+            c = c->prev;
+
+        _flint_stack_free_chunks(c);
+        flint_stack_top = NULL;
+    }
+}
+
+#endif
 
 FLINT_TLS_PREFIX size_t flint_num_cleanup_functions = 0;
 
@@ -149,6 +317,9 @@ void flint_cleanup()
 
     mpfr_free_cache();
     _fmpz_cleanup();
+#if HAVE_TLS
+    _flint_stack_cleanup();
+#endif
 
 #if FLINT_REENTRANT && !HAVE_TLS
     pthread_mutex_unlock(&register_lock);
@@ -141,6 +141,20 @@ FLINT_DLL void nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmo
 FLINT_DLL void _nmod_mat_mul_classical(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B, int op);
 
+FLINT_DLL void _nmod_mat_addmul_blocked(mp_ptr * D, const mp_ptr * C,
+                    const mp_ptr * A, const mp_ptr * B, slong m, slong k,
+                                              slong n, int op, nmod_t mod);
+
+FLINT_DLL void nmod_mat_mul_blocked(nmod_mat_t C, const nmod_mat_t A,
+                                                        const nmod_mat_t B);
+
+FLINT_DLL void _nmod_mat_addmul_double(mp_ptr * D, const mp_ptr * C,
+                    const mp_ptr * A, const mp_ptr * B, slong m, slong k,
+                                              slong n, int op, nmod_t mod);
+
+FLINT_DLL void nmod_mat_mul_double(nmod_mat_t C, const nmod_mat_t A,
+                                                        const nmod_mat_t B);
+
 FLINT_DLL void nmod_mat_addmul(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B);
 
@@ -184,6 +198,7 @@ FLINT_DLL void nmod_mat_solve_triu_classical(nmod_mat_t X, const nmod_mat_t U, c
 FLINT_DLL slong nmod_mat_lu(slong * P, nmod_mat_t A, int rank_check);
 FLINT_DLL slong nmod_mat_lu_classical(slong * P, nmod_mat_t A, int rank_check);
 FLINT_DLL slong nmod_mat_lu_recursive(slong * P, nmod_mat_t A, int rank_check);
+FLINT_DLL slong nmod_mat_pluq(slong * P, slong * Q, nmod_mat_t A);
 
 /* Nonsingular solving */
 
@@ -209,13 +224,37 @@ FLINT_DLL slong nmod_mat_nullspace(nmod_mat_t X, const nmod_mat_t A);
 /* Size at which pre-transposing becomes faster in classical multiplication */
 #define NMOD_MAT_MUL_TRANSPOSE_CUTOFF 20
 
-/* Strassen multiplication */
+/* Size at which blocked classical multiplication becomes faster, for
+   moduli of at most half a limb and for larger moduli */
+#define NMOD_MAT_MUL_BLOCKED_CUTOFF 16
+#define NMOD_MAT_MUL_BLOCKED_LARGE_CUTOFF 64
+
+/* m*k*n below which blocked multiplication uses a single thread */
+#define NMOD_MAT_MUL_BLOCKED_THREADED_CUTOFF 262144
+
+/* Largest moduli (in bits) for double precision multiplication, the
+   largest for which it replaces blocked multiplication, and the size from
+   which it does so */
+#define NMOD_MAT_MUL_DOUBLE_MAX_BITS 26
+#define NMOD_MAT_MUL_DOUBLE_AUTO_BITS 23
+#define NMOD_MAT_MUL_DOUBLE_CUTOFF 16
+
+/* Strassen multiplication, for larger moduli and above
+   NMOD_MAT_MUL_DOUBLE_AUTO_BITS */
 #define NMOD_MAT_MUL_STRASSEN_CUTOFF 256
+#define NMOD_MAT_MUL_DOUBLE_STRASSEN_CUTOFF 1024
+
+/* dimensions from which multiplication, rank and rref modulo 2 convert to
+   the bit-packed gf2_mat type */
+#define NMOD_MAT_GF2_CUTOFF 16
 
 /* Cutoff between classical and recursive triangular solving */
 #define NMOD_MAT_SOLVE_TRI_ROWS_CUTOFF 64
 #define NMOD_MAT_SOLVE_TRI_COLS_CUTOFF 64
 
+/* n*n*m below which classical triangular solving uses a single thread */
+#define NMOD_MAT_SOLVE_TRI_THREADED_CUTOFF 262144
+
 /* Cutoff between classical and recursive LU decomposition */
 #define NMOD_MAT_LU_RECURSIVE_CUTOFF 4
 
@@ -34,28 +34,46 @@
 #include "nmod_mat.h"
 
 
+/*
+   Applies the permutation P to rows offset, ..., offset + n - 1 of A and
+   to the corresponding entries of AP, so that the new row offset + i is
+   the old row offset + P[i]. The rows are moved in place by following
+   the cycles of P, which are marked by temporarily negating the entries
+   of P.
+*/
 static void
 _apply_permutation(slong * AP, nmod_mat_t A, slong * P,
     slong n, slong offset)
 {
-    if (n != 0)
-    {
-        mp_ptr * Atmp;
-        slong * APtmp;
-        slong i;
+    mp_ptr * rows = A->rows + offset;
+    slong i, j, k, t;
+    mp_ptr u;
+
+    AP += offset;
 
-        Atmp = flint_malloc(sizeof(mp_ptr) * n);
-        APtmp = flint_malloc(sizeof(slong) * n);
+    for (i = 0; i < n; i++)
+    {
+        if (P[i] < 0 || P[i] == i)
+            continue;
 
-        for (i = 0; i < n; i++) Atmp[i] = A->rows[P[i] + offset];
-        for (i = 0; i < n; i++) A->rows[i + offset] = Atmp[i];
+        u = rows[i];
+        t = AP[i];
 
-        for (i = 0; i < n; i++) APtmp[i] = AP[P[i] + offset];
-        for (i = 0; i < n; i++) AP[i + offset] = APtmp[i];
+        for (j = i; (k = P[j]) != i; j = k)
+        {
+            rows[j] = rows[k];
+            AP[j] = AP[k];
+            P[j] = -1 - k;
+        }
 
-        flint_free(Atmp);
-        flint_free(APtmp);
+        rows[j] = u;
+        AP[j] = t;
+        P[j] = -1 - i;
     }
+
+    for (i = 0; i < n; i++)
+        if (P[i] < 0)
+            P[i] = -1 - P[i];
 }
 
 
@@ -28,19 +28,39 @@
 #include "flint.h"
 #include "nmod_mat.h"
 #include "nmod_vec.h"
+#include "gf2_mat.h"
 
 void
 nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
 {
-    slong m, k, n;
+    slong m, k, n, cutoff;
 
     m = A->r;
     k = A->c;
     n = B->c;
 
-    if (m < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        n < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        k < NMOD_MAT_MUL_STRASSEN_CUTOFF)
+    if (A->mod.n == 2 && m >= NMOD_MAT_GF2_CUTOFF
+            && n >= NMOD_MAT_GF2_CUTOFF && k >= NMOD_MAT_GF2_CUTOFF)
+    {
+        gf2_mat_t A2, B2, C2;
+
+        gf2_mat_init(A2, m, k);
+        gf2_mat_init(B2, k, n);
+        gf2_mat_init(C2, m, n);
+        gf2_mat_set_nmod_mat(A2, A);
+        gf2_mat_set_nmod_mat(B2, B);
+        gf2_mat_mul(C2, A2, B2);
+        gf2_mat_get_nmod_mat(C, C2);
+        gf2_mat_clear(A2);
+        gf2_mat_clear(B2);
+        gf2_mat_clear(C2);
+        return;
+    }
+
+    cutoff = (FLINT_BIT_COUNT(A->mod.n) <= NMOD_MAT_MUL_DOUBLE_AUTO_BITS) ?
+        NMOD_MAT_MUL_DOUBLE_STRASSEN_CUTOFF : NMOD_MAT_MUL_STRASSEN_CUTOFF;
+
+    if (m < cutoff || n < cutoff || k < cutoff)
     {
         nmod_mat_mul_classical(C, A, B);
     }
@@ -0,0 +1,547 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_vec.h"
+#include "thread_pool.h"
+
+/*
+   Blocked classical multiplication in the style of BLIS. B is packed in
+   panels of KC rows and NC columns, stored as micro-panels of NR columns,
+   and A in blocks of MC rows and KC columns, stored as micro-panels of MR
+   rows, both zero padded. The micro-kernel multiplies an MR x KC
+   micro-panel of A by a KC x NR micro-panel of B without reductions,
+   which are done once per tile and KC block. The blocks of MC rows are
+   distributed between the threads.
+
+   With op = 0, computes D = A*B, with op = 1, D = C + A*B and with
+   op = -1, D = C - A*B. D may be aliased with C.
+*/
+
+#define MR 4
+#define NR 8
+#define KC 256
+#define MC 64
+#define NC 1024
+
+/* kinds of micro-kernel */
+#define KERNEL_LIMBS1 1     /* sums fit in one limb */
+#define KERNEL_LIMBS2 2     /* sums fit in two limbs */
+#define KERNEL_LIMBS3 3
+#define KERNEL_SPLIT 4      /* entries < 2^32, product halves summed apart */
+
+static void
+_pack_A(mp_ptr Ap, const mp_ptr * A, slong r0, slong mc, slong c0, slong kc)
+{
+    slong i, ir, p, mr;
+
+    for (ir = 0; ir < mc; ir += MR)
+    {
+        mr = FLINT_MIN(MR, mc - ir);
+
+        for (p = 0; p < kc; p++)
+        {
+            for (i = 0; i < mr; i++)
+                Ap[p * MR + i] = A[r0 + ir + i][c0 + p];
+            for ( ; i < MR; i++)
+                Ap[p * MR + i] = 0;
+        }
+
+        Ap += MR * kc;
+    }
+}
+
+static void
+_pack_B(mp_ptr Bp, const mp_ptr * B, slong r0, slong kc, slong c0, slong nc)
+{
+    slong j, jr, p, nr;
+
+    for (jr = 0; jr < nc; jr += NR)
+    {
+        nr = FLINT_MIN(NR, nc - jr);
+
+        for (p = 0; p < kc; p++)
+        {
+            mp_srcptr Brow = B[r0 + p] + c0 + jr;
+
+            for (j = 0; j < nr; j++)
+                Bp[p * NR + j] = Brow[j];
+            for ( ; j < NR; j++)
+                Bp[p * NR + j] = 0;
+        }
+
+        Bp += NR * kc;
+    }
+}
+
+/* generic micro-kernels, writing the reduced MR x NR tile to r */
+
+static void
+_micro_limbs1(mp_ptr r, mp_srcptr Ap, mp_srcptr Bp, slong kc, nmod_t mod)
+{
+    mp_limb_t c[MR * NR];
+    slong i, j, p;
+
+    for (i = 0; i < MR * NR; i++)
+        c[i] = 0;
+
+    for (p = 0; p < kc; p++)
+    {
+        for (i = 0; i < MR; i++)
+        {
+            mp_limb_t a = Ap[p * MR + i];
+
+            for (j = 0; j < NR; j++)
+                c[i * NR + j] += a * Bp[p * NR + j];
+        }
+    }
+
+    for (i = 0; i < MR * NR; i++)
+        NMOD_RED(r[i], c[i], mod);
+}
+
+/*
+   In the multi-limb kernels the tile is done as 2 x 2 sub-tiles, so that
+   the accumulators stay in registers.
+*/
+
+static void
+_micro_limbs2(mp_ptr r, mp_srcptr Ap, mp_srcptr Bp, slong kc, nmod_t mod)
+{
+    mp_limb_t h00, l00, h01, l01, h10, l10, h11, l11, s, t, a0, a1, b0, b1;
+    slong i, j, p;
+
+    for (i = 0; i < MR; i += 2)
+    {
+        for (j = 0; j < NR; j += 2)
+        {
+            h00 = l00 = h01 = l01 = h10 = l10 = h11 = l11 = 0;
+
+            for (p = 0; p < kc; p++)
+            {
+                a0 = Ap[p * MR + i];
+                a1 = Ap[p * MR + i + 1];
+                b0 = Bp[p * NR + j];
+                b1 = Bp[p * NR + j + 1];
+
+                umul_ppmm(s, t, a0, b0);
+                add_ssaaaa(h00, l00, h00, l00, s, t);
+                umul_ppmm(s, t, a0, b1);
+                add_ssaaaa(h01, l01, h01, l01, s, t);
+                umul_ppmm(s, t, a1, b0);
+                add_ssaaaa(h10, l10, h10, l10, s, t);
+                umul_ppmm(s, t, a1, b1);
+                add_ssaaaa(h11, l11, h11, l11, s, t);
+            }
+
+            NMOD2_RED2(r[i * NR + j], h00, l00, mod);
+            NMOD2_RED2(r[i * NR + j + 1], h01, l01, mod);
+            NMOD2_RED2(r[(i + 1) * NR + j], h10, l10, mod);
+            NMOD2_RED2(r[(i + 1) * NR + j + 1], h11, l11, mod);
+        }
+    }
+}
+
+static void
+_micro_limbs3(mp_ptr r, mp_srcptr Ap, mp_srcptr Bp, slong kc, nmod_t mod)
+{
+    mp_limb_t c00, h00, l00, c01, h01, l01, c10, h10, l10, c11, h11, l11;
+    mp_limb_t s, t, a0, a1, b0, b1;
+    slong i, j, p;
+
+    for (i = 0; i < MR; i += 2)
+    {
+        for (j = 0; j < NR; j += 2)
+        {
+            c00 = h00 = l00 = c01 = h01 = l01 = 0;
+            c10 = h10 = l10 = c11 = h11 = l11 = 0;
+
+            for (p = 0; p < kc; p++)
+            {
+                a0 = Ap[p * MR + i];
+                a1 = Ap[p * MR + i + 1];
+                b0 = Bp[p * NR + j];
+                b1 = Bp[p * NR + j + 1];
+
+                umul_ppmm(s, t, a0, b0);
+                add_sssaaaaaa(c00, h00, l00, c00, h00, l00, 0, s, t);
+                umul_ppmm(s, t, a0, b1);
+                add_sssaaaaaa(c01, h01, l01, c01, h01, l01, 0, s, t);
+                umul_ppmm(s, t, a1, b0);
+                add_sssaaaaaa(c10, h10, l10, c10, h10, l10, 0, s, t);
+                umul_ppmm(s, t, a1, b1);
+                add_sssaaaaaa(c11, h11, l11, c11, h11, l11, 0, s, t);
+            }
+
+            NMOD_RED3(r[i * NR + j], c00, h00, l00, mod);
+            NMOD_RED3(r[i * NR + j + 1], c01, h01, l01, mod);
+            NMOD_RED3(r[(i + 1) * NR + j], c10, h10, l10, mod);
+            NMOD_RED3(r[(i + 1) * NR + j + 1], c11, h11, l11, mod);
+        }
+    }
+}
+
+#if FLINT64
+
+/* combine the low and high halves summed by the split kernels */
+static __inline__ void
+_reduce_split(mp_ptr r, mp_srcptr lo, mp_srcptr hi, nmod_t mod)
+{
+    mp_limb_t s1, s0;
+    slong i;
+
+    for (i = 0; i < MR * NR; i++)
+    {
+        s1 = hi[i] >> 32;
+        s0 = hi[i] << 32;
+        add_ssaaaa(s1, s0, s1, s0, 0, lo[i]);
+        NMOD2_RED2(r[i], s1, s0, mod);
+    }
+}
+
+static void
+_micro_split(mp_ptr r, mp_srcptr Ap, mp_srcptr Bp, slong kc, nmod_t mod)
+{
+    mp_limb_t lo[MR * NR], hi[MR * NR], t;
+    slong i, j, p;
+
+    for (i = 0; i < MR * NR; i++)
+        lo[i] = hi[i] = 0;
+
+    for (p = 0; p < kc; p++)
+    {
+        for (i = 0; i < MR; i++)
+        {
+            mp_limb_t a = Ap[p * MR + i];
+
+            for (j = 0; j < NR; j++)
+            {
+                t = a * Bp[p * NR + j];
+                lo[i * NR + j] += (t & UWORD(0xffffffff));
+                hi[i * NR + j] += (t >> 32);
+            }
+        }
+    }
+
+    _reduce_split(r, lo, hi, mod);
+}
+
+#if HAVE_AVX2
+
+#include <immintrin.h>
+
+/* the entries are less than 2^32, so vpmuludq gives exact products */
+
+__attribute__((target("avx2")))
+static void
+_micro_limbs1_avx2(mp_ptr r, mp_srcptr Ap, mp_srcptr Bp, slong kc,
+                                                                nmod_t mod)
+{
+    __m256i c00, c01, c10, c11, c20, c21, c30, c31, b0, b1, a;
+    mp_limb_t c[MR * NR];
+    slong i, p;
+
+    c00 = c01 = c10 = c11 = _mm256_setzero_si256();
+    c20 = c21 = c30 = c31 = _mm256_setzero_si256();
+
+    for (p = 0; p < kc; p++)
+    {
+        b0 = _mm256_loadu_si256((const __m256i *) (Bp + p * NR));
+        b1 = _mm256_loadu_si256((const __m256i *) (Bp + p * NR + 4));
+
+        a = _mm256_set1_epi64x(Ap[p * MR + 0]);
+        c00 = _mm256_add_epi64(c00, _mm256_mul_epu32(a, b0));
+        c01 = _mm256_add_epi64(c01, _mm256_mul_epu32(a, b1));
+        a = _mm256_set1_epi64x(Ap[p * MR + 1]);
+        c10 = _mm256_add_epi64(c10, _mm256_mul_epu32(a, b0));
+        c11 = _mm256_add_epi64(c11, _mm256_mul_epu32(a, b1));
+        a = _mm256_set1_epi64x(Ap[p * MR + 2]);
+        c20 = _mm256_add_epi64(c20, _mm256_mul_epu32(a, b0));
+        c21 = _mm256_add_epi64(c21, _mm256_mul_epu32(a, b1));
+        a = _mm256_set1_epi64x(Ap[p * MR + 3]);
+        c30 = _mm256_add_epi64(c30, _mm256_mul_epu32(a, b0));
+        c31 = _mm256_add_epi64(c31, _mm256_mul_epu32(a, b1));
+    }
+
+    _mm256_storeu_si256((__m256i *) (c + 0), c00);
+    _mm256_storeu_si256((__m256i *) (c + 4), c01);
+    _mm256_storeu_si256((__m256i *) (c + 8), c10);
+    _mm256_storeu_si256((__m256i *) (c + 12), c11);
+    _mm256_storeu_si256((__m256i *) (c + 16), c20);
+    _mm256_storeu_si256((__m256i *) (c + 20), c21);
+    _mm256_storeu_si256((__m256i *) (c + 24), c30);
+    _mm256_storeu_si256((__m256i *) (c + 28), c31);
+
+    for (i = 0; i < MR * NR; i++)
+        NMOD_RED(r[i], c[i], mod);
+}
+
+#define SPLIT_ACC(lo, hi, a, b)                                     \
+    do {                                                            \
+        __m256i __t = _mm256_mul_epu32(a, b);                       \
+        lo = _mm256_add_epi64(lo, _mm256_and_si256(__t, mask));     \
+        hi = _mm256_add_epi64(hi, _mm256_srli_epi64(__t, 32));      \
+    } while (0)
+
+/* the two halves of the columns of the tile are done in separate passes */
+__attribute__((target("avx2")))
+static void
+_micro_split_avx2(mp_ptr r, mp_srcptr Ap, mp_srcptr Bp, slong kc,
+                                                                nmod_t mod)
+{
+    __m256i l0, l1, l2, l3, h0, h1, h2, h3, b, a, mask;
+    mp_limb_t lo[MR * NR], hi[MR * NR];
+    slong p, j;
+
+    mask = _mm256_set1_epi64x(WORD(0xffffffff));
+
+    for (j = 0; j < NR; j += 4)
+    {
+        l0 = l1 = l2 = l3 = h0 = h1 = h2 = h3 = _mm256_setzero_si256();
+
+        for (p = 0; p < kc; p++)
+        {
+            b = _mm256_loadu_si256((const __m256i *) (Bp + p * NR + j));
+
+            a = _mm256_set1_epi64x(Ap[p * MR + 0]);
+            SPLIT_ACC(l0, h0, a, b);
+            a = _mm256_set1_epi64x(Ap[p * MR + 1]);
+            SPLIT_ACC(l1, h1, a, b);
+            a = _mm256_set1_epi64x(Ap[p * MR + 2]);
+            SPLIT_ACC(l2, h2, a, b);
+            a = _mm256_set1_epi64x(Ap[p * MR + 3]);
+            SPLIT_ACC(l3, h3, a, b);
+        }
+
+        _mm256_storeu_si256((__m256i *) (lo + 0 * NR + j), l0);
+        _mm256_storeu_si256((__m256i *) (lo + 1 * NR + j), l1);
+        _mm256_storeu_si256((__m256i *) (lo + 2 * NR + j), l2);
+        _mm256_storeu_si256((__m256i *) (lo + 3 * NR + j), l3);
+        _mm256_storeu_si256((__m256i *) (hi + 0 * NR + j), h0);
+        _mm256_storeu_si256((__m256i *) (hi + 1 * NR + j), h1);
+        _mm256_storeu_si256((__m256i *) (hi + 2 * NR + j), h2);
+        _mm256_storeu_si256((__m256i *) (hi + 3 * NR + j), h3);
+    }
+
+    _reduce_split(r, lo, hi, mod);
+}
+
+#undef SPLIT_ACC
+
+#endif
+
+#endif
+
+typedef void (*_micro_func_t)(mp_ptr, mp_srcptr, mp_srcptr, slong, nmod_t);
+
+static _micro_func_t
+_micro_kernel(slong kc, nmod_t mod)
+{
+    int nlimbs = _nmod_vec_dot_bound_limbs(kc, mod);
+
+#if FLINT64
+    int small = (mod.n <= UWORD(1) << 32);
+
+#if HAVE_AVX2
+    if (small && (flint_get_cpu_features() & FLINT_CPU_AVX2))
+        return (nlimbs == 1) ? _micro_limbs1_avx2 : _micro_split_avx2;
+#endif
+
+    if (nlimbs != 1 && small)
+        return _micro_split;
+#endif
+
+    if (nlimbs == 1)
+        return _micro_limbs1;
+    else if (nlimbs == 2)
+        return _micro_limbs2;
+    else
+        return _micro_limbs3;
+}
+
+typedef struct
+{
+    mp_ptr * D;
+    const mp_ptr * C;
+    const mp_ptr * A;
+    mp_srcptr Bp;
+    mp_ptr Ap;
+    slong m;
+    slong start;        /* first and last blocks of MC rows */
+    slong end;
+    slong pc;
+    slong kc;
+    slong jc;
+    slong nc;
+    int op;
+    nmod_t mod;
+    _micro_func_t micro;
+} _blocked_arg_t;
+
+static void *
+_nmod_mat_addmul_blocked_worker(void * arg_ptr)
+{
+    _blocked_arg_t * arg = (_blocked_arg_t *) arg_ptr;
+    mp_ptr * D = arg->D;
+    const mp_ptr * C = arg->C;
+    slong ic, ir, jr, i, j, mc, mr, nr;
+    slong pc = arg->pc, kc = arg->kc, jc = arg->jc, nc = arg->nc;
+    nmod_t mod = arg->mod;
+    mp_limb_t r[MR * NR];
+    int op = arg->op;
+
+    for (ic = arg->start * MC; ic < arg->end * MC && ic < arg->m; ic += MC)
+    {
+        mc = FLINT_MIN(MC, arg->m - ic);
+
+        _pack_A(arg->Ap, arg->A, ic, mc, pc, kc);
+
+        for (jr = 0; jr < nc; jr += NR)
+        {
+            nr = FLINT_MIN(NR, nc - jr);
+
+            for (ir = 0; ir < mc; ir += MR)
+            {
+                mr = FLINT_MIN(MR, mc - ir);
+
+                arg->micro(r, arg->Ap + ir * kc, arg->Bp + jr * kc, kc, mod);
+
+                for (i = 0; i < mr; i++)
+                {
+                    mp_ptr Drow = D[ic + ir + i] + jc + jr;
+
+                    if (pc != 0)
+                    {
+                        if (op == -1)
+                            for (j = 0; j < nr; j++)
+                                Drow[j] = nmod_sub(Drow[j], r[i * NR + j], mod);
+                        else
+                            for (j = 0; j < nr; j++)
+                                Drow[j] = nmod_add(Drow[j], r[i * NR + j], mod);
+                    }
+                    else if (op == 0)
+                    {
+                        for (j = 0; j < nr; j++)
+                            Drow[j] = r[i * NR + j];
+                    }
+                    else
+                    {
+                        mp_srcptr Crow = C[ic + ir + i] + jc + jr;
+
+                        if (op == 1)
+                            for (j = 0; j < nr; j++)
+                                Drow[j] = nmod_add(Crow[j], r[i * NR + j], mod);
+                        else
+                            for (j = 0; j < nr; j++)
+                                Drow[j] = nmod_sub(Crow[j], r[i * NR + j], mod);
+                    }
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
+void
+_nmod_mat_addmul_blocked(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
+    const mp_ptr * B, slong m, slong k, slong n, int op, nmod_t mod)
+{
+    slong jc, pc, nc, kc, i, num_blocks, num_threads, num_tasks;
+    _blocked_arg_t * args;
+    mp_ptr Bp, Ap;
+
+    num_blocks = (m + MC - 1) / MC;
+
+    num_threads = flint_get_num_threads();
+    if (m * k * n < NMOD_MAT_MUL_BLOCKED_THREADED_CUTOFF)
+        num_threads = 1;
+    num_tasks = FLINT_MIN(num_threads, num_blocks);
+
+    Bp = flint_malloc(KC * (NC + NR) * sizeof(mp_limb_t));
+    Ap = flint_malloc(num_tasks * MC * KC * sizeof(mp_limb_t));
+    args = flint_malloc(num_tasks * sizeof(_blocked_arg_t));
+
+    for (i = 0; i < num_tasks; i++)
+    {
+        args[i].D = D;
+        args[i].C = C;
+        args[i].A = A;
+        args[i].Bp = Bp;
+        args[i].Ap = Ap + i * MC * KC;
+        args[i].m = m;
+        args[i].start = (i * num_blocks) / num_tasks;
+        args[i].end = ((i + 1) * num_blocks) / num_tasks;
+        args[i].op = op;
+        args[i].mod = mod;
+    }
+
+    for (jc = 0; jc < n; jc += NC)
+    {
+        nc = FLINT_MIN(NC, n - jc);
+
+        for (pc = 0; pc < k; pc += KC)
+        {
+            kc = FLINT_MIN(KC, k - pc);
+
+            _pack_B(Bp, B, pc, kc, jc, nc);
+
+            for (i = 0; i < num_tasks; i++)
+            {
+                args[i].pc = pc;
+                args[i].kc = kc;
+                args[i].jc = jc;
+                args[i].nc = nc;
+                args[i].micro = _micro_kernel(kc, mod);
+            }
+
+            flint_parallel_do(_nmod_mat_addmul_blocked_worker, args,
+                              sizeof(_blocked_arg_t), num_tasks);
+        }
+    }
+
+    flint_free(args);
+    flint_free(Ap);
+    flint_free(Bp);
+}
+
+void
+nmod_mat_mul_blocked(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
+{
+    if (A->c == 0)
+    {
+        nmod_mat_zero(C);
+        return;
+    }
+
+    if (A->r == 0 || B->c == 0)
+        return;
+
+    _nmod_mat_addmul_blocked(C->rows, NULL, A->rows, B->rows,
+                             A->r, A->c, B->c, 0, C->mod);
+}
@@ -65,8 +65,10 @@ _nmod_mat_addmul_transpose(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
     mp_ptr tmp;
     mp_limb_t c;
     slong i, j;
+    TMP_INIT;
 
-    tmp = flint_malloc(sizeof(mp_limb_t) * k * n);
+    TMP_START;
+    tmp = TMP_ALLOC(sizeof(mp_limb_t) * k * n);
 
     for (i = 0; i < k; i++)
         for (j = 0; j < n; j++)
@@ -87,7 +89,7 @@ _nmod_mat_addmul_transpose(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
         }
     }
 
-    flint_free(tmp);
+    TMP_END;
 }
 
 /* requires nlimbs = 1 */
@@ -176,7 +178,7 @@ void
 _nmod_mat_mul_classical(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B, int op)
 {
-    slong m, k, n;
+    slong m, k, n, cutoff;
     int nlimbs;
     nmod_t mod;
 
@@ -196,7 +198,22 @@ _nmod_mat_mul_classical(nmod_mat_t D, const nmod_mat_t C,
 
     nlimbs = _nmod_vec_dot_bound_limbs(k, mod);
 
-    if (nlimbs == 1 && m > 10 && k > 10 && n > 10)
+    cutoff = (mod.n <= (UWORD(1) << (FLINT_BITS / 2))) ?
+        NMOD_MAT_MUL_BLOCKED_CUTOFF : NMOD_MAT_MUL_BLOCKED_LARGE_CUTOFF;
+
+    if (m >= NMOD_MAT_MUL_DOUBLE_CUTOFF && k >= NMOD_MAT_MUL_DOUBLE_CUTOFF
+        && n >= NMOD_MAT_MUL_DOUBLE_CUTOFF
+        && FLINT_BIT_COUNT(mod.n) <= NMOD_MAT_MUL_DOUBLE_AUTO_BITS)
+    {
+        _nmod_mat_addmul_double(D->rows, (op == 0) ? NULL : C->rows,
+            A->rows, B->rows, m, k, n, op, D->mod);
+    }
+    else if (m >= cutoff && k >= cutoff && n >= cutoff)
+    {
+        _nmod_mat_addmul_blocked(D->rows, (op == 0) ? NULL : C->rows,
+            A->rows, B->rows, m, k, n, op, D->mod);
+    }
+    else if (nlimbs == 1 && m > 10 && k > 10 && n > 10)
     {
         _nmod_mat_addmul_packed(D->rows, (op == 0) ? NULL : C->rows,
             A->rows, B->rows, m, k, n, op, D->mod, nlimbs);
@@ -0,0 +1,422 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <math.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_vec.h"
+#include "thread_pool.h"
+
+/*
+   Blocked multiplication in double precision, for moduli of at most
+   NMOD_MAT_MUL_DOUBLE_MAX_BITS bits. The blocking is that of
+   _nmod_mat_addmul_blocked, but the packed buffers hold doubles and the
+   micro-kernel accumulates an MR x NR tile with (fused) multiply-adds.
+   Every kb terms, where kb (n - 1)^2 + n < 2^52, the accumulators are
+   reduced exactly: with q = floor(c / n), computed in floating point
+   and off by at most one, c - q n is an exact small integer.
+*/
+
+#define MR 6
+#define NR 8
+#define KC 256
+#define MC 96
+#define NC 1024
+
+static void
+_pack_A(double * Ap, const mp_ptr * A, slong r0, slong mc, slong c0,
+                                                                  slong kc)
+{
+    slong i, ir, p, mr;
+
+    for (ir = 0; ir < mc; ir += MR)
+    {
+        mr = FLINT_MIN(MR, mc - ir);
+
+        for (p = 0; p < kc; p++)
+        {
+            for (i = 0; i < mr; i++)
+                Ap[p * MR + i] = (double) A[r0 + ir + i][c0 + p];
+            for ( ; i < MR; i++)
+                Ap[p * MR + i] = 0.0;
+        }
+
+        Ap += MR * kc;
+    }
+}
+
+static void
+_pack_B(double * Bp, const mp_ptr * B, slong r0, slong kc, slong c0,
+                                                                  slong nc)
+{
+    slong j, jr, p, nr;
+
+    for (jr = 0; jr < nc; jr += NR)
+    {
+        nr = FLINT_MIN(NR, nc - jr);
+
+        for (p = 0; p < kc; p++)
+        {
+            mp_srcptr Brow = B[r0 + p] + c0 + jr;
+
+            for (j = 0; j < nr; j++)
+                Bp[p * NR + j] = (double) Brow[j];
+            for ( ; j < NR; j++)
+                Bp[p * NR + j] = 0.0;
+        }
+
+        Bp += NR * kc;
+    }
+}
+
+static __inline__ double
+_reduce_double(double c, double n, double ninv)
+{
+    double r = c - floor(c * ninv) * n;
+
+    if (r < 0.0)
+        r += n;
+    else if (r >= n)
+        r -= n;
+
+    return r;
+}
+
+static void
+_micro_double(mp_ptr r, const double * Ap, const double * Bp, slong kc,
+                                        slong kb, double n, double ninv)
+{
+    double c[MR * NR];
+    slong i, j, p, p0, p1;
+
+    for (i = 0; i < MR * NR; i++)
+        c[i] = 0.0;
+
+    for (p0 = 0; p0 < kc; p0 += kb)
+    {
+        p1 = FLINT_MIN(kc, p0 + kb);
+
+        for (p = p0; p < p1; p++)
+        {
+            for (i = 0; i < MR; i++)
+            {
+                double a = Ap[p * MR + i];
+
+                for (j = 0; j < NR; j++)
+                    c[i * NR + j] += a * Bp[p * NR + j];
+            }
+        }
+
+        for (i = 0; i < MR * NR; i++)
+            c[i] = _reduce_double(c[i], n, ninv);
+    }
+
+    for (i = 0; i < MR * NR; i++)
+        r[i] = (mp_limb_t) c[i];
+}
+
+#if HAVE_AVX2
+
+#include <immintrin.h>
+
+#define FMA_ROW(c0, c1, i)                                          \
+    do {                                                            \
+        a = _mm256_broadcast_sd(Ap + p * MR + (i));                 \
+        c0 = _mm256_fmadd_pd(a, b0, c0);                            \
+        c1 = _mm256_fmadd_pd(a, b1, c1);                            \
+    } while (0)
+
+#define FMA_RED(c)                                                  \
+    do {                                                            \
+        q = _mm256_floor_pd(_mm256_mul_pd(c, vninv));               \
+        c = _mm256_fnmadd_pd(q, vn, c);                             \
+        q = _mm256_cmp_pd(c, zero, _CMP_LT_OQ);                     \
+        c = _mm256_add_pd(c, _mm256_and_pd(q, vn));                 \
+        q = _mm256_cmp_pd(c, vn, _CMP_GE_OQ);                       \
+        c = _mm256_sub_pd(c, _mm256_and_pd(q, vn));                 \
+    } while (0)
+
+/* the 6 x 8 tile is held in 12 registers */
+__attribute__((target("avx2,fma")))
+static void
+_micro_double_fma(mp_ptr r, const double * Ap, const double * Bp,
+                              slong kc, slong kb, double n, double ninv)
+{
+    __m256d c00, c01, c10, c11, c20, c21, c30, c31, c40, c41, c50, c51;
+    __m256d a, b0, b1, q, vn, vninv, zero;
+    double c[MR * NR];
+    slong i, p, p0, p1;
+
+    vn = _mm256_set1_pd(n);
+    vninv = _mm256_set1_pd(ninv);
+    zero = _mm256_setzero_pd();
+
+    c00 = c01 = c10 = c11 = c20 = c21 = zero;
+    c30 = c31 = c40 = c41 = c50 = c51 = zero;
+
+    for (p0 = 0; p0 < kc; p0 += kb)
+    {
+        p1 = FLINT_MIN(kc, p0 + kb);
+
+        /* unrolling with -funroll-loops makes gcc spill the tile */
+#if defined(__GNUC__) && __GNUC__ >= 8 && !defined(__clang__)
+#pragma GCC unroll 1
+#endif
+        for (p = p0; p < p1; p++)
+        {
+            b0 = _mm256_loadu_pd(Bp + p * NR);
+            b1 = _mm256_loadu_pd(Bp + p * NR + 4);
+
+            FMA_ROW(c00, c01, 0);
+            FMA_ROW(c10, c11, 1);
+            FMA_ROW(c20, c21, 2);
+            FMA_ROW(c30, c31, 3);
+            FMA_ROW(c40, c41, 4);
+            FMA_ROW(c50, c51, 5);
+        }
+
+        FMA_RED(c00); FMA_RED(c01); FMA_RED(c10); FMA_RED(c11);
+        FMA_RED(c20); FMA_RED(c21); FMA_RED(c30); FMA_RED(c31);
+        FMA_RED(c40); FMA_RED(c41); FMA_RED(c50); FMA_RED(c51);
+    }
+
+    _mm256_storeu_pd(c + 0, c00);
+    _mm256_storeu_pd(c + 4, c01);
+    _mm256_storeu_pd(c + 8, c10);
+    _mm256_storeu_pd(c + 12, c11);
+    _mm256_storeu_pd(c + 16, c20);
+    _mm256_storeu_pd(c + 20, c21);
+    _mm256_storeu_pd(c + 24, c30);
+    _mm256_storeu_pd(c + 28, c31);
+    _mm256_storeu_pd(c + 32, c40);
+    _mm256_storeu_pd(c + 36, c41);
+    _mm256_storeu_pd(c + 40, c50);
+    _mm256_storeu_pd(c + 44, c51);
+
+    for (i = 0; i < MR * NR; i++)
+        r[i] = (mp_limb_t) c[i];
+}
+
+#undef FMA_ROW
+#undef FMA_RED
+
+#endif
+
+typedef void (*_micro_double_func_t)(mp_ptr, const double *, const double *,
+                                               slong, slong, double, double);
+
+typedef struct
+{
+    mp_ptr * D;
+    const mp_ptr * C;
+    const mp_ptr * A;
+    const double * Bp;
+    double * Ap;
+    slong m;
+    slong start;        /* first and last blocks of MC rows */
+    slong end;
+    slong pc;
+    slong kc;
+    slong kb;
+    slong jc;
+    slong nc;
+    int op;
+    nmod_t mod;
+    _micro_double_func_t micro;
+} _double_arg_t;
+
+static void *
+_nmod_mat_addmul_double_worker(void * arg_ptr)
+{
+    _double_arg_t * arg = (_double_arg_t *) arg_ptr;
+    mp_ptr * D = arg->D;
+    const mp_ptr * C = arg->C;
+    slong ic, ir, jr, i, j, mc, mr, nr;
+    slong pc = arg->pc, kc = arg->kc, jc = arg->jc, nc = arg->nc;
+    nmod_t mod = arg->mod;
+    double n = (double) mod.n, ninv = 1.0 / n;
+    mp_limb_t r[MR * NR];
+    int op = arg->op;
+
+    for (ic = arg->start * MC; ic < arg->end * MC && ic < arg->m; ic += MC)
+    {
+        mc = FLINT_MIN(MC, arg->m - ic);
+
+        _pack_A(arg->Ap, arg->A, ic, mc, pc, kc);
+
+        for (jr = 0; jr < nc; jr += NR)
+        {
+            nr = FLINT_MIN(NR, nc - jr);
+
+            for (ir = 0; ir < mc; ir += MR)
+            {
+                mr = FLINT_MIN(MR, mc - ir);
+
+                arg->micro(r, arg->Ap + ir * kc, arg->Bp + jr * kc, kc,
+                                                        arg->kb, n, ninv);
+
+                for (i = 0; i < mr; i++)
+                {
+                    mp_ptr Drow = D[ic + ir + i] + jc + jr;
+
+                    if (pc != 0)
+                    {
+                        if (op == -1)
+                            for (j = 0; j < nr; j++)
+                                Drow[j] = nmod_sub(Drow[j], r[i * NR + j], mod);
+                        else
+                            for (j = 0; j < nr; j++)
+                                Drow[j] = nmod_add(Drow[j], r[i * NR + j], mod);
+                    }
+                    else if (op == 0)
+                    {
+                        for (j = 0; j < nr; j++)
+                            Drow[j] = r[i * NR + j];
+                    }
+                    else
+                    {
+                        mp_srcptr Crow = C[ic + ir + i] + jc + jr;
+
+                        if (op == 1)
+                            for (j = 0; j < nr; j++)
+                                Drow[j] = nmod_add(Crow[j], r[i * NR + j], mod);
+                        else
+                            for (j = 0; j < nr; j++)
+                                Drow[j] = nmod_sub(Crow[j], r[i * NR + j], mod);
+                    }
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
+void
+_nmod_mat_addmul_double(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
+    const mp_ptr * B, slong m, slong k, slong n, int op, nmod_t mod)
+{
+    slong jc, pc, nc, kc, kb, i, num_blocks, num_threads, num_tasks;
+    _micro_double_func_t micro;
+    _double_arg_t * args;
+    double * Bp, * Ap;
+    char * buf;
+    double t;
+
+    /* number of terms that can be summed exactly before reducing */
+    t = (double) (mod.n - 1);
+    if (t == 0.0)
+        kb = KC;
+    else
+        kb = (slong) FLINT_MIN((double) KC,
+                       (ldexp(1.0, 52) - (double) mod.n) / (t * t));
+
+    micro = _micro_double;
+#if HAVE_AVX2
+    if ((flint_get_cpu_features() & (FLINT_CPU_AVX2 | FLINT_CPU_FMA))
+                                        == (FLINT_CPU_AVX2 | FLINT_CPU_FMA))
+        micro = _micro_double_fma;
+#endif
+
+    num_blocks = (m + MC - 1) / MC;
+
+    num_threads = flint_get_num_threads();
+    if (m * k * n < NMOD_MAT_MUL_BLOCKED_THREADED_CUTOFF)
+        num_threads = 1;
+    num_tasks = FLINT_MIN(num_threads, num_blocks);
+
+    /* the packed panels are aligned so that no load crosses a cache line */
+    buf = flint_malloc((KC * (NC + NR) + num_tasks * MC * KC) * sizeof(double)
+                                                                      + 64);
+    Bp = (double *) (buf + 64 - ((size_t) buf % 64));
+    Ap = Bp + KC * (NC + NR);
+    args = flint_malloc(num_tasks * sizeof(_double_arg_t));
+
+    for (i = 0; i < num_tasks; i++)
+    {
+        args[i].D = D;
+        args[i].C = C;
+        args[i].A = A;
+        args[i].Bp = Bp;
+        args[i].Ap = Ap + i * MC * KC;
+        args[i].m = m;
+        args[i].start = (i * num_blocks) / num_tasks;
+        args[i].end = ((i + 1) * num_blocks) / num_tasks;
+        args[i].kb = kb;
+        args[i].op = op;
+        args[i].mod = mod;
+        args[i].micro = micro;
+    }
+
+    for (jc = 0; jc < n; jc += NC)
+    {
+        nc = FLINT_MIN(NC, n - jc);
+
+        for (pc = 0; pc < k; pc += KC)
+        {
+            kc = FLINT_MIN(KC, k - pc);
+
+            _pack_B(Bp, B, pc, kc, jc, nc);
+
+            for (i = 0; i < num_tasks; i++)
+            {
+                args[i].pc = pc;
+                args[i].kc = kc;
+                args[i].jc = jc;
+                args[i].nc = nc;
+            }
+
+            flint_parallel_do(_nmod_mat_addmul_double_worker, args,
+                              sizeof(_double_arg_t), num_tasks);
+        }
+    }
+
+    flint_free(args);
+    flint_free(buf);
+}
+
+void
+nmod_mat_mul_double(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
+{
+    if (FLINT_BIT_COUNT(C->mod.n) > NMOD_MAT_MUL_DOUBLE_MAX_BITS)
+    {
+        flint_printf("Exception (nmod_mat_mul_double). Modulus too large.\n");
+        abort();
+    }
+
+    if (A->c == 0)
+    {
+        nmod_mat_zero(C);
+        return;
+    }
+
+    if (A->r == 0 || B->c == 0)
+        return;
+
+    _nmod_mat_addmul_double(C->rows, NULL, A->rows, B->rows,
+                            A->r, A->c, B->c, 0, C->mod);
+}
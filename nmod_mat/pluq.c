@@ -0,0 +1,81 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+
+slong
+nmod_mat_pluq(slong * P, slong * Q, nmod_mat_t A)
+{
+    slong i, j, k, n, rank;
+    slong * pivots;
+    slong * nonpivots;
+    mp_ptr tmp;
+
+    n = A->c;
+
+    rank = nmod_mat_lu(P, A, 0);
+
+    pivots = Q;
+    nonpivots = Q + rank;
+
+    /* The pivots of the rows of U in echelon form give the column rank
+       profile; row i of A holds L in the columns before i, so the search
+       only starts after the previous pivot. */
+    for (i = j = k = 0; i < rank; i++)
+    {
+        while (nmod_mat_entry(A, i, j) == UWORD(0))
+            nonpivots[k++] = j++;
+        pivots[i] = j++;
+    }
+
+    while (k < n - rank)
+        nonpivots[k++] = j++;
+
+    if (rank == 0 || rank == n)
+        return rank;
+
+    /* Permute the columns of U, leaving L untouched. Entries of row i of U
+       in columns before its pivot are zero and may be stored parts of L. */
+    tmp = _nmod_vec_init(n);
+
+    for (i = 0; i < rank; i++)
+    {
+        mp_ptr row = A->rows[i];
+
+        for (k = i; k < n; k++)
+            tmp[k] = (Q[k] >= pivots[i]) ? row[Q[k]] : UWORD(0);
+
+        for (k = i; k < n; k++)
+            row[k] = tmp[k];
+    }
+
+    _nmod_vec_clear(tmp);
+
+    return rank;
+}
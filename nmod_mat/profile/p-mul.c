@@ -59,9 +59,15 @@ void sample(void * arg, ulong count)
     else if (algorithm == 1)
         for (i = 0; i < count; i++)
             nmod_mat_mul_classical(C, A, B);
-    else
+    else if (algorithm == 2)
         for (i = 0; i < count; i++)
             nmod_mat_mul_strassen(C, A, B);
+    else if (algorithm == 3)
+        for (i = 0; i < count; i++)
+            nmod_mat_mul_blocked(C, A, B);
+    else
+        for (i = 0; i < count; i++)
+            nmod_mat_mul_double(C, A, B);
 
     prof_stop();
 
@@ -74,7 +80,7 @@ void sample(void * arg, ulong count)
 
 int main(void)
 {
-    double min_classical, min_strassen, max;
+    double min_classical, min_strassen, min_blocked, min_double, max;
     mat_mul_t params;
     slong dim;
 
@@ -92,8 +98,15 @@ int main(void)
         params.algorithm = 2;
         prof_repeat(&min_strassen, &max, sample, &params);
 
-        flint_printf("dim = %wd, classical %.2f us strassen %.2f us\n", 
-            dim, min_classical, min_strassen);
+        params.algorithm = 3;
+        prof_repeat(&min_blocked, &max, sample, &params);
+
+        params.algorithm = 4;
+        prof_repeat(&min_double, &max, sample, &params);
+
+        flint_printf("dim = %wd, classical %.2f us strassen %.2f us "
+            "blocked %.2f us double %.2f us\n", dim, min_classical,
+            min_strassen, min_blocked, min_double);
     }
 
     return 0;
@@ -28,6 +28,7 @@
 #include "ulong_extras.h"
 #include "nmod_vec.h"
 #include "nmod_mat.h"
+#include "gf2_mat.h"
 
 
 slong
@@ -43,6 +44,17 @@ nmod_mat_rank(const nmod_mat_t A)
     if (m == 0 || n == 0)
         return 0;
 
+    if (A->mod.n == 2 && m >= NMOD_MAT_GF2_CUTOFF && n >= NMOD_MAT_GF2_CUTOFF)
+    {
+        gf2_mat_t B;
+
+        gf2_mat_init(B, m, n);
+        gf2_mat_set_nmod_mat(B, A);
+        rank = gf2_mat_rank(B);
+        gf2_mat_clear(B);
+        return rank;
+    }
+
     nmod_mat_init_set(tmp, A);
     perm = flint_malloc(sizeof(slong) * m);
 
@@ -26,95 +26,58 @@
 #include <stdlib.h>
 #include <gmp.h>
 #include "flint.h"
+#include "nmod_vec.h"
 #include "nmod_mat.h"
 #include "perm.h"
+#include "gf2_mat.h"
 
 slong
 _nmod_mat_rref(nmod_mat_t A, slong * pivots_nonpivots, slong * P)
 {
-    slong i, j, k, n, rank;
-    slong * pivots;
-    slong * nonpivots;
-
+    slong i, j, m, n, rank;
     nmod_mat_t U, V;
+    mp_ptr tmp;
 
+    m = A->r;
     n = A->c;
 
-    rank = nmod_mat_lu(P, A, 0);
+    rank = nmod_mat_pluq(P, pivots_nonpivots, A);
 
     if (rank == 0)
-    {
-        for (i = 0; i < n; i++)
-            pivots_nonpivots[i] = i;
         return rank;
-    }
-
-    /* Clear L */
-    for (i = 0; i < A->r; i++)
-        for (j = 0; j < FLINT_MIN(i, rank); j++)
-            nmod_mat_entry(A, i, j) = UWORD(0);
-
-    /* We now reorder U to proper upper triangular form U | V
-       with U full-rank triangular, set V = U^(-1) V, and then
-       put the column back in the original order.
-
-       An improvement for some matrices would be to compress V by
-       discarding columns containing nothing but zeros. */
 
-    nmod_mat_init(U, rank, rank, A->mod.n);
-    nmod_mat_init(V, rank, n - rank, A->mod.n);
+    /* The first rank rows of A now hold U | V in the column order given by
+       pivots_nonpivots, with U full-rank upper triangular. We set
+       V = U^(-1) V in place, and then put the columns back in the
+       original order. */
 
-    pivots = pivots_nonpivots;
-    nonpivots = pivots_nonpivots + rank;
-
-    for (i = j = k = 0; i < rank; i++)
-    {
-        while (nmod_mat_entry(A, i, j) == UWORD(0))
-        {
-            nonpivots[k] = j;
-            k++;
-            j++;
-        }
-        pivots[i] = j;
-        j++;
-    }
-    while (k < n - rank)
+    if (rank < n)
     {
-        nonpivots[k] = j;
-        k++;
-        j++;
+        nmod_mat_window_init(U, A, 0, 0, rank, rank);
+        nmod_mat_window_init(V, A, 0, rank, rank, n);
+        nmod_mat_solve_triu(V, U, V, 0);
+        nmod_mat_window_clear(U);
+        nmod_mat_window_clear(V);
     }
 
-    for (i = 0; i < rank; i++)
-    {
-        for (j = 0; j <= i; j++)
-            nmod_mat_entry(U, j, i) = nmod_mat_entry(A, j, pivots[i]);
-    }
+    tmp = _nmod_vec_init(n);
 
-    for (i = 0; i < n - rank; i++)
+    for (i = 0; i < rank; i++)
     {
         for (j = 0; j < rank; j++)
-            nmod_mat_entry(V, j, i) = nmod_mat_entry(A, j, nonpivots[i]);
-    }
+            tmp[pivots_nonpivots[j]] = (i == j);
 
-    nmod_mat_solve_triu(V, U, V, 0);
+        for (j = rank; j < n; j++)
+            tmp[pivots_nonpivots[j]] = nmod_mat_entry(A, i, j);
 
-    /* Clear pivot columns */
-    for (i = 0; i < rank; i++)
-    {
-        for (j = 0; j <= i; j++)
-            nmod_mat_entry(A, j, pivots[i]) = (i == j);
+        _nmod_vec_set(A->rows[i], tmp, n);
     }
 
-    /* Write back the actual content */
-    for (i = 0; i < n - rank; i++)
-    {
-        for (j = 0; j < rank; j++)
-            nmod_mat_entry(A, j, nonpivots[i]) = nmod_mat_entry(V, j, i);
-    }
+    _nmod_vec_clear(tmp);
 
-    nmod_mat_clear(U);
-    nmod_mat_clear(V);
+    /* Clear L */
+    for (i = rank; i < m; i++)
+        _nmod_vec_zero(A->rows[i], n);
 
     return rank;
 }
@@ -123,6 +86,20 @@ slong
 nmod_mat_rref(nmod_mat_t A)
 {
     slong rank, * pivots_nonpivots, * P;
+
+    if (A->mod.n == 2 && A->r >= NMOD_MAT_GF2_CUTOFF
+                      && A->c >= NMOD_MAT_GF2_CUTOFF)
+    {
+        gf2_mat_t B;
+
+        gf2_mat_init(B, A->r, A->c);
+        gf2_mat_set_nmod_mat(B, A);
+        rank = gf2_mat_rref(B);
+        gf2_mat_get_nmod_mat(A, B);
+        gf2_mat_clear(B);
+        return rank;
+    }
+
     pivots_nonpivots = flint_malloc(sizeof(slong) * A->c);
     P = _perm_init(nmod_mat_nrows(A));
 
@@ -28,33 +28,42 @@
 #include "flint.h"
 #include "nmod_mat.h"
 #include "nmod_vec.h"
+#include "thread_pool.h"
 
-void
-nmod_mat_solve_triu_classical(nmod_mat_t X, const nmod_mat_t U,
-                                                const nmod_mat_t B, int unit)
+/*
+   The columns of B are solved independently, so they are split into
+   contiguous ranges which are distributed between the threads.
+*/
+
+typedef struct
 {
+    nmod_mat_struct * X;
+    const nmod_mat_struct * U;
+    const nmod_mat_struct * B;
+    mp_srcptr inv;
+    slong start;
+    slong end;
+    int unit;
     int nlimbs;
-    slong i, j, n, m;
-    nmod_t mod;
-    mp_ptr inv, tmp;
-
-    n = U->r;
-    m = B->c;
-    mod = U->mod;
+} _solve_triu_arg_t;
 
-    if (!unit)
-    {
-        inv = _nmod_vec_init(n);
-        for (i = 0; i < n; i++)
-            inv[i] = n_invmod(nmod_mat_entry(U, i, i), mod.n);
-    }
-    else
-        inv = NULL;
+static void *
+_nmod_mat_solve_triu_classical_worker(void * arg_ptr)
+{
+    _solve_triu_arg_t arg = *((_solve_triu_arg_t *) arg_ptr);
+    nmod_mat_struct * X = arg.X;
+    const nmod_mat_struct * U = arg.U;
+    const nmod_mat_struct * B = arg.B;
+    mp_srcptr inv = arg.inv;
+    int unit = arg.unit;
+    int nlimbs = arg.nlimbs;
+    nmod_t mod = U->mod;
+    slong i, j, n = U->r;
+    mp_ptr tmp;
 
-    nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
     tmp = _nmod_vec_init(n);
 
-    for (i = 0; i < m; i++)
+    for (i = arg.start; i < arg.end; i++)
     {
         for (j = 0; j < n; j++)
             tmp[j] = nmod_mat_entry(X, j, i);
@@ -75,6 +84,58 @@ nmod_mat_solve_triu_classical(nmod_mat_t X, const nmod_mat_t U,
     }
 
     _nmod_vec_clear(tmp);
+
+    return NULL;
+}
+
+void
+nmod_mat_solve_triu_classical(nmod_mat_t X, const nmod_mat_t U,
+                                                const nmod_mat_t B, int unit)
+{
+    slong i, n, m, num_threads, num_tasks;
+    _solve_triu_arg_t * args;
+    nmod_t mod;
+    mp_ptr inv;
+
+    n = U->r;
+    m = B->c;
+    mod = U->mod;
+
+    if (n == 0 || m == 0)
+        return;
+
+    if (!unit)
+    {
+        inv = _nmod_vec_init(n);
+        for (i = 0; i < n; i++)
+            inv[i] = n_invmod(nmod_mat_entry(U, i, i), mod.n);
+    }
+    else
+        inv = NULL;
+
+    num_threads = flint_get_num_threads();
+    if (n * n * m < NMOD_MAT_SOLVE_TRI_THREADED_CUTOFF)
+        num_threads = 1;
+    num_tasks = FLINT_MIN(num_threads, m);
+
+    args = flint_malloc(num_tasks * sizeof(_solve_triu_arg_t));
+
+    for (i = 0; i < num_tasks; i++)
+    {
+        args[i].X = X;
+        args[i].U = U;
+        args[i].B = B;
+        args[i].inv = inv;
+        args[i].start = (i * m) / num_tasks;
+        args[i].end = ((i + 1) * m) / num_tasks;
+        args[i].unit = unit;
+        args[i].nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
+    }
+
+    flint_parallel_do(_nmod_mat_solve_triu_classical_worker, args,
+                      sizeof(_solve_triu_arg_t), num_tasks);
+
+    flint_free(args);
     if (!unit)
         _nmod_vec_clear(inv);
 }
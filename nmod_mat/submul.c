@@ -33,15 +33,16 @@ void
 nmod_mat_submul(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B)
 {
-    slong m, k, n;
+    slong m, k, n, cutoff;
 
     m = A->r;
     k = A->c;
     n = B->c;
 
-    if (m < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        n < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        k < NMOD_MAT_MUL_STRASSEN_CUTOFF)
+    cutoff = (FLINT_BIT_COUNT(A->mod.n) <= NMOD_MAT_MUL_DOUBLE_AUTO_BITS) ?
+        NMOD_MAT_MUL_DOUBLE_STRASSEN_CUTOFF : NMOD_MAT_MUL_STRASSEN_CUTOFF;
+
+    if (m < cutoff || n < cutoff || k < cutoff)
     {
         _nmod_mat_mul_classical(D, C, A, B, -1);
     }
@@ -0,0 +1,183 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+
+/* D = C + op*A*B */
+void
+nmod_mat_addmul_check(nmod_mat_t D, const nmod_mat_t C,
+                      const nmod_mat_t A, const nmod_mat_t B, int op)
+{
+    slong i, j, k;
+
+    mp_limb_t s0, s1, s2;
+    mp_limb_t t0, t1;
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < B->c; j++)
+        {
+            s0 = s1 = s2 = UWORD(0);
+
+            for (k = 0; k < A->c; k++)
+            {
+                umul_ppmm(t1, t0, A->rows[i][k], B->rows[k][j]);
+                add_sssaaaaaa(s2, s1, s0, s2, s1, s0, 0, t1, t0);
+            }
+
+            NMOD_RED(s2, s2, D->mod);
+            NMOD_RED3(s0, s2, s1, s0, D->mod);
+
+            if (op == 1)
+                s0 = nmod_add(C->rows[i][j], s0, D->mod);
+            else if (op == -1)
+                s0 = nmod_sub(C->rows[i][j], s0, D->mod);
+
+            D->rows[i][j] = s0;
+        }
+    }
+}
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_blocked....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, B, C, D, E;
+        mp_limb_t mod;
+        slong m, k, n, num_threads;
+        int op;
+
+        if (n_randint(state, 10) == 0)
+        {
+            m = n_randint(state, 300) + 1;
+            k = n_randint(state, 600) + 1;
+            n = n_randint(state, 300) + 1;
+        }
+        else
+        {
+            m = n_randint(state, 80) + 1;
+            k = n_randint(state, 80) + 1;
+            n = n_randint(state, 80) + 1;
+        }
+
+        /* moduli close to the limits of the different kernels */
+        switch (n_randint(state, 5))
+        {
+            case 0:
+                mod = n_randtest_not_zero(state);
+                break;
+            case 1:
+                mod = (UWORD(1) << (FLINT_BITS / 2)) - n_randbits(state, 4);
+                break;
+            case 2:
+                mod = (UWORD(1) << (FLINT_BITS / 2)) + n_randbits(state, 4);
+                break;
+            case 3:
+                mod = UWORD_MAX/2 + 1 - n_randbits(state, 4);
+                break;
+            default:
+                mod = UWORD_MAX - n_randbits(state, 4);
+                break;
+        }
+
+        op = (int) n_randint(state, 3) - 1;
+
+        num_threads = n_randint(state, 4) + 1;
+        flint_set_num_threads(num_threads);
+
+        nmod_mat_init(A, m, k, mod);
+        nmod_mat_init(B, k, n, mod);
+        nmod_mat_init(C, m, n, mod);
+        nmod_mat_init(D, m, n, mod);
+        nmod_mat_init(E, m, n, mod);
+
+        if (n_randint(state, 2))
+            nmod_mat_randtest(A, state);
+        else
+            nmod_mat_randfull(A, state);
+
+        if (n_randint(state, 2))
+            nmod_mat_randtest(B, state);
+        else
+            nmod_mat_randfull(B, state);
+
+        nmod_mat_randtest(C, state);
+        nmod_mat_set(D, C);
+
+        nmod_mat_addmul_check(E, C, A, B, op);
+
+        /* with D aliased with C */
+        _nmod_mat_addmul_blocked(D->rows, (op == 0) ? NULL : D->rows,
+                                 A->rows, B->rows, m, k, n, op, D->mod);
+
+        if (!nmod_mat_equal(D, E))
+        {
+            flint_printf("FAIL: results not equal\n");
+            flint_printf("m = %wd, k = %wd, n = %wd, mod = %wu, op = %d\n",
+                         m, k, n, mod, op);
+            abort();
+        }
+
+        if (op == 0)
+        {
+            nmod_mat_randtest(D, state);
+            nmod_mat_mul_blocked(D, A, B);
+
+            if (!nmod_mat_equal(D, E))
+            {
+                flint_printf("FAIL: nmod_mat_mul_blocked\n");
+                flint_printf("m = %wd, k = %wd, n = %wd, mod = %wu\n",
+                             m, k, n, mod);
+                abort();
+            }
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_mat_clear(D);
+        nmod_mat_clear(E);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,195 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+
+/* checks that LU = PAQ and that the pivots are the column rank profile */
+void check(const slong * P, const slong * Q, const nmod_mat_t LU,
+                                                const nmod_mat_t A, slong rank)
+{
+    nmod_mat_t B, L, U, W;
+    slong m, n, i, j, r;
+
+    m = A->r;
+    n = A->c;
+
+    nmod_mat_init(B, m, n, A->mod.n);
+    nmod_mat_init(L, m, rank, A->mod.n);
+    nmod_mat_init(U, rank, n, A->mod.n);
+
+    for (i = 0; i < m; i++)
+    {
+        for (j = 0; j < FLINT_MIN(i, rank); j++)
+            nmod_mat_entry(L, i, j) = nmod_mat_entry(LU, i, j);
+        if (i < rank)
+            nmod_mat_entry(L, i, i) = UWORD(1);
+        for (j = FLINT_MIN(i, rank); j < n; j++)
+        {
+            if (i < rank && j >= i)
+                nmod_mat_entry(U, i, j) = nmod_mat_entry(LU, i, j);
+            else if (nmod_mat_entry(LU, i, j) != 0)
+            {
+                flint_printf("FAIL: wrong shape!\n");
+                abort();
+            }
+        }
+        if (i < rank && nmod_mat_entry(U, i, i) == 0)
+        {
+            flint_printf("FAIL: zero pivot!\n");
+            abort();
+        }
+    }
+
+    if (rank != 0)
+        nmod_mat_mul(B, L, U);
+
+    for (i = 0; i < m; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            if (nmod_mat_entry(B, i, j) != nmod_mat_entry(A, P[i], Q[j]))
+            {
+                flint_printf("FAIL: LU != PAQ\n");
+                flint_printf("A:\n");
+                nmod_mat_print_pretty(A);
+                flint_printf("LU:\n");
+                nmod_mat_print_pretty(LU);
+                abort();
+            }
+        }
+    }
+
+    /* column i is a pivot iff it increases the rank of the columns before,
+       and the other columns follow in increasing order */
+    for (i = r = 0; i < n; i++)
+    {
+        nmod_mat_window_init(W, A, 0, 0, m, i + 1);
+        j = nmod_mat_rank(W);
+        nmod_mat_window_clear(W);
+
+        if ((j > r) != (r < rank && Q[r] == i))
+        {
+            flint_printf("FAIL: wrong rank profile!\n");
+            abort();
+        }
+
+        r = j;
+    }
+
+    for (i = rank + 1; i < n; i++)
+    {
+        if (Q[i] <= Q[i - 1])
+        {
+            flint_printf("FAIL: wrong order of nonpivots!\n");
+            abort();
+        }
+    }
+
+    nmod_mat_clear(B);
+    nmod_mat_clear(L);
+    nmod_mat_clear(U);
+}
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("pluq....");
+    fflush(stdout);
+
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, LU;
+        mp_limb_t mod;
+        slong m, n, r, d, rank, num_threads;
+        slong * P, * Q;
+
+        if (n_randint(state, 25) == 0)
+        {
+            m = n_randint(state, 100) + 1;
+            n = n_randint(state, 100) + 1;
+        }
+        else
+        {
+            m = n_randint(state, 30);
+            n = n_randint(state, 30);
+        }
+
+        mod = n_randtest_prime(state, 0);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+
+        num_threads = n_randint(state, 4) + 1;
+        flint_set_num_threads(num_threads);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_randrank(A, state, r);
+
+        if (n_randint(state, 2))
+        {
+            d = n_randint(state, 2*m*n + 1);
+            nmod_mat_randops(A, d, state);
+        }
+
+        nmod_mat_init_set(LU, A);
+        P = flint_malloc(sizeof(slong) * m);
+        Q = flint_malloc(sizeof(slong) * n);
+
+        rank = nmod_mat_pluq(P, Q, LU);
+
+        if (r != rank)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("wrong rank!\n");
+            flint_printf("A:");
+            nmod_mat_print_pretty(A);
+            flint_printf("LU:");
+            nmod_mat_print_pretty(LU);
+            abort();
+        }
+
+        check(P, Q, LU, A, rank);
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(LU);
+        flint_free(P);
+        flint_free(Q);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -53,6 +53,8 @@ main(void)
         cols = n_randint(state, 100);
         unit = n_randint(state, 2);
 
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         nmod_mat_init(A, rows, rows, m);
         nmod_mat_init(B, rows, cols, m);
         nmod_mat_init(X, rows, cols, m);
@@ -97,6 +99,8 @@ main(void)
         nmod_mat_clear(Y);
     }
 
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -0,0 +1,159 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#ifndef NMOD_MONT_H
+#define NMOD_MONT_H
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "longlong.h"
+#include "ulong_extras.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Montgomery arithmetic modulo an odd n < 2^(FLINT_BITS - 2). A residue a
+    is represented by any x in [0, 2n) with x = a * 2^FLINT_BITS mod n, so
+    that products of represented values need no final correction.
+    ninv = n^(-1) mod 2^FLINT_BITS, one = 2^FLINT_BITS mod n and
+    r2 = 2^(2 FLINT_BITS) mod n.
+*/
+typedef struct
+{
+    mp_limb_t n;
+    mp_limb_t ninv;
+    mp_limb_t one;
+    mp_limb_t r2;
+} nmod_mont_struct;
+
+typedef nmod_mont_struct nmod_mont_t[1];
+
+#define NMOD_MONT_MAX_BITS (FLINT_BITS - 2)
+
+/* exponents from which n_powmod2_ui_preinv converts to Montgomery form */
+#define NMOD_MONT_POW_CUTOFF 64
+
+/* Context *******************************************************************/
+
+FLINT_DLL void nmod_mont_init(nmod_mont_t ctx, mp_limb_t n);
+
+FLINT_DLL void nmod_mont_init_preinv(nmod_mont_t ctx, mp_limb_t n,
+                                                          mp_limb_t npre);
+
+/* Arithmetic ****************************************************************/
+
+/* returns x * y * 2^(-FLINT_BITS) mod n in (0, 2n), given x * y < 2^B n */
+static __inline__
+mp_limb_t nmod_mont_mul(mp_limb_t x, mp_limb_t y, const nmod_mont_t ctx)
+{
+    mp_limb_t hi, lo, mh, ml;
+
+    umul_ppmm(hi, lo, x, y);
+    umul_ppmm(mh, ml, lo * ctx->ninv, ctx->n);
+
+    return hi - mh + ctx->n;
+}
+
+static __inline__
+mp_limb_t nmod_mont_sqr(mp_limb_t x, const nmod_mont_t ctx)
+{
+    return nmod_mont_mul(x, x, ctx);
+}
+
+static __inline__
+mp_limb_t nmod_mont_add(mp_limb_t x, mp_limb_t y, const nmod_mont_t ctx)
+{
+    mp_limb_t s = x + y;
+
+    return (s >= 2 * ctx->n) ? s - 2 * ctx->n : s;
+}
+
+static __inline__
+mp_limb_t nmod_mont_sub(mp_limb_t x, mp_limb_t y, const nmod_mont_t ctx)
+{
+    return (x < y) ? x - y + 2 * ctx->n : x - y;
+}
+
+/* the unique representative of x in [0, n) */
+static __inline__
+mp_limb_t nmod_mont_canonical(mp_limb_t x, const nmod_mont_t ctx)
+{
+    return (x >= ctx->n) ? x - ctx->n : x;
+}
+
+static __inline__
+int nmod_mont_equal(mp_limb_t x, mp_limb_t y, const nmod_mont_t ctx)
+{
+    return nmod_mont_canonical(x, ctx) == nmod_mont_canonical(y, ctx);
+}
+
+/* Conversions ***************************************************************/
+
+/* any a < 2^FLINT_BITS is accepted */
+static __inline__
+mp_limb_t nmod_mont_set_ui(mp_limb_t a, const nmod_mont_t ctx)
+{
+    return nmod_mont_mul(a, ctx->r2, ctx);
+}
+
+static __inline__
+mp_limb_t nmod_mont_get_ui(mp_limb_t x, const nmod_mont_t ctx)
+{
+    return nmod_mont_canonical(nmod_mont_mul(x, UWORD(1), ctx), ctx);
+}
+
+FLINT_DLL mp_limb_t nmod_mont_pow_ui(mp_limb_t x, mp_limb_t e,
+                                                   const nmod_mont_t ctx);
+
+/* Vector functions **********************************************************/
+
+FLINT_DLL void _nmod_mont_vec_set_nmod_vec(mp_ptr res, mp_srcptr vec,
+                                         slong len, const nmod_mont_t ctx);
+
+FLINT_DLL void _nmod_mont_vec_get_nmod_vec(mp_ptr res, mp_srcptr vec,
+                                         slong len, const nmod_mont_t ctx);
+
+FLINT_DLL void _nmod_mont_vec_mul(mp_ptr res, mp_srcptr vec1,
+                       mp_srcptr vec2, slong len, const nmod_mont_t ctx);
+
+FLINT_DLL void _nmod_mont_vec_scalar_mul(mp_ptr res, mp_srcptr vec,
+                             slong len, mp_limb_t c, const nmod_mont_t ctx);
+
+FLINT_DLL mp_limb_t _nmod_mont_vec_prod(mp_srcptr vec, slong len,
+                                                   const nmod_mont_t ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
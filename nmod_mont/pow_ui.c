@@ -0,0 +1,50 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mont.h"
+
+mp_limb_t nmod_mont_pow_ui(mp_limb_t x, mp_limb_t e, const nmod_mont_t ctx)
+{
+    mp_limb_t y;
+    slong i;
+
+    if (e == 0)
+        return ctx->one;
+
+    y = x;
+
+    for (i = (slong) FLINT_BIT_COUNT(e) - 2; i >= 0; i--)
+    {
+        y = nmod_mont_sqr(y, ctx);
+
+        if ((e >> i) & 1)
+            y = nmod_mont_mul(y, x, ctx);
+    }
+
+    return y;
+}
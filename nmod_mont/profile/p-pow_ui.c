@@ -0,0 +1,115 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mont.h"
+
+/*
+   Compares n_powmod_ui_preinv with conversion to Montgomery form,
+   nmod_mont_pow_ui and conversion back, for odd moduli and exponents of
+   the given sizes.
+*/
+
+#define NUM 1000
+
+typedef struct
+{
+   mp_bitcnt_t bits;
+   mp_bitcnt_t ebits;
+   int algo;
+} info_t;
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   mp_limb_t n[NUM], a[NUM], e[NUM], ninv[NUM], r = 0;
+   unsigned int norm;
+   nmod_mont_t ctx;
+   ulong i;
+   slong j;
+   FLINT_TEST_INIT(state);
+
+   for (i = 0; i < count; i++)
+   {
+      for (j = 0; j < NUM; j++)
+      {
+         n[j] = n_randbits(state, info->bits) | 1;
+         ninv[j] = n_preinvert_limb(n[j]);
+         a[j] = n_randint(state, n[j]);
+         e[j] = n_randbits(state, info->ebits);
+      }
+
+      prof_start();
+      if (info->algo == 0)
+      {
+         for (j = 0; j < NUM; j++)
+         {
+            count_leading_zeros(norm, n[j]);
+            r += n_powmod_ui_preinv(a[j] << norm, e[j], n[j] << norm,
+                                    ninv[j], norm) >> norm;
+         }
+      } else
+      {
+         for (j = 0; j < NUM; j++)
+         {
+            nmod_mont_init_preinv(ctx, n[j], ninv[j]);
+            r += nmod_mont_get_ui(nmod_mont_pow_ui(
+                         nmod_mont_set_ui(a[j], ctx), e[j], ctx), ctx);
+         }
+      }
+      prof_stop();
+   }
+
+   if (r == 0)
+      flint_printf("\r");
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min[2], max;
+   info_t info;
+
+   flint_printf("times in ns: preinv, mont\n");
+
+   for (info.bits = 20; info.bits <= NMOD_MONT_MAX_BITS; info.bits += 14)
+   {
+      for (info.ebits = 2; info.ebits <= FLINT_BITS; info.ebits *= 2)
+      {
+         for (info.algo = 0; info.algo < 2; info.algo++)
+            prof_repeat(min + info.algo, &max, sample, (void *) &info);
+
+         flint_printf("bits %wu, exp bits %wu: %.1lf %.1lf\n",
+            info.bits, info.ebits, 1000*min[0]/NUM, 1000*min[1]/NUM);
+      }
+   }
+
+   return 0;
+}
@@ -0,0 +1,108 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mont.h"
+
+/* a random odd modulus of at most NMOD_MONT_MAX_BITS bits */
+static mp_limb_t
+randmod(flint_rand_t state)
+{
+    mp_limb_t n;
+
+    n = n_randtest_bits(state, n_randint(state, NMOD_MONT_MAX_BITS) + 1);
+
+    return n | 1;
+}
+
+int main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul....");
+    fflush(stdout);
+
+    for (i = 0; i < 100000 * flint_test_multiplier(); i++)
+    {
+        nmod_mont_t ctx;
+        mp_limb_t n, ninv, a, b, x, y, r;
+
+        n = randmod(state);
+        ninv = n_preinvert_limb(n);
+        nmod_mont_init(ctx, n);
+
+        a = n_randtest(state) % n;
+        b = n_randtest(state) % n;
+
+        x = nmod_mont_set_ui(a, ctx);
+        y = nmod_mont_set_ui(b, ctx);
+
+        /* representatives anywhere in [0, 2n) must work */
+        if (n_randint(state, 2) && x < n)
+            x += n;
+        if (n_randint(state, 2) && y < n)
+            y += n;
+
+        result = (x < 2 * n && y < 2 * n);
+
+        r = nmod_mont_mul(x, y, ctx);
+        result = result && r < 2 * n
+                        && nmod_mont_get_ui(r, ctx)
+                           == n_mulmod2_preinv(a, b, n, ninv);
+
+        r = nmod_mont_sqr(x, ctx);
+        result = result && r < 2 * n
+                        && nmod_mont_get_ui(r, ctx)
+                           == n_mulmod2_preinv(a, a, n, ninv);
+
+        r = nmod_mont_add(x, y, ctx);
+        result = result && r < 2 * n
+                        && nmod_mont_get_ui(r, ctx) == n_addmod(a, b, n);
+
+        r = nmod_mont_sub(x, y, ctx);
+        result = result && r < 2 * n
+                        && nmod_mont_get_ui(r, ctx) == n_submod(a, b, n);
+
+        result = result && nmod_mont_equal(nmod_mont_set_ui(a, ctx), x, ctx)
+                        && nmod_mont_get_ui(ctx->one, ctx) == (n != 1);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, a = %wu, b = %wu\n", n, a, b);
+            abort();
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mont.h"
+
+int main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("pow_ui....");
+    fflush(stdout);
+
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        nmod_mont_t ctx;
+        mp_limb_t n, a, e, r, s;
+
+        n = n_randtest_bits(state,
+                n_randint(state, NMOD_MONT_MAX_BITS) + 1) | 1;
+        nmod_mont_init(ctx, n);
+
+        a = n_randtest(state) % n;
+        e = n_randtest(state);
+
+        r = nmod_mont_get_ui(nmod_mont_pow_ui(nmod_mont_set_ui(a, ctx),
+                                              e, ctx), ctx);
+        s = n_powmod2_ui_preinv(a, e, n, n_preinvert_limb(n));
+
+        /* a^(e + 1) = a^e * a */
+        result = (r == s);
+        s = n_mulmod2_preinv(s, a, n, n_preinvert_limb(n));
+        r = nmod_mont_get_ui(nmod_mont_pow_ui(nmod_mont_set_ui(a, ctx),
+                                              e + 1, ctx), ctx);
+        result = result && (e + 1 == 0 || r == s);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, a = %wu, e = %wu\n", n, a, e);
+            flint_printf("r = %wu, s = %wu\n", r, s);
+            abort();
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
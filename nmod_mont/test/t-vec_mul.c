@@ -0,0 +1,102 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mont.h"
+
+int main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("vec_mul....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_mont_t ctx;
+        mp_limb_t n, ninv, c, p;
+        mp_ptr a, b, x, y, r;
+        slong j, len;
+
+        n = n_randtest_bits(state,
+                n_randint(state, NMOD_MONT_MAX_BITS) + 1) | 1;
+        ninv = n_preinvert_limb(n);
+        nmod_mont_init(ctx, n);
+
+        len = n_randint(state, 50);
+        a = flint_malloc((5 * len + 1) * sizeof(mp_limb_t));
+        b = a + len;
+        x = b + len;
+        y = x + len;
+        r = y + len;
+
+        for (j = 0; j < len; j++)
+        {
+            a[j] = n_randtest(state) % n;
+            b[j] = n_randtest(state) % n;
+        }
+        c = n_randtest(state) % n;
+
+        _nmod_mont_vec_set_nmod_vec(x, a, len, ctx);
+        _nmod_mont_vec_set_nmod_vec(y, b, len, ctx);
+
+        _nmod_mont_vec_mul(r, x, y, len, ctx);
+        _nmod_mont_vec_get_nmod_vec(r, r, len, ctx);
+        result = 1;
+        for (j = 0; j < len; j++)
+            result &= (r[j] == n_mulmod2_preinv(a[j], b[j], n, ninv));
+
+        _nmod_mont_vec_scalar_mul(r, x, len,
+                                  nmod_mont_set_ui(c, ctx), ctx);
+        _nmod_mont_vec_get_nmod_vec(r, r, len, ctx);
+        for (j = 0; j < len; j++)
+            result &= (r[j] == n_mulmod2_preinv(a[j], c, n, ninv));
+
+        p = 1 % n;
+        for (j = 0; j < len; j++)
+            p = n_mulmod2_preinv(p, a[j], n, ninv);
+        result &= (nmod_mont_get_ui(_nmod_mont_vec_prod(x, len, ctx), ctx)
+                   == p);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, len = %wd\n", n, len);
+            abort();
+        }
+
+        flint_free(a);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,55 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mont.h"
+
+/* four independent running products, so that the multiplications overlap */
+mp_limb_t _nmod_mont_vec_prod(mp_srcptr vec, slong len,
+                                                      const nmod_mont_t ctx)
+{
+    mp_limb_t p0, p1, p2, p3;
+    slong i;
+
+    p0 = p1 = p2 = p3 = ctx->one;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        p0 = nmod_mont_mul(p0, vec[i + 0], ctx);
+        p1 = nmod_mont_mul(p1, vec[i + 1], ctx);
+        p2 = nmod_mont_mul(p2, vec[i + 2], ctx);
+        p3 = nmod_mont_mul(p3, vec[i + 3], ctx);
+    }
+
+    for ( ; i < len; i++)
+        p0 = nmod_mont_mul(p0, vec[i], ctx);
+
+    p0 = nmod_mont_mul(p0, p1, ctx);
+    p2 = nmod_mont_mul(p2, p3, ctx);
+
+    return nmod_mont_mul(p0, p2, ctx);
+}
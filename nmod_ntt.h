@@ -0,0 +1,127 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#ifndef NMOD_NTT_H
+#define NMOD_NTT_H
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "longlong.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Transforms of length 2^depth modulo a prime p < 2^62 with 2^depth | p - 1.
+    The table w holds w[h + j] = w_{2h}^j for 0 <= j < h and every power of
+    two h < 2^depth, where w_{2h} is a fixed primitive 2h-th root of unity,
+    and wpre holds the corresponding Shoup quotients floor(w * 2^FLINT_BITS
+    / p). The tables are extended on demand by nmod_ntt_ctx_fit_depth.
+*/
+typedef struct
+{
+    nmod_t mod;
+    mp_limb_t g;        /* primitive root of unity of order 2^max_depth */
+    slong max_depth;
+    slong depth;        /* depth up to which the tables are filled */
+    mp_ptr w;
+    mp_ptr wpre;
+} nmod_ntt_ctx_struct;
+
+typedef nmod_ntt_ctx_struct nmod_ntt_ctx_t[1];
+
+#define NMOD_NTT_NUM_PRIMES 3
+
+FLINT_DLL extern const mp_limb_t nmod_ntt_primes[NMOD_NTT_NUM_PRIMES];
+
+/* Context *******************************************************************/
+
+FLINT_DLL void nmod_ntt_ctx_init(nmod_ntt_ctx_t ctx, mp_limb_t p);
+
+FLINT_DLL void nmod_ntt_ctx_clear(nmod_ntt_ctx_t ctx);
+
+FLINT_DLL void nmod_ntt_ctx_fit_depth(nmod_ntt_ctx_t ctx, slong depth);
+
+FLINT_DLL nmod_ntt_ctx_struct * _nmod_ntt_ctx_cached(slong i);
+
+FLINT_DLL void _nmod_ntt_cleanup(void);
+
+/* Arithmetic ****************************************************************/
+
+static __inline__
+mp_limb_t nmod_ntt_shoup_precomp(mp_limb_t w, mp_limb_t p)
+{
+    mp_limb_t q, r;
+    unsigned int norm;
+
+    count_leading_zeros(norm, p);
+    udiv_qrnnd(q, r, w << norm, UWORD(0), p << norm);
+
+    return q;
+}
+
+/* returns a value congruent to a * w in [0, 2p), given w < p < 2^62 */
+static __inline__
+mp_limb_t nmod_ntt_mulmod_shoup(mp_limb_t a, mp_limb_t w, mp_limb_t wpre,
+                                                                mp_limb_t p)
+{
+    mp_limb_t q, r;
+
+    umul_ppmm(q, r, a, wpre);
+
+    return a * w - q * p;
+}
+
+/* Transforms ****************************************************************/
+
+FLINT_DLL void _nmod_ntt_fft(mp_ptr a, slong ilen, slong depth,
+                                                 const nmod_ntt_ctx_t ctx);
+
+FLINT_DLL void _nmod_ntt_ifft(mp_ptr a, slong depth,
+                                                 const nmod_ntt_ctx_t ctx);
+
+FLINT_DLL void nmod_ntt_fft(mp_ptr a, slong ilen, slong depth,
+                                                       nmod_ntt_ctx_t ctx);
+
+FLINT_DLL void nmod_ntt_ifft(mp_ptr a, slong depth, nmod_ntt_ctx_t ctx);
+
+FLINT_DLL void _nmod_ntt_pointwise_mul(mp_ptr a, mp_srcptr b, slong len,
+                                      slong depth, const nmod_ntt_ctx_t ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,82 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_ntt.h"
+
+/*
+    Primes p < 2^(FLINT_BITS - 2) with many factors of two in p - 1, in
+    decreasing order. On 64 bit machines they support transforms of length
+    up to 2^41, on 32 bit machines up to 2^23.
+*/
+#if FLINT64
+const mp_limb_t nmod_ntt_primes[NMOD_NTT_NUM_PRIMES] =
+{
+    UWORD(0x3fffc00000000001),
+    UWORD(0x3fffbe0000000001),
+    UWORD(0x3fff840000000001)
+};
+#else
+const mp_limb_t nmod_ntt_primes[NMOD_NTT_NUM_PRIMES] =
+{
+    UWORD(0x3b800001),
+    UWORD(0x2d000001),
+    UWORD(0x1c000001)
+};
+#endif
+
+FLINT_TLS_PREFIX nmod_ntt_ctx_struct _nmod_ntt_ctx[NMOD_NTT_NUM_PRIMES];
+FLINT_TLS_PREFIX int _nmod_ntt_ctx_initialised = 0;
+
+void _nmod_ntt_cleanup(void)
+{
+    slong i;
+
+    if (!_nmod_ntt_ctx_initialised)
+        return;
+
+    for (i = 0; i < NMOD_NTT_NUM_PRIMES; i++)
+        nmod_ntt_ctx_clear(_nmod_ntt_ctx + i);
+
+    _nmod_ntt_ctx_initialised = 0;
+}
+
+nmod_ntt_ctx_struct * _nmod_ntt_ctx_cached(slong i)
+{
+    slong k;
+
+    if (!_nmod_ntt_ctx_initialised)
+    {
+        for (k = 0; k < NMOD_NTT_NUM_PRIMES; k++)
+            nmod_ntt_ctx_init(_nmod_ntt_ctx + k, nmod_ntt_primes[k]);
+
+        _nmod_ntt_ctx_initialised = 1;
+        flint_register_cleanup_function(_nmod_ntt_cleanup);
+    }
+
+    return _nmod_ntt_ctx + i;
+}
@@ -0,0 +1,68 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_ntt.h"
+
+void nmod_ntt_ctx_fit_depth(nmod_ntt_ctx_t ctx, slong depth)
+{
+    slong l, h, j;
+    mp_limb_t p = ctx->mod.n, root, x;
+
+    if (depth <= ctx->depth)
+        return;
+
+    if (depth > ctx->max_depth)
+    {
+        flint_printf("Exception (nmod_ntt_ctx_fit_depth). "
+                     "Transform length not supported by the prime.\n");
+        abort();
+    }
+
+    ctx->w = flint_realloc(ctx->w, (WORD(1) << depth) * sizeof(mp_limb_t));
+    ctx->wpre = flint_realloc(ctx->wpre,
+                              (WORD(1) << depth) * sizeof(mp_limb_t));
+
+    for (l = ctx->depth + 1; l <= depth; l++)
+    {
+        h = WORD(1) << (l - 1);
+
+        /* primitive 2h-th root of unity */
+        root = n_powmod2_preinv(ctx->g, UWORD(1) << (ctx->max_depth - l),
+                                p, ctx->mod.ninv);
+
+        x = 1;
+        for (j = 0; j < h; j++)
+        {
+            ctx->w[h + j] = x;
+            ctx->wpre[h + j] = nmod_ntt_shoup_precomp(x, p);
+            x = n_mulmod2_preinv(x, root, p, ctx->mod.ninv);
+        }
+    }
+
+    ctx->depth = depth;
+}
@@ -0,0 +1,53 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_ntt.h"
+
+void nmod_ntt_ctx_init(nmod_ntt_ctx_t ctx, mp_limb_t p)
+{
+    mp_limb_t r;
+
+    nmod_init(&ctx->mod, p);
+
+    ctx->max_depth = 0;
+    while (((p - 1) & (UWORD(1) << ctx->max_depth)) == 0)
+        ctx->max_depth++;
+
+    /*
+        If r is a quadratic nonresidue, r^((p - 1) / 2^max_depth) has order
+        exactly 2^max_depth.
+    */
+    for (r = 2; n_powmod2_preinv(r, (p - 1) / 2, p, ctx->mod.ninv) == 1; r++) ;
+
+    ctx->g = n_powmod2_preinv(r, (p - 1) >> ctx->max_depth,
+                              p, ctx->mod.ninv);
+
+    ctx->depth = 0;
+    ctx->w = NULL;
+    ctx->wpre = NULL;
+}
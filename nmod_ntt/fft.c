@@ -0,0 +1,160 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_ntt.h"
+
+/*
+    Decimation in frequency with Harvey's lazy butterflies: all values are
+    kept in [0, 2p). Blocks of length at most 2^NMOD_NTT_ITER_DEPTH are
+    transformed level by level, larger ones recursively so that the inner
+    levels work in cache.
+*/
+
+#define NMOD_NTT_ITER_DEPTH 10
+
+#define DIF_BUTTERFLY(a0, a1, w, wpre, p, p2)       \
+    do {                                            \
+        mp_limb_t __x = (a0), __y = (a1);           \
+        mp_limb_t __s = __x + __y;                  \
+        if (__s >= (p2)) __s -= (p2);               \
+        (a0) = __s;                                 \
+        (a1) = nmod_ntt_mulmod_shoup(__x - __y + (p2), w, wpre, p); \
+    } while (0)
+
+static void
+_fft_full(mp_ptr a, slong depth, mp_srcptr w, mp_srcptr wpre, mp_limb_t p)
+{
+    slong N = WORD(1) << depth, h, j, k;
+    mp_limb_t p2 = 2 * p, x, y;
+
+    if (depth == 0)
+        return;
+
+    if (depth > NMOD_NTT_ITER_DEPTH)
+    {
+        h = N / 2;
+
+        for (j = 0; j < h; j++)
+            DIF_BUTTERFLY(a[j], a[j + h], w[h + j], wpre[h + j], p, p2);
+
+        _fft_full(a, depth - 1, w, wpre, p);
+        _fft_full(a + h, depth - 1, w, wpre, p);
+
+        return;
+    }
+
+    for (h = N / 2; h > 1; h /= 2)
+    {
+        for (k = 0; k < N; k += 2 * h)
+        {
+            mp_ptr b = a + k;
+
+            for (j = 0; j < h; j++)
+                DIF_BUTTERFLY(b[j], b[j + h], w[h + j], wpre[h + j], p, p2);
+        }
+    }
+
+    /* the last level has all twiddles equal to 1 */
+    for (k = 0; k < N; k += 2)
+    {
+        x = a[k];
+        y = a[k + 1];
+
+        a[k] = x + y;
+        if (a[k] >= p2)
+            a[k] -= p2;
+
+        a[k + 1] = x - y + p2;
+        if (a[k + 1] >= p2)
+            a[k + 1] -= p2;
+    }
+}
+
+/* as above, but only a[0], ..., a[ilen - 1] are read, the rest being zero */
+static void
+_fft_trunc(mp_ptr a, slong ilen, slong depth,
+                                mp_srcptr w, mp_srcptr wpre, mp_limb_t p)
+{
+    slong N = WORD(1) << depth, h, j;
+    mp_limb_t p2 = 2 * p;
+
+    if (ilen >= N)
+    {
+        _fft_full(a, depth, w, wpre, p);
+        return;
+    }
+
+    if (depth <= NMOD_NTT_ITER_DEPTH)
+    {
+        flint_mpn_zero(a + ilen, N - ilen);
+        _fft_full(a, depth, w, wpre, p);
+        return;
+    }
+
+    h = N / 2;
+
+    if (ilen <= h)
+    {
+        for (j = 0; j < ilen; j++)
+            a[j + h] = nmod_ntt_mulmod_shoup(a[j], w[h + j], wpre[h + j], p);
+
+        _fft_trunc(a, ilen, depth - 1, w, wpre, p);
+        _fft_trunc(a + h, ilen, depth - 1, w, wpre, p);
+    }
+    else
+    {
+        for (j = 0; j < ilen - h; j++)
+            DIF_BUTTERFLY(a[j], a[j + h], w[h + j], wpre[h + j], p, p2);
+
+        for ( ; j < h; j++)
+            a[j + h] = nmod_ntt_mulmod_shoup(a[j], w[h + j], wpre[h + j], p);
+
+        _fft_full(a, depth - 1, w, wpre, p);
+        _fft_full(a + h, depth - 1, w, wpre, p);
+    }
+}
+
+void _nmod_ntt_fft(mp_ptr a, slong ilen, slong depth,
+                                                  const nmod_ntt_ctx_t ctx)
+{
+    _fft_trunc(a, ilen, depth, ctx->w, ctx->wpre, ctx->mod.n);
+}
+
+void nmod_ntt_fft(mp_ptr a, slong ilen, slong depth, nmod_ntt_ctx_t ctx)
+{
+    slong i, N = WORD(1) << depth;
+    mp_limb_t p = ctx->mod.n;
+
+    nmod_ntt_ctx_fit_depth(ctx, depth);
+
+    _nmod_ntt_fft(a, ilen, depth, ctx);
+
+    for (i = 0; i < N; i++)
+        if (a[i] >= p)
+            a[i] -= p;
+}
@@ -0,0 +1,123 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_ntt.h"
+
+/*
+    Decimation in time, inverting _nmod_ntt_fft up to a factor 2^depth.
+    Values are kept in [0, 2p). The inverse twiddle w_{2h}^{-j} is
+    -w_{2h}^{h - j}, which is read from the forward table with the sign
+    absorbed into the butterfly.
+*/
+
+#define NMOD_NTT_ITER_DEPTH 10
+
+#define DIT_BUTTERFLY(a0, a1, w, wpre, p, p2)       \
+    do {                                            \
+        mp_limb_t __x = (a0), __t;                  \
+        __t = nmod_ntt_mulmod_shoup(a1, w, wpre, p); \
+        (a0) = __x - __t + (p2);                    \
+        if ((a0) >= (p2)) (a0) -= (p2);             \
+        (a1) = __x + __t;                           \
+        if ((a1) >= (p2)) (a1) -= (p2);             \
+    } while (0)
+
+#define DIT_BUTTERFLY_1(a0, a1, p2)                 \
+    do {                                            \
+        mp_limb_t __x = (a0), __y = (a1);           \
+        (a0) = __x + __y;                           \
+        if ((a0) >= (p2)) (a0) -= (p2);             \
+        (a1) = __x - __y + (p2);                    \
+        if ((a1) >= (p2)) (a1) -= (p2);             \
+    } while (0)
+
+static void
+_ifft_full(mp_ptr a, slong depth, mp_srcptr w, mp_srcptr wpre, mp_limb_t p)
+{
+    slong N = WORD(1) << depth, h, j, k;
+    mp_limb_t p2 = 2 * p;
+
+    if (depth == 0)
+        return;
+
+    if (depth > NMOD_NTT_ITER_DEPTH)
+    {
+        h = N / 2;
+
+        _ifft_full(a, depth - 1, w, wpre, p);
+        _ifft_full(a + h, depth - 1, w, wpre, p);
+
+        DIT_BUTTERFLY_1(a[0], a[h], p2);
+        for (j = 1; j < h; j++)
+            DIT_BUTTERFLY(a[j], a[j + h], w[2 * h - j], wpre[2 * h - j],
+                                                                   p, p2);
+
+        return;
+    }
+
+    for (k = 0; k < N; k += 2)
+        DIT_BUTTERFLY_1(a[k], a[k + 1], p2);
+
+    for (h = 2; h < N; h *= 2)
+    {
+        for (k = 0; k < N; k += 2 * h)
+        {
+            mp_ptr b = a + k;
+
+            DIT_BUTTERFLY_1(b[0], b[h], p2);
+            for (j = 1; j < h; j++)
+                DIT_BUTTERFLY(b[j], b[j + h], w[2 * h - j], wpre[2 * h - j],
+                                                                   p, p2);
+        }
+    }
+}
+
+void _nmod_ntt_ifft(mp_ptr a, slong depth, const nmod_ntt_ctx_t ctx)
+{
+    _ifft_full(a, depth, ctx->w, ctx->wpre, ctx->mod.n);
+}
+
+void nmod_ntt_ifft(mp_ptr a, slong depth, nmod_ntt_ctx_t ctx)
+{
+    slong i, N = WORD(1) << depth;
+    mp_limb_t p = ctx->mod.n, c, cpre;
+
+    nmod_ntt_ctx_fit_depth(ctx, depth);
+
+    _nmod_ntt_ifft(a, depth, ctx);
+
+    c = n_invmod(UWORD(1) << depth, p);
+    cpre = nmod_ntt_shoup_precomp(c, p);
+
+    for (i = 0; i < N; i++)
+    {
+        a[i] = nmod_ntt_mulmod_shoup(a[i], c, cpre, p);
+        if (a[i] >= p)
+            a[i] -= p;
+    }
+}
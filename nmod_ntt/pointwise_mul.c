@@ -0,0 +1,51 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_ntt.h"
+
+void _nmod_ntt_pointwise_mul(mp_ptr a, mp_srcptr b, slong len, slong depth,
+                                                  const nmod_ntt_ctx_t ctx)
+{
+    slong i;
+    mp_limb_t p = ctx->mod.n, c, cpre, x, y, hi, lo;
+
+    /* scale by 1/2^depth to undo the inverse transform */
+    c = p - ((p - 1) >> depth);
+    cpre = nmod_ntt_shoup_precomp(c, p);
+
+    for (i = 0; i < len; i++)
+    {
+        x = a[i] >= p ? a[i] - p : a[i];
+        y = b[i] >= p ? b[i] - p : b[i];
+
+        umul_ppmm(hi, lo, x, y);
+        NMOD_RED2(x, hi, lo, ctx->mod);
+
+        a[i] = nmod_ntt_mulmod_shoup(x, c, cpre, p);
+    }
+}
@@ -0,0 +1,117 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_ntt.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("convolution....");
+    fflush(stdout);
+
+    /* Check lazy transforms of unreduced input against naive convolution */
+    for (i = 0; i < 300 * flint_test_multiplier(); i++)
+    {
+        nmod_ntt_ctx_struct * ctx;
+        slong alen, blen, depth, N, j, k;
+        mp_limb_t p, c;
+        mp_ptr a, b, r;
+
+        ctx = _nmod_ntt_ctx_cached(n_randint(state, NMOD_NTT_NUM_PRIMES));
+        p = ctx->mod.n;
+
+        alen = n_randint(state, i % 30 == 0 ? 1500 : 100) + 1;
+        blen = n_randint(state, i % 30 == 0 ? 1500 : 100) + 1;
+        depth = FLINT_CLOG2(alen + blen - 1);
+        N = WORD(1) << depth;
+
+        a = _nmod_vec_init(N);
+        b = _nmod_vec_init(N);
+        r = _nmod_vec_init(alen + blen - 1);
+
+        /* entries in [0, 2p) */
+        for (j = 0; j < alen; j++)
+            a[j] = n_randint(state, 2 * p);
+        for (j = 0; j < blen; j++)
+            b[j] = n_randint(state, 2 * p);
+
+        _nmod_vec_zero(r, alen + blen - 1);
+        for (j = 0; j < alen; j++)
+            for (k = 0; k < blen; k++)
+                r[j + k] = nmod_add(r[j + k],
+                                    nmod_mul(a[j], b[k], ctx->mod), ctx->mod);
+
+        nmod_ntt_ctx_fit_depth(ctx, depth);
+        _nmod_ntt_fft(a, alen, depth, ctx);
+        _nmod_ntt_fft(b, blen, depth, ctx);
+
+        for (j = 0; j < N; j++)
+        {
+            result = (a[j] < 2 * p && b[j] < 2 * p);
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("transform output out of range\n");
+                abort();
+            }
+
+            a[j] = nmod_mul(a[j], b[j], ctx->mod);
+        }
+
+        _nmod_ntt_ifft(a, depth, ctx);
+
+        c = n_invmod(N, p);
+        for (j = 0; j < alen + blen - 1; j++)
+        {
+            result = (a[j] < 2 * p
+                      && nmod_mul(a[j], c, ctx->mod) == r[j]);
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("alen = %wd, blen = %wd, j = %wd\n",
+                             alen, blen, j);
+                abort();
+            }
+        }
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(r);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,136 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_ntt.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("fft_ifft....");
+    fflush(stdout);
+
+    /* Check that ifft inverts fft on zero padded input */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_ntt_ctx_t ctx;
+        slong depth, N, ilen, k;
+        mp_ptr a, b;
+
+        nmod_ntt_ctx_init(ctx, nmod_ntt_primes[n_randint(state,
+                                                 NMOD_NTT_NUM_PRIMES)]);
+
+        depth = n_randint(state, i % 20 == 0 ? 14 : 8);
+        N = WORD(1) << depth;
+        ilen = n_randint(state, N + 1);
+
+        a = _nmod_vec_init(N);
+        b = _nmod_vec_init(N);
+
+        _nmod_vec_randtest(a, state, ilen, ctx->mod);
+        _nmod_vec_zero(a + ilen, N - ilen);
+        _nmod_vec_set(b, a, ilen);
+
+        nmod_ntt_fft(b, ilen, depth, ctx);
+        nmod_ntt_ifft(b, depth, ctx);
+
+        result = _nmod_vec_equal(a, b, N);
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("depth = %wd, ilen = %wd\n", depth, ilen);
+            for (k = 0; k < N && a[k] == b[k]; k++) ;
+            flint_printf("first difference at %wd\n", k);
+            abort();
+        }
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        nmod_ntt_ctx_clear(ctx);
+    }
+
+    /* Check the transform against naive evaluation at a root of unity */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_ntt_ctx_t ctx;
+        slong depth, N, ilen, j, k;
+        mp_limb_t w, x, y;
+        mp_ptr a, b;
+
+        nmod_ntt_ctx_init(ctx, nmod_ntt_primes[n_randint(state,
+                                                 NMOD_NTT_NUM_PRIMES)]);
+
+        depth = n_randint(state, 8);
+        N = WORD(1) << depth;
+        ilen = n_randint(state, N + 1);
+
+        a = _nmod_vec_init(N);
+        b = _nmod_vec_init(N);
+
+        _nmod_vec_randtest(a, state, ilen, ctx->mod);
+        _nmod_vec_set(b, a, ilen);
+
+        nmod_ntt_fft(b, ilen, depth, ctx);
+
+        /* the values are the evaluations at the N-th roots of unity */
+        w = n_powmod2_preinv(ctx->g, UWORD(1) << (ctx->max_depth - depth),
+                             ctx->mod.n, ctx->mod.ninv);
+
+        for (j = 0; j < N; j++)
+        {
+            x = n_powmod2_preinv(w, n_revbin(j, depth),
+                                 ctx->mod.n, ctx->mod.ninv);
+            y = 0;
+            for (k = ilen - 1; k >= 0; k--)
+                y = nmod_add(nmod_mul(y, x, ctx->mod), a[k], ctx->mod);
+
+            result = (y == b[j]);
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("depth = %wd, ilen = %wd, j = %wd\n",
+                             depth, ilen, j);
+                abort();
+            }
+        }
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        nmod_ntt_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -50,10 +50,16 @@
 #define NMOD_DIVREM_DIVCONQUER_CUTOFF  300
 #define NMOD_DIV_DIVCONQUER_CUTOFF     300 /* Must be <= NMOD_DIVREM_DIVCONQUER_CUTOFF */
 
+/* defaults for the tuning parameters, see flint_get_tuning() */
 #define NMOD_POLY_HGCD_CUTOFF  100      /* HGCD: Basecase -> Recursion      */
 #define NMOD_POLY_GCD_CUTOFF  340       /* GCD:  Euclidean -> HGCD          */
 #define NMOD_POLY_SMALL_GCD_CUTOFF 200  /* GCD (small n): Euclidean -> HGCD */
 
+/* KS -> NTT multiplication, depending on the bit size of the modulus */
+#define NMOD_POLY_NTT_CUTOFF(bits)         \
+    ((bits) <= 8 ? WORD_MAX : (bits) <= 12 ? 16384 \
+                            : (bits) <= 36 ? 4096 : 1024)
+
 static __inline__
 slong NMOD_DIVREM_BC_ITCH(slong lenA, slong lenB, nmod_t mod)
 {
@@ -540,6 +546,18 @@ FLINT_DLL void _nmod_poly_mullow_KS(mp_ptr out, mp_srcptr in1, slong len1,
 FLINT_DLL void nmod_poly_mullow_KS(nmod_poly_t res, const nmod_poly_t poly1, 
                              const nmod_poly_t poly2, mp_bitcnt_t bits, slong n);
 
+FLINT_DLL void _nmod_poly_mul_NTT(mp_ptr res, mp_srcptr poly1, slong len1,
+                                       mp_srcptr poly2, slong len2, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mul_NTT(nmod_poly_t res,
+                               const nmod_poly_t poly1, const nmod_poly_t poly2);
+
+FLINT_DLL void _nmod_poly_mullow_NTT(mp_ptr res, mp_srcptr poly1, slong len1,
+                              mp_srcptr poly2, slong len2, slong n, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mullow_NTT(nmod_poly_t res, const nmod_poly_t poly1,
+                                      const nmod_poly_t poly2, slong trunc);
+
 FLINT_DLL void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1, 
                                        mp_srcptr poly2, slong len2, nmod_t mod);
 
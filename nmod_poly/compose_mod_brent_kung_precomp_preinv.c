@@ -68,7 +68,6 @@ _nmod_poly_precompute_matrix_worker (void * arg_ptr)
         _nmod_poly_mulmod_preinv(arg.A.rows[i], arg.A.rows[i - 1], n,
                                  arg.poly1.coeffs, n, arg.poly2.coeffs, n + 1,
                                  arg.poly2inv.coeffs, n + 1, arg.poly2.mod);
-    flint_cleanup();
     return NULL;
 }
 
@@ -151,14 +150,10 @@ _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr)
     n = arg.poly3.length - 1;
 
     if (arg.poly3.length == 1)
-    {
-        flint_cleanup();
         return NULL;
-    }
     if (arg.poly1.length == 1)
     {
         arg.res.coeffs[0] = arg.poly1.coeffs[0];
-        flint_cleanup();
         return NULL;
     }
 
@@ -167,7 +162,6 @@ _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr)
         arg.res.coeffs[0] = _nmod_poly_evaluate_nmod(arg.poly1.coeffs,
                                              arg.poly1.length, arg.A.rows[1][0],
                                              arg.poly3.mod);
-        flint_cleanup();
         return NULL;
     }
 
@@ -207,7 +201,6 @@ _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr)
 
     nmod_mat_clear(B);
     nmod_mat_clear(C);
-    flint_cleanup();
     return NULL;
 }
 
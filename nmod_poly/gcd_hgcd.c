@@ -59,7 +59,8 @@ slong _nmod_poly_gcd_hgcd(mp_ptr G, mp_srcptr A, slong lenA,
                                    mp_srcptr B, slong lenB, nmod_t mod)
 {
     const slong cutoff = FLINT_BIT_COUNT(mod.n) <= 8 ? 
-                        NMOD_POLY_SMALL_GCD_CUTOFF : NMOD_POLY_GCD_CUTOFF;
+                        flint_get_tuning()->nmod_poly_small_gcd_cutoff
+                      : flint_get_tuning()->nmod_poly_gcd_cutoff;
 
     mp_ptr J = _nmod_vec_init(2 * lenB);
     mp_ptr R = J + lenB;
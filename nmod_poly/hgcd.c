@@ -399,7 +399,7 @@ slong _nmod_poly_hgcd_recursive(mp_ptr *M, slong *lenM,
            res->off += m;
         }
 
-        if (lena0 < NMOD_POLY_HGCD_CUTOFF)
+        if (lena0 < flint_get_tuning()->nmod_poly_hgcd_cutoff)
             sgnR = _nmod_poly_hgcd_recursive_iter(R, lenR, &a3, &lena3, &b3, &lenb3, 
                                             a0, lena0, b0, lenb0, 
                                             q, &T0, &T1, mod, res);
@@ -528,7 +528,7 @@ slong _nmod_poly_hgcd_recursive(mp_ptr *M, slong *lenM,
                res->off += k;
             } 
             
-            if (lenc0 < NMOD_POLY_HGCD_CUTOFF)
+            if (lenc0 < flint_get_tuning()->nmod_poly_hgcd_cutoff)
                 sgnS = _nmod_poly_hgcd_recursive_iter(S, lenS, &a3, &lena3, &b3, &lenb3, 
                                                 c0, lenc0, d0, lend0, 
                                                 a2, &T0, &T1, mod, res); /* a2 as temp */
@@ -0,0 +1,226 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_ntt.h"
+
+/* transform of in reduced modulo the prime of ctx, written to a */
+static void
+_fft_reduced(mp_ptr a, mp_srcptr in, slong len, slong depth,
+                                      nmod_t mod, const nmod_ntt_ctx_t ctx)
+{
+    slong i;
+
+    if (mod.n <= ctx->mod.n)
+        flint_mpn_copyi(a, in, len);
+    else
+        for (i = 0; i < len; i++)
+            NMOD_RED(a[i], in[i], ctx->mod);
+
+    _nmod_ntt_fft(a, len, depth, ctx);
+}
+
+void _nmod_poly_mullow_NTT(mp_ptr res, mp_srcptr poly1, slong len1,
+                             mp_srcptr poly2, slong len2, slong n, nmod_t mod)
+{
+    slong i, k, depth, N, bits, bound, num_primes;
+    int squaring;
+    mp_ptr a, t;
+    mp_limb_t p;
+    nmod_ntt_ctx_struct * ctx[NMOD_NTT_NUM_PRIMES];
+
+    len1 = FLINT_MIN(len1, n);
+    len2 = FLINT_MIN(len2, n);
+
+    squaring = (poly1 == poly2 && len1 == len2);
+
+    /* bound on the bits of the coefficients of the product over Z */
+    bits = _nmod_vec_max_bits(poly1, len1);
+    bits += squaring ? bits : _nmod_vec_max_bits(poly2, len2);
+    bits += FLINT_BIT_COUNT(FLINT_MIN(len1, len2));
+
+    /* the product of the first num_primes primes exceeds 2^bound */
+    bound = 0;
+    for (num_primes = 1; num_primes <= NMOD_NTT_NUM_PRIMES; num_primes++)
+    {
+        bound += FLINT_BIT_COUNT(nmod_ntt_primes[num_primes - 1]) - 1;
+        if (bits <= bound)
+            break;
+    }
+
+    if (num_primes > NMOD_NTT_NUM_PRIMES)
+    {
+        _nmod_poly_mullow_KS(res, poly1, len1, poly2, len2, 0, n, mod);
+        return;
+    }
+
+    n = FLINT_MIN(n, len1 + len2 - 1);
+    depth = FLINT_CLOG2(len1 + len2 - 1);
+    N = WORD(1) << depth;
+
+    a = flint_malloc((num_primes + !squaring) * N * sizeof(mp_limb_t));
+    t = a + num_primes * N;
+
+    for (i = 0; i < num_primes; i++)
+    {
+        mp_ptr b = a + i * N;
+
+        ctx[i] = _nmod_ntt_ctx_cached(i);
+        nmod_ntt_ctx_fit_depth(ctx[i], depth);
+        p = ctx[i]->mod.n;
+
+        _fft_reduced(b, poly1, len1, depth, mod, ctx[i]);
+
+        if (squaring)
+            _nmod_ntt_pointwise_mul(b, b, N, depth, ctx[i]);
+        else
+        {
+            _fft_reduced(t, poly2, len2, depth, mod, ctx[i]);
+            _nmod_ntt_pointwise_mul(b, t, N, depth, ctx[i]);
+        }
+
+        _nmod_ntt_ifft(b, depth, ctx[i]);
+
+        for (k = 0; k < n; k++)
+            if (b[k] >= p)
+                b[k] -= p;
+    }
+
+    if (num_primes == 1)
+    {
+        for (k = 0; k < n; k++)
+            NMOD_RED(res[k], a[k], mod);
+    }
+    else
+    {
+        /*
+            Garner: with residues s_i modulo p_i, the coefficient is
+            s1 + p1 t2 + p1 p2 t3 where t2 = (s2 - s1) / p1 mod p2 and
+            t3 = (s3 - s1 - p1 t2) / (p1 p2) mod p3.
+        */
+        mp_limb_t p1 = ctx[0]->mod.n, p2 = ctx[1]->mod.n, p3;
+        mp_limb_t i12, i12pre, c1, c2, s1, s2, s3, t2, t3, hi, lo;
+        mp_limb_t p13 = 0, p13pre = 0, i123 = 0, i123pre = 0;
+        mp_ptr b2 = a + N, b3 = a + 2 * N;
+
+        i12 = n_invmod(p1 % p2, p2);
+        i12pre = nmod_ntt_shoup_precomp(i12, p2);
+        NMOD_RED(c1, p1, mod);
+
+        if (num_primes == 3)
+        {
+            p3 = ctx[2]->mod.n;
+            p13 = p1 % p3;
+            p13pre = nmod_ntt_shoup_precomp(p13, p3);
+            i123 = n_invmod(n_mulmod2_preinv(p13, p2 % p3, p3,
+                                ctx[2]->mod.ninv), p3);
+            i123pre = nmod_ntt_shoup_precomp(i123, p3);
+            umul_ppmm(hi, lo, p1, p2);
+            NMOD_RED2(c2, hi % mod.n, lo, mod);
+        }
+        else
+        {
+            p3 = 0;
+            c2 = 0;
+        }
+
+        for (k = 0; k < n; k++)
+        {
+            s1 = a[k];
+            s2 = b2[k];
+
+            t2 = nmod_ntt_mulmod_shoup(s2 + 2 * p2 - s1, i12, i12pre, p2);
+            if (t2 >= p2)
+                t2 -= p2;
+
+            NMOD_RED(s1, s1, mod);
+            NMOD_RED(res[k], t2, mod);
+            res[k] = nmod_add(s1, nmod_mul(c1, res[k], mod), mod);
+
+            if (num_primes == 3)
+            {
+                s3 = b3[k];
+
+                t3 = t2 >= p3 ? t2 - p3 : t2;
+                t3 = nmod_ntt_mulmod_shoup(t3, p13, p13pre, p3);
+                if (t3 >= p3)
+                    t3 -= p3;
+                s1 = a[k] >= p3 ? a[k] - p3 : a[k];
+                t3 = s3 + 2 * p3 - s1 - t3;
+                t3 = nmod_ntt_mulmod_shoup(t3, i123, i123pre, p3);
+                if (t3 >= p3)
+                    t3 -= p3;
+
+                NMOD_RED(t3, t3, mod);
+                res[k] = nmod_add(res[k], nmod_mul(c2, t3, mod), mod);
+            }
+        }
+    }
+
+    flint_free(a);
+}
+
+void nmod_poly_mullow_NTT(nmod_poly_t res, const nmod_poly_t poly1,
+                                   const nmod_poly_t poly2, slong trunc)
+{
+    slong len1, len2, len_out;
+
+    len1 = poly1->length;
+    len2 = poly2->length;
+
+    len_out = len1 + len2 - 1;
+    if (trunc > len_out)
+        trunc = len_out;
+
+    if (len1 == 0 || len2 == 0 || trunc == 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    if (res == poly1 || res == poly2)
+    {
+        nmod_poly_t temp;
+
+        nmod_poly_init2(temp, poly1->mod.n, trunc);
+        _nmod_poly_mullow_NTT(temp->coeffs, poly1->coeffs, len1,
+                              poly2->coeffs, len2, trunc, poly1->mod);
+        nmod_poly_swap(temp, res);
+        nmod_poly_clear(temp);
+    }
+    else
+    {
+        nmod_poly_fit_length(res, trunc);
+        _nmod_poly_mullow_NTT(res->coeffs, poly1->coeffs, len1,
+                              poly2->coeffs, len2, trunc, poly1->mod);
+    }
+
+    res->length = trunc;
+    _nmod_poly_normalise(res);
+}
@@ -0,0 +1,97 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+    Compares Kronecker substitution (_nmod_poly_mul_KS4 and
+    _nmod_poly_mul_KS) against _nmod_poly_mul_NTT for balanced products, for
+    a range of modulus sizes and lengths. Used to tune the cutoffs in
+    _nmod_poly_mul, _nmod_poly_mullow and _nmod_poly_mulhigh.
+*/
+
+int main(void)
+{
+    slong len, bits, i;
+    double t1, t2, t3;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("bits length KS (ms) KS4 (ms) NTT (ms) ratio\n");
+
+    for (bits = 4; bits <= FLINT_BITS; bits += 6)
+    {
+        for (len = 16; len <= 65536; len *= 2)
+        {
+            nmod_t mod;
+            mp_ptr a, b, c;
+            timeit_t timer;
+            slong reps;
+
+            nmod_init(&mod, n_randbits(state, FLINT_MIN(bits, FLINT_BITS)));
+
+            a = _nmod_vec_init(len);
+            b = _nmod_vec_init(len);
+            c = _nmod_vec_init(2 * len - 1);
+
+            for (i = 0; i < len; i++)
+            {
+                a[i] = n_randint(state, mod.n);
+                b[i] = n_randint(state, mod.n);
+            }
+
+            TIMEIT_REPEAT(timer, reps)
+                _nmod_poly_mul_KS(c, a, len, b, len, 0, mod);
+            TIMEIT_END_REPEAT(timer, reps)
+            t1 = (double) timer->cpu / reps;
+
+            TIMEIT_REPEAT(timer, reps)
+                _nmod_poly_mul_KS4(c, a, len, b, len, mod);
+            TIMEIT_END_REPEAT(timer, reps)
+            t2 = (double) timer->cpu / reps;
+
+            TIMEIT_REPEAT(timer, reps)
+                _nmod_poly_mul_NTT(c, a, len, b, len, mod);
+            TIMEIT_END_REPEAT(timer, reps)
+            t3 = (double) timer->cpu / reps;
+
+            flint_printf("%wd %wd %.4g %.4g %.4g %.3g\n",
+                         bits, len, t1, t2, t3, FLINT_MIN(t1, t2) / t3);
+
+            _nmod_vec_clear(a);
+            _nmod_vec_clear(b);
+            _nmod_vec_clear(c);
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    return 0;
+}
@@ -33,13 +33,13 @@
 #undef ulong
 
 #include <gmp.h>
-#include <pthread.h>
 
 #define ulong mp_limb_t
 
 #include "flint.h"
 #include "nmod_poly.h"
 #include "ulong_extras.h"
+#include "thread_pool.h"
 
 int
 main(void)
@@ -58,13 +58,11 @@ main(void)
         mp_limb_t m = n_randtest_prime(state, 0);
         slong j, num_threads;
         nmod_poly_matrix_precompute_arg_t * args1;
-        pthread_t *threads;
 
         flint_set_num_threads(1 + n_randint(state, 3));
 
         num_threads = flint_get_num_threads();
 
-        threads = flint_malloc(sizeof(pthread_t) * num_threads);
         tmp = flint_malloc(sizeof(nmod_poly_t) * num_threads);
 
         nmod_poly_init(a, m);
@@ -107,12 +105,10 @@ main(void)
             args1[j].poly1    = *tmp[j];
             args1[j].poly2    = *c;
             args1[j].poly2inv = *cinv;
-
-            pthread_create(&threads[j], NULL,
-                           _nmod_poly_precompute_matrix_worker, &args1[j]);
         }
-        for (j = 0; j < num_threads; j++)
-            pthread_join(threads[j], NULL);
+
+        flint_parallel_do(_nmod_poly_precompute_matrix_worker,
+                          args1, sizeof(nmod_poly_matrix_precompute_arg_t), num_threads);
 
         for (j = 0; j < num_threads; j++)
         {
@@ -141,7 +137,6 @@ main(void)
         flint_free(C);
         flint_free(tmp);
         flint_free(args1);
-        flint_free(threads);
     }
 
     /* check composition */
@@ -152,13 +147,11 @@ main(void)
         mp_limb_t m = n_randtest_prime(state, 0);
         slong j, num_threads;
         nmod_poly_compose_mod_precomp_preinv_arg_t * args1;
-        pthread_t *threads;
 
         flint_set_num_threads(1 + n_randint(state, 3));
 
         num_threads = flint_get_num_threads();
 
-        threads = flint_malloc(sizeof(pthread_t) * num_threads);
         res = flint_malloc(sizeof(nmod_poly_t) * num_threads);
 
         nmod_poly_init(a, m);
@@ -198,15 +191,12 @@ main(void)
             args1[j].poly1    = *a;
             args1[j].poly3    = *c;
             args1[j].poly3inv = *cinv;
-
-            pthread_create(&threads[j], NULL,
-                           _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker, &args1[j]);
         }
+
+        flint_parallel_do(_nmod_poly_compose_mod_brent_kung_precomp_preinv_worker,
+                          args1, sizeof(nmod_poly_compose_mod_precomp_preinv_arg_t), num_threads);
         for (j = 0; j < num_threads; j++)
-        {
-            pthread_join(threads[j], NULL);
             _nmod_poly_normalise(res[j]);
-        }
 
         for (j = 0; j < num_threads; j++)
         {
@@ -232,7 +222,6 @@ main(void)
             nmod_poly_clear(res[j]);
         flint_free(res);
         flint_free(args1);
-        flint_free(threads);
     }
 
     FLINT_TEST_CLEANUP(state);
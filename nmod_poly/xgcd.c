@@ -32,7 +32,8 @@ slong _nmod_poly_xgcd(mp_ptr G, mp_ptr S, mp_ptr T,
                      mp_srcptr A, slong lenA, mp_srcptr B, slong lenB, nmod_t mod)
 {
     const slong cutoff = FLINT_BIT_COUNT(mod.n) <= 8 ? 
-                        NMOD_POLY_SMALL_GCD_CUTOFF : NMOD_POLY_GCD_CUTOFF;
+                        flint_get_tuning()->nmod_poly_small_gcd_cutoff
+                      : flint_get_tuning()->nmod_poly_gcd_cutoff;
 
     if (lenA < cutoff)
         return _nmod_poly_xgcd_euclidean(G, S, T, A, lenA, B, lenB, mod);
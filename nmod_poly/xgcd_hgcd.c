@@ -110,7 +110,8 @@ slong _nmod_poly_xgcd_hgcd(mp_ptr G, mp_ptr S, mp_ptr T,
                           nmod_t mod)
 {
 	const slong cutoff = FLINT_BIT_COUNT(mod.n) <= 8 ? 
-                        NMOD_POLY_SMALL_GCD_CUTOFF : NMOD_POLY_GCD_CUTOFF;
+                        flint_get_tuning()->nmod_poly_small_gcd_cutoff
+                      : flint_get_tuning()->nmod_poly_gcd_cutoff;
 
     slong lenG, lenS, lenT;
 
@@ -0,0 +1,148 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#ifndef NMOD_SPARSE_MAT_H
+#define NMOD_SPARSE_MAT_H
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "longlong.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Sparse matrices in compressed sparse row (CSR) form. The nonzero entries
+    of row i are entries[k] in column cols[k] for row_start[i] <= k <
+    row_start[i + 1], with the columns strictly increasing along each row.
+    Entries are reduced and nonzero.
+*/
+typedef struct
+{
+    slong * row_start;
+    slong * cols;
+    mp_ptr entries;
+    slong r;
+    slong c;
+    slong alloc;    /* allocated length of cols and entries */
+    nmod_t mod;
+}
+nmod_sparse_mat_struct;
+
+typedef nmod_sparse_mat_struct nmod_sparse_mat_t[1];
+
+#define nmod_sparse_mat_nrows(mat) ((mat)->r)
+#define nmod_sparse_mat_ncols(mat) ((mat)->c)
+#define nmod_sparse_mat_nnz(mat) ((mat)->row_start[(mat)->r])
+
+/* products with at least this many entry operations use threads */
+#define NMOD_SPARSE_MAT_MUL_THREADED_CUTOFF 65536
+
+/* largest row weight produced by merging rows in structured elimination */
+#define NMOD_SPARSE_MAT_MERGE_MAX_WEIGHT 64
+
+/* random projections tried by the probabilistic solvers before giving up */
+#define NMOD_SPARSE_MAT_SOLVE_TRIES 3
+
+/* Memory management *********************************************************/
+
+FLINT_DLL void nmod_sparse_mat_init(nmod_sparse_mat_t mat, slong rows,
+                                                  slong cols, mp_limb_t n);
+
+FLINT_DLL void nmod_sparse_mat_clear(nmod_sparse_mat_t mat);
+
+FLINT_DLL void nmod_sparse_mat_fit_nnz(nmod_sparse_mat_t mat, slong nnz);
+
+FLINT_DLL void nmod_sparse_mat_zero(nmod_sparse_mat_t mat);
+
+FLINT_DLL void nmod_sparse_mat_swap(nmod_sparse_mat_t mat1,
+                                                  nmod_sparse_mat_t mat2);
+
+/* Conversion ****************************************************************/
+
+FLINT_DLL void nmod_sparse_mat_set_entries(nmod_sparse_mat_t mat,
+       const slong * rows, const slong * cols, mp_srcptr vals, slong len);
+
+FLINT_DLL void nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t mat,
+                                                      const nmod_mat_t src);
+
+FLINT_DLL void nmod_sparse_mat_get_nmod_mat(nmod_mat_t res,
+                                               const nmod_sparse_mat_t mat);
+
+FLINT_DLL void nmod_sparse_mat_transpose(nmod_sparse_mat_t B,
+                                                 const nmod_sparse_mat_t A);
+
+FLINT_DLL slong _nmod_sparse_mat_row_split(const nmod_sparse_mat_t A,
+                                                                  slong pos);
+
+FLINT_DLL slong _nmod_sparse_mat_max_row_weight(const nmod_sparse_mat_t A);
+
+/* Random generation *********************************************************/
+
+FLINT_DLL void nmod_sparse_mat_randtest(nmod_sparse_mat_t mat,
+                                    flint_rand_t state, slong row_weight);
+
+/* Multiplication ************************************************************/
+
+FLINT_DLL void nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A,
+                                                             mp_srcptr x);
+
+FLINT_DLL void nmod_sparse_mat_mul_mat(nmod_mat_t Y,
+                               const nmod_sparse_mat_t A, const nmod_mat_t X);
+
+/* Minimal polynomials of sequences ******************************************/
+
+FLINT_DLL slong _nmod_sparse_mat_berlekamp_massey(mp_ptr C, mp_srcptr s,
+                                                     slong len, nmod_t mod);
+
+/* Solving and elimination ***************************************************/
+
+FLINT_DLL int nmod_sparse_mat_solve_wiedemann(mp_ptr x,
+               const nmod_sparse_mat_t A, mp_srcptr b, flint_rand_t state);
+
+FLINT_DLL int nmod_sparse_mat_nullvector_wiedemann(mp_ptr x,
+                               const nmod_sparse_mat_t A, flint_rand_t state);
+
+FLINT_DLL int nmod_sparse_mat_solve_lanczos(mp_ptr x,
+               const nmod_sparse_mat_t A, mp_srcptr b, flint_rand_t state);
+
+FLINT_DLL slong nmod_sparse_mat_rank(const nmod_sparse_mat_t A);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
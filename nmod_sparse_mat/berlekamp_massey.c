@@ -0,0 +1,96 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+slong
+_nmod_sparse_mat_berlekamp_massey(mp_ptr C, mp_srcptr s, slong len,
+                                                                 nmod_t mod)
+{
+    slong i, j, L, m, Blen, Clen, Tlen;
+    mp_ptr B, T;
+    mp_limb_t d, b, coeff;
+
+    B = _nmod_vec_init(len + 1);
+    T = _nmod_vec_init(len + 1);
+
+    _nmod_vec_zero(C, len + 1);
+    C[0] = 1;
+    B[0] = 1;
+    Clen = Blen = 1;
+    L = 0;
+    m = 1;
+    b = 1;
+
+    for (i = 0; i < len; i++)
+    {
+        /* discrepancy of the current generator at term i */
+        d = s[i];
+        for (j = 1; j <= L; j++)
+            d = nmod_add(d, n_mulmod2_preinv(C[j], s[i - j], mod.n, mod.ninv),
+                                                                        mod);
+
+        if (d == 0)
+        {
+            m++;
+            continue;
+        }
+
+        coeff = n_mulmod2_preinv(d, n_invmod(b, mod.n), mod.n, mod.ninv);
+        coeff = nmod_neg(coeff, mod);
+        Blen = FLINT_MIN(Blen, len + 1 - m);
+
+        if (2 * L <= i)
+        {
+            _nmod_vec_set(T, C, Clen);
+            Tlen = Clen;
+
+            /* C = C - (d / b) z^m B */
+            _nmod_vec_scalar_addmul_nmod(C + m, B, Blen, coeff, mod);
+            Clen = FLINT_MAX(Clen, Blen + m);
+
+            L = i + 1 - L;
+            _nmod_vec_set(B, T, Tlen);
+            Blen = Tlen;
+            b = d;
+            m = 1;
+        }
+        else
+        {
+            _nmod_vec_scalar_addmul_nmod(C + m, B, Blen, coeff, mod);
+            Clen = FLINT_MAX(Clen, Blen + m);
+            m++;
+        }
+    }
+
+    _nmod_vec_clear(B);
+    _nmod_vec_clear(T);
+
+    return L;
+}
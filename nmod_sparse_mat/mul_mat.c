@@ -0,0 +1,132 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    nmod_mat_struct * Y;
+    const nmod_sparse_mat_struct * A;
+    const nmod_mat_struct * X;
+    slong start;
+    slong end;
+    int nlimbs;
+} _mul_mat_arg_t;
+
+static void *
+_nmod_sparse_mat_mul_mat_worker(void * arg_ptr)
+{
+    _mul_mat_arg_t arg = *((_mul_mat_arg_t *) arg_ptr);
+    const nmod_sparse_mat_struct * A = arg.A;
+    const nmod_mat_struct * X = arg.X;
+    nmod_mat_struct * Y = arg.Y;
+    nmod_t mod = A->mod;
+    slong i, j, k, n = X->c;
+    mp_ptr tmp, Xrow, Yrow;
+    mp_limb_t a;
+
+    tmp = (arg.nlimbs == 1) ? _nmod_vec_init(n) : NULL;
+
+    for (i = arg.start; i < arg.end; i++)
+    {
+        Yrow = Y->rows[i];
+
+        if (arg.nlimbs == 1)
+        {
+            /* no row sum can overflow a limb, so reduce only at the end */
+            for (j = 0; j < n; j++)
+                tmp[j] = 0;
+
+            for (k = A->row_start[i]; k < A->row_start[i + 1]; k++)
+            {
+                a = A->entries[k];
+                Xrow = X->rows[A->cols[k]];
+                for (j = 0; j < n; j++)
+                    tmp[j] += a * Xrow[j];
+            }
+
+            _nmod_vec_reduce(Yrow, tmp, n, mod);
+        }
+        else
+        {
+            _nmod_vec_zero(Yrow, n);
+
+            for (k = A->row_start[i]; k < A->row_start[i + 1]; k++)
+                _nmod_vec_scalar_addmul_nmod(Yrow, X->rows[A->cols[k]], n,
+                                                         A->entries[k], mod);
+        }
+    }
+
+    if (tmp != NULL)
+        _nmod_vec_clear(tmp);
+
+    return NULL;
+}
+
+void
+nmod_sparse_mat_mul_mat(nmod_mat_t Y, const nmod_sparse_mat_t A,
+                                                         const nmod_mat_t X)
+{
+    slong i, nnz, num_threads, num_tasks;
+    _mul_mat_arg_t * args;
+    int nlimbs;
+
+    if (A->r == 0 || X->c == 0)
+        return;
+
+    nnz = nmod_sparse_mat_nnz(A);
+    nlimbs = _nmod_vec_dot_bound_limbs(_nmod_sparse_mat_max_row_weight(A),
+                                                                     A->mod);
+
+    num_threads = flint_get_num_threads();
+    if (nnz * X->c < NMOD_SPARSE_MAT_MUL_THREADED_CUTOFF)
+        num_threads = 1;
+    num_tasks = FLINT_MIN(num_threads, A->r);
+
+    args = flint_malloc(num_tasks * sizeof(_mul_mat_arg_t));
+
+    for (i = 0; i < num_tasks; i++)
+    {
+        args[i].Y = Y;
+        args[i].A = A;
+        args[i].X = X;
+        args[i].start = (i == 0) ? 0 :
+            _nmod_sparse_mat_row_split(A, (i * nnz) / num_tasks);
+        args[i].end = (i == num_tasks - 1) ? A->r :
+            _nmod_sparse_mat_row_split(A, ((i + 1) * nnz) / num_tasks);
+        args[i].nlimbs = nlimbs;
+    }
+
+    flint_parallel_do(_nmod_sparse_mat_mul_mat_worker, args,
+                      sizeof(_mul_mat_arg_t), num_tasks);
+
+    flint_free(args);
+}
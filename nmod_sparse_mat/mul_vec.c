@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    mp_ptr y;
+    const nmod_sparse_mat_struct * A;
+    mp_srcptr x;
+    slong start;
+    slong end;
+    int nlimbs;
+} _mul_vec_arg_t;
+
+static void *
+_nmod_sparse_mat_mul_vec_worker(void * arg_ptr)
+{
+    _mul_vec_arg_t arg = *((_mul_vec_arg_t *) arg_ptr);
+    const nmod_sparse_mat_struct * A = arg.A;
+    mp_srcptr x = arg.x;
+    const slong * cols;
+    mp_srcptr entries;
+    nmod_t mod = A->mod;
+    slong i, k, len;
+    mp_limb_t s;
+
+    for (i = arg.start; i < arg.end; i++)
+    {
+        cols = A->cols + A->row_start[i];
+        entries = A->entries + A->row_start[i];
+        len = A->row_start[i + 1] - A->row_start[i];
+
+        NMOD_VEC_DOT(s, k, len, entries[k], x[cols[k]], mod, arg.nlimbs);
+        arg.y[i] = s;
+    }
+
+    return NULL;
+}
+
+void
+nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A, mp_srcptr x)
+{
+    slong i, nnz, num_threads, num_tasks;
+    _mul_vec_arg_t * args;
+    int nlimbs;
+
+    if (A->r == 0)
+        return;
+
+    nnz = nmod_sparse_mat_nnz(A);
+    nlimbs = _nmod_vec_dot_bound_limbs(_nmod_sparse_mat_max_row_weight(A),
+                                                                     A->mod);
+
+    num_threads = flint_get_num_threads();
+    if (nnz < NMOD_SPARSE_MAT_MUL_THREADED_CUTOFF)
+        num_threads = 1;
+    num_tasks = FLINT_MIN(num_threads, A->r);
+
+    args = flint_malloc(num_tasks * sizeof(_mul_vec_arg_t));
+
+    /* give each task a contiguous range of rows with a similar number of
+       entries */
+    for (i = 0; i < num_tasks; i++)
+    {
+        args[i].y = y;
+        args[i].A = A;
+        args[i].x = x;
+        args[i].start = (i == 0) ? 0 :
+            _nmod_sparse_mat_row_split(A, (i * nnz) / num_tasks);
+        args[i].end = (i == num_tasks - 1) ? A->r :
+            _nmod_sparse_mat_row_split(A, ((i + 1) * nnz) / num_tasks);
+        args[i].nlimbs = nlimbs;
+    }
+
+    flint_parallel_do(_nmod_sparse_mat_mul_vec_worker, args,
+                      sizeof(_mul_vec_arg_t), num_tasks);
+
+    flint_free(args);
+}
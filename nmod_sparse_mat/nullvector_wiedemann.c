@@ -0,0 +1,129 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+/*
+    For a random v, the generator f = C_0 z^L + ... + C_L of u^T A^i v is
+    likely the minimal polynomial of v. If A is singular it is divisible by
+    z, say f = z^t h with h(0) nonzero. Then A^t h(A) v = 0, so the last
+    nonzero vector among h(A) v, A h(A) v, ... lies in the nullspace.
+*/
+int
+nmod_sparse_mat_nullvector_wiedemann(mp_ptr x, const nmod_sparse_mat_t A,
+                                                         flint_rand_t state)
+{
+    slong i, j, n, t, L, len;
+    mp_ptr u, v, w, y, s, C;
+    nmod_t mod = A->mod;
+    int nlimbs, attempt, success = 0;
+
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (nmod_sparse_mat_nullvector_wiedemann). "
+                     "Non-square matrix.\n");
+        abort();
+    }
+
+    n = A->r;
+
+    if (n == 0)
+        return 0;
+
+    len = 2 * n;
+    nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
+    u = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+    y = _nmod_vec_init(n);
+    s = _nmod_vec_init(len);
+    C = _nmod_vec_init(len + 1);
+
+    for (attempt = 0; attempt < NMOD_SPARSE_MAT_SOLVE_TRIES && !success;
+                                                                   attempt++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            u[i] = n_randint(state, mod.n);
+            v[i] = n_randint(state, mod.n);
+        }
+
+        _nmod_vec_set(w, v, n);
+        for (i = 0; i < len; i++)
+        {
+            s[i] = _nmod_vec_dot(u, w, n, mod, nlimbs);
+            if (i + 1 < len)
+            {
+                nmod_sparse_mat_mul_vec(y, A, w);
+                MP_PTR_SWAP(w, y);
+            }
+        }
+
+        L = _nmod_sparse_mat_berlekamp_massey(C, s, len, mod);
+
+        for (t = 0; t < L && C[L - t] == 0; t++) ;
+
+        if (t == 0)
+            continue;
+
+        /* w = h(A) v */
+        _nmod_vec_set(w, v, n);
+        for (j = 1; j <= L - t; j++)
+        {
+            nmod_sparse_mat_mul_vec(y, A, w);
+            _nmod_vec_scalar_addmul_nmod(y, v, n, C[j], mod);
+            MP_PTR_SWAP(w, y);
+        }
+
+        if (_nmod_vec_is_zero(w, n))
+            continue;
+
+        for (i = 0; i < t && !success; i++)
+        {
+            nmod_sparse_mat_mul_vec(y, A, w);
+            if (_nmod_vec_is_zero(y, n))
+            {
+                _nmod_vec_set(x, w, n);
+                success = 1;
+            }
+            else
+                MP_PTR_SWAP(w, y);
+        }
+    }
+
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(v);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(y);
+    _nmod_vec_clear(s);
+    _nmod_vec_clear(C);
+
+    return success;
+}
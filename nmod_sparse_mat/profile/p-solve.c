@@ -0,0 +1,105 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   Compares nmod_mat_solve on the dense form of a random sparse system with
+   nmod_sparse_mat_solve_wiedemann and nmod_sparse_mat_solve_lanczos, for
+   about WEIGHT nonzero entries per row.
+*/
+
+#define WEIGHT 8
+
+int main(void)
+{
+    slong n;
+    mp_limb_t p;
+    FLINT_TEST_INIT(state);
+
+    p = n_nextprime(UWORD(1) << (FLINT_BITS - 4), 1);
+
+    flint_printf("times in ms: dense, wiedemann, lanczos\n");
+
+    for (n = 250; n <= 4000; n *= 2)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t M, X, B;
+        mp_ptr x, b;
+        timeit_t t0, t1, t2;
+        slong j;
+
+        nmod_sparse_mat_init(A, n, n, p);
+        nmod_mat_init(M, n, n, p);
+        nmod_mat_init(X, n, 1, p);
+        nmod_mat_init(B, n, 1, p);
+        x = _nmod_vec_init(n);
+        b = _nmod_vec_init(n);
+
+        /* a nonzero diagonal keeps the system nonsingular in practice */
+        nmod_sparse_mat_randtest(A, state, WEIGHT - 1);
+        nmod_sparse_mat_get_nmod_mat(M, A);
+        for (j = 0; j < n; j++)
+            nmod_mat_entry(M, j, j) = 1 + n_randint(state, p - 1);
+        nmod_sparse_mat_set_nmod_mat(A, M);
+        for (j = 0; j < n; j++)
+        {
+            b[j] = n_randint(state, p);
+            nmod_mat_entry(B, j, 0) = b[j];
+        }
+
+        timeit_start(t0);
+        nmod_mat_solve(X, M, B);
+        timeit_stop(t0);
+
+        timeit_start(t1);
+        nmod_sparse_mat_solve_wiedemann(x, A, b, state);
+        timeit_stop(t1);
+
+        timeit_start(t2);
+        nmod_sparse_mat_solve_lanczos(x, A, b, state);
+        timeit_stop(t2);
+
+        flint_printf("n = %wd: %wd %wd %wd\n", n, t0->cpu, t1->cpu, t2->cpu);
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(M);
+        nmod_mat_clear(X);
+        nmod_mat_clear(B);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(b);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    return 0;
+}
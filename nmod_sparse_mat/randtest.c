@@ -0,0 +1,69 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_randtest(nmod_sparse_mat_t mat, flint_rand_t state,
+                                                         slong row_weight)
+{
+    slong i, j, len;
+    slong * rows, * cols;
+    mp_ptr vals;
+    mp_limb_t n = mat->mod.n;
+
+    if (n == 1)
+    {
+        nmod_sparse_mat_zero(mat);
+        return;
+    }
+
+    len = mat->r * row_weight;
+    rows = flint_malloc(len * sizeof(slong));
+    cols = flint_malloc(len * sizeof(slong));
+    vals = _nmod_vec_init(len);
+
+    len = 0;
+    for (i = 0; i < mat->r && mat->c != 0; i++)
+    {
+        for (j = 0; j < row_weight; j++)
+        {
+            rows[len] = i;
+            cols[len] = n_randint(state, mat->c);
+            vals[len] = 1 + n_randint(state, n - 1);
+            len++;
+        }
+    }
+
+    nmod_sparse_mat_set_entries(mat, rows, cols, vals, len);
+
+    flint_free(rows);
+    flint_free(cols);
+    _nmod_vec_clear(vals);
+}
@@ -0,0 +1,334 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+/*
+    Structured Gaussian elimination. A column with a single nonzero entry
+    can be eliminated together with its row, increasing the rank by one.
+    A column with two nonzero entries is reduced to one by subtracting a
+    multiple of the shorter row from the other, provided the result is not
+    heavier than NMOD_SPARSE_MAT_MERGE_MAX_WEIGHT. The rows and columns
+    which survive are copied into a dense matrix, whose rank is added.
+
+    The rows are kept as separately allocated sorted lists. Every column
+    keeps a list of rows which may contain it; entries go stale as rows are
+    eliminated or lose the column, and are discarded when the list is read.
+*/
+
+typedef struct
+{
+    nmod_t mod;
+    slong ** rcols;
+    mp_ptr * rvals;
+    slong * rlen;
+    char * ractive;
+    slong * cw;
+    slong ** clist;
+    slong * clen;
+    slong * clist_alloc;
+    slong * stack;
+    slong slen;
+    slong salloc;
+} _sge_struct;
+
+static void
+_sge_push(_sge_struct * S, slong j)
+{
+    if (S->slen == S->salloc)
+    {
+        S->salloc = 2 * S->salloc + 16;
+        S->stack = flint_realloc(S->stack, S->salloc * sizeof(slong));
+    }
+    S->stack[S->slen++] = j;
+}
+
+static void
+_sge_clist_append(_sge_struct * S, slong j, slong i)
+{
+    if (S->clen[j] == S->clist_alloc[j])
+    {
+        S->clist_alloc[j] = 2 * S->clist_alloc[j] + 2;
+        S->clist[j] = flint_realloc(S->clist[j],
+                                         S->clist_alloc[j] * sizeof(slong));
+    }
+    S->clist[j][S->clen[j]++] = i;
+}
+
+/* position of column j in row i, or -1 */
+static slong
+_sge_find(const _sge_struct * S, slong i, slong j)
+{
+    slong lo = 0, hi = S->rlen[i] - 1, mid;
+    const slong * cols = S->rcols[i];
+
+    while (lo <= hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (cols[mid] == j)
+            return mid;
+        if (cols[mid] < j)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+
+    return -1;
+}
+
+/* the distinct active rows containing column j, pruning its list */
+static slong
+_sge_col_rows(_sge_struct * S, slong j, slong * rows)
+{
+    slong k, i, len = 0, count = 0;
+
+    for (k = 0; k < S->clen[j]; k++)
+    {
+        i = S->clist[j][k];
+        if (S->ractive[i] && _sge_find(S, i, j) >= 0
+                && (count == 0 || rows[0] != i) && (count < 2 || rows[1] != i))
+        {
+            if (count < 2)
+                rows[count] = i;
+            count++;
+            S->clist[j][len++] = i;
+        }
+    }
+    S->clen[j] = len;
+
+    return count;
+}
+
+static void
+_sge_remove_row(_sge_struct * S, slong i)
+{
+    slong k, j;
+
+    S->ractive[i] = 0;
+    for (k = 0; k < S->rlen[i]; k++)
+    {
+        j = S->rcols[i][k];
+        S->cw[j]--;
+        if (S->cw[j] == 1 || S->cw[j] == 2)
+            _sge_push(S, j);
+    }
+}
+
+/* row q -= (q_j / p_j) row p; returns 0 if the result would be too heavy */
+static int
+_sge_merge(_sge_struct * S, slong p, slong q, slong j)
+{
+    slong a, b, len, lp = S->rlen[p], lq = S->rlen[q];
+    const slong * pc = S->rcols[p], * qc = S->rcols[q];
+    mp_srcptr pv = S->rvals[p], qv = S->rvals[q];
+    slong * cols;
+    mp_ptr vals;
+    mp_limb_t c;
+    nmod_t mod = S->mod;
+
+    if (lp + lq - 2 > NMOD_SPARSE_MAT_MERGE_MAX_WEIGHT)
+        return 0;
+
+    c = n_mulmod2_preinv(qv[_sge_find(S, q, j)],
+               n_invmod(pv[_sge_find(S, p, j)], mod.n), mod.n, mod.ninv);
+    c = nmod_neg(c, mod);
+
+    cols = flint_malloc((lp + lq) * sizeof(slong));
+    vals = _nmod_vec_init(lp + lq);
+
+    for (a = 0; a < lq; a++)
+        S->cw[qc[a]]--;
+
+    a = b = len = 0;
+    while (a < lp || b < lq)
+    {
+        if (b == lq || (a < lp && pc[a] < qc[b]))
+        {
+            cols[len] = pc[a];
+            vals[len] = n_mulmod2_preinv(pv[a], c, mod.n, mod.ninv);
+            _sge_clist_append(S, pc[a], q);
+            a++;
+        }
+        else if (a == lp || qc[b] < pc[a])
+        {
+            cols[len] = qc[b];
+            vals[len] = qv[b];
+            b++;
+        }
+        else
+        {
+            cols[len] = qc[b];
+            vals[len] = nmod_add(qv[b],
+                         n_mulmod2_preinv(pv[a], c, mod.n, mod.ninv), mod);
+            a++;
+            b++;
+        }
+
+        if (vals[len] != 0)
+        {
+            S->cw[cols[len]]++;
+            len++;
+        }
+    }
+
+    flint_free(S->rcols[q]);
+    _nmod_vec_clear(S->rvals[q]);
+    S->rcols[q] = cols;
+    S->rvals[q] = vals;
+    S->rlen[q] = len;
+
+    for (a = 0; a < len; a++)
+        if (S->cw[cols[a]] == 1 || S->cw[cols[a]] == 2)
+            _sge_push(S, cols[a]);
+
+    return 1;
+}
+
+slong
+nmod_sparse_mat_rank(const nmod_sparse_mat_t A)
+{
+    _sge_struct S[1];
+    slong i, j, k, len, rank, nr, nc, rows[2];
+    slong * cmap;
+    nmod_mat_t M;
+
+    S->mod = A->mod;
+    S->rcols = flint_malloc(A->r * sizeof(slong *));
+    S->rvals = flint_malloc(A->r * sizeof(mp_ptr));
+    S->rlen = flint_malloc(A->r * sizeof(slong));
+    S->ractive = flint_malloc(A->r);
+    S->cw = flint_calloc(A->c, sizeof(slong));
+    S->clist = flint_calloc(A->c, sizeof(slong *));
+    S->clen = flint_calloc(A->c, sizeof(slong));
+    S->clist_alloc = flint_calloc(A->c, sizeof(slong));
+    S->stack = NULL;
+    S->slen = S->salloc = 0;
+
+    for (i = 0; i < A->r; i++)
+    {
+        len = A->row_start[i + 1] - A->row_start[i];
+        S->rlen[i] = len;
+        S->ractive[i] = (len != 0);
+        S->rcols[i] = flint_malloc(len * sizeof(slong));
+        S->rvals[i] = _nmod_vec_init(len);
+
+        for (k = 0; k < len; k++)
+        {
+            j = A->cols[A->row_start[i] + k];
+            S->rcols[i][k] = j;
+            S->rvals[i][k] = A->entries[A->row_start[i] + k];
+            S->cw[j]++;
+            _sge_clist_append(S, j, i);
+        }
+    }
+
+    for (j = 0; j < A->c; j++)
+        if (S->cw[j] == 1 || S->cw[j] == 2)
+            _sge_push(S, j);
+
+    rank = 0;
+    while (S->slen > 0)
+    {
+        j = S->stack[--S->slen];
+
+        if (S->cw[j] == 1)
+        {
+            _sge_col_rows(S, j, rows);
+            _sge_remove_row(S, rows[0]);
+            rank++;
+        }
+        else if (S->cw[j] == 2)
+        {
+            _sge_col_rows(S, j, rows);
+            if (S->rlen[rows[0]] > S->rlen[rows[1]])
+            {
+                k = rows[0];
+                rows[0] = rows[1];
+                rows[1] = k;
+            }
+
+            if (_sge_merge(S, rows[0], rows[1], j))
+            {
+                _sge_remove_row(S, rows[0]);
+                rank++;
+            }
+        }
+    }
+
+    /* dense elimination on what remains */
+    cmap = flint_malloc(A->c * sizeof(slong));
+    nc = 0;
+    for (j = 0; j < A->c; j++)
+        cmap[j] = (S->cw[j] > 0) ? nc++ : -1;
+
+    nr = 0;
+    for (i = 0; i < A->r; i++)
+        nr += (S->ractive[i] && S->rlen[i] != 0);
+
+    if (nr != 0 && nc != 0)
+    {
+        nmod_mat_init(M, nr, nc, A->mod.n);
+        nr = 0;
+        for (i = 0; i < A->r; i++)
+        {
+            if (S->ractive[i] && S->rlen[i] != 0)
+            {
+                for (k = 0; k < S->rlen[i]; k++)
+                    nmod_mat_entry(M, nr, cmap[S->rcols[i][k]]) =
+                                                             S->rvals[i][k];
+                nr++;
+            }
+        }
+
+        rank += nmod_mat_rank(M);
+        nmod_mat_clear(M);
+    }
+
+    for (i = 0; i < A->r; i++)
+    {
+        flint_free(S->rcols[i]);
+        _nmod_vec_clear(S->rvals[i]);
+    }
+    for (j = 0; j < A->c; j++)
+        flint_free(S->clist[j]);
+
+    flint_free(cmap);
+    flint_free(S->rcols);
+    flint_free(S->rvals);
+    flint_free(S->rlen);
+    flint_free(S->ractive);
+    flint_free(S->cw);
+    flint_free(S->clist);
+    flint_free(S->clen);
+    flint_free(S->clist_alloc);
+    flint_free(S->stack);
+
+    return rank;
+}
@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+typedef struct
+{
+    slong col;
+    mp_limb_t val;
+} _entry_t;
+
+static int
+_entry_cmp(const void * a, const void * b)
+{
+    slong x = ((const _entry_t *) a)->col;
+    slong y = ((const _entry_t *) b)->col;
+
+    return (x > y) - (x < y);
+}
+
+void
+nmod_sparse_mat_set_entries(nmod_sparse_mat_t mat, const slong * rows,
+                             const slong * cols, mp_srcptr vals, slong len)
+{
+    slong i, k, pos, nnz;
+    slong * start;
+    _entry_t * e;
+    nmod_t mod = mat->mod;
+
+    /* bucket the triples by row */
+    start = flint_calloc(mat->r + 1, sizeof(slong));
+    e = flint_malloc(len * sizeof(_entry_t));
+
+    for (k = 0; k < len; k++)
+        start[rows[k] + 1]++;
+    for (i = 0; i < mat->r; i++)
+        start[i + 1] += start[i];
+
+    for (k = 0; k < len; k++)
+    {
+        pos = start[rows[k]]++;
+        e[pos].col = cols[k];
+        NMOD_RED(e[pos].val, vals[k], mod);
+    }
+
+    /* start[i] is now the end of bucket i */
+    nmod_sparse_mat_fit_nnz(mat, len);
+
+    nnz = 0;
+    pos = 0;
+    for (i = 0; i < mat->r; i++)
+    {
+        mat->row_start[i] = nnz;
+        qsort(e + pos, start[i] - pos, sizeof(_entry_t), _entry_cmp);
+
+        /* sum repeated columns and drop zeros */
+        for (k = pos; k < start[i]; k++)
+        {
+            if (nnz > mat->row_start[i] && mat->cols[nnz - 1] == e[k].col)
+                mat->entries[nnz - 1] =
+                    nmod_add(mat->entries[nnz - 1], e[k].val, mod);
+            else
+            {
+                if (nnz > mat->row_start[i] && mat->entries[nnz - 1] == 0)
+                    nnz--;
+                mat->cols[nnz] = e[k].col;
+                mat->entries[nnz] = e[k].val;
+                nnz++;
+            }
+        }
+
+        if (nnz > mat->row_start[i] && mat->entries[nnz - 1] == 0)
+            nnz--;
+
+        pos = start[i];
+    }
+    mat->row_start[mat->r] = nnz;
+
+    flint_free(e);
+    flint_free(start);
+}
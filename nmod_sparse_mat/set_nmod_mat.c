@@ -0,0 +1,59 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t mat, const nmod_mat_t src)
+{
+    slong i, j, nnz;
+
+    nnz = 0;
+    for (i = 0; i < src->r; i++)
+        for (j = 0; j < src->c; j++)
+            nnz += (nmod_mat_entry(src, i, j) != 0);
+
+    nmod_sparse_mat_fit_nnz(mat, nnz);
+
+    nnz = 0;
+    for (i = 0; i < src->r; i++)
+    {
+        mat->row_start[i] = nnz;
+        for (j = 0; j < src->c; j++)
+        {
+            if (nmod_mat_entry(src, i, j) != 0)
+            {
+                mat->cols[nnz] = j;
+                mat->entries[nnz] = nmod_mat_entry(src, i, j);
+                nnz++;
+            }
+        }
+    }
+    mat->row_start[src->r] = nnz;
+}
@@ -0,0 +1,152 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+static void
+_vec_mul_diag(mp_ptr res, mp_srcptr d, mp_srcptr vec, slong len, nmod_t mod)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        res[i] = n_mulmod2_preinv(d[i], vec[i], mod.n, mod.ninv);
+}
+
+/*
+    Lanczos iteration for the symmetric system B y = c with B = D A^T A D
+    and c = D A^T b, where D is a random nonsingular diagonal matrix. The
+    vectors w_i are pairwise B-orthogonal, and a breakdown occurs when some
+    w_i is nonzero but B-orthogonal to itself; the preconditioner D makes
+    this unlikely for large moduli. A solution x = D y is verified before
+    returning.
+*/
+int
+nmod_sparse_mat_solve_lanczos(mp_ptr x, const nmod_sparse_mat_t A,
+                                           mp_srcptr b, flint_rand_t state)
+{
+    slong i, m, n;
+    nmod_sparse_mat_t At;
+    mp_ptr d, c, y, w, wprev, Bw, Bwprev, t1, t2;
+    mp_limb_t a, ainv, aprevinv, beta, gamma;
+    nmod_t mod = A->mod;
+    int nlimbs, attempt, success = 0;
+
+    m = A->r;
+    n = A->c;
+
+    if (_nmod_vec_is_zero(b, m))
+    {
+        _nmod_vec_zero(x, n);
+        return 1;
+    }
+
+    if (n == 0)
+        return 0;
+
+    nmod_sparse_mat_init(At, n, m, mod.n);
+    nmod_sparse_mat_transpose(At, A);
+
+    nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
+    d = _nmod_vec_init(n);
+    c = _nmod_vec_init(n);
+    y = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+    wprev = _nmod_vec_init(n);
+    Bw = _nmod_vec_init(n);
+    Bwprev = _nmod_vec_init(n);
+    t1 = _nmod_vec_init(n);
+    t2 = _nmod_vec_init(m);
+
+    for (attempt = 0; attempt < NMOD_SPARSE_MAT_SOLVE_TRIES && !success;
+                                                                   attempt++)
+    {
+        for (i = 0; i < n; i++)
+            d[i] = 1 + n_randint(state, mod.n - 1);
+
+        nmod_sparse_mat_mul_vec(t1, At, b);
+        _vec_mul_diag(c, d, t1, n, mod);
+
+        _nmod_vec_set(w, c, n);
+        _nmod_vec_zero(wprev, n);
+        _nmod_vec_zero(Bwprev, n);
+        _nmod_vec_zero(y, n);
+        aprevinv = 0;
+
+        for (i = 0; i <= n && !_nmod_vec_is_zero(w, n); i++)
+        {
+            _vec_mul_diag(t1, d, w, n, mod);
+            nmod_sparse_mat_mul_vec(t2, A, t1);
+            nmod_sparse_mat_mul_vec(t1, At, t2);
+            _vec_mul_diag(Bw, d, t1, n, mod);
+
+            a = _nmod_vec_dot(w, Bw, n, mod, nlimbs);
+            if (a == 0)
+                break;
+            ainv = n_invmod(a, mod.n);
+
+            /* y += (<w, c> / <w, Bw>) w */
+            _nmod_vec_scalar_addmul_nmod(y, w, n, n_mulmod2_preinv(
+                _nmod_vec_dot(w, c, n, mod, nlimbs), ainv, mod.n, mod.ninv),
+                                                                        mod);
+
+            /* next w = Bw - beta w - gamma wprev, written over wprev */
+            beta = n_mulmod2_preinv(_nmod_vec_dot(Bw, Bw, n, mod, nlimbs),
+                                                   ainv, mod.n, mod.ninv);
+            gamma = n_mulmod2_preinv(_nmod_vec_dot(Bw, Bwprev, n, mod, nlimbs),
+                                               aprevinv, mod.n, mod.ninv);
+
+            _nmod_vec_scalar_mul_nmod(wprev, wprev, n,
+                                                 nmod_neg(gamma, mod), mod);
+            _nmod_vec_scalar_addmul_nmod(wprev, w, n,
+                                                 nmod_neg(beta, mod), mod);
+            _nmod_vec_add(wprev, wprev, Bw, n, mod);
+
+            MP_PTR_SWAP(w, wprev);
+            MP_PTR_SWAP(Bw, Bwprev);
+            aprevinv = ainv;
+        }
+
+        _vec_mul_diag(x, d, y, n, mod);
+        nmod_sparse_mat_mul_vec(t2, A, x);
+        success = _nmod_vec_equal(t2, b, m);
+    }
+
+    nmod_sparse_mat_clear(At);
+    _nmod_vec_clear(d);
+    _nmod_vec_clear(c);
+    _nmod_vec_clear(y);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(wprev);
+    _nmod_vec_clear(Bw);
+    _nmod_vec_clear(Bwprev);
+    _nmod_vec_clear(t1);
+    _nmod_vec_clear(t2);
+
+    return success;
+}
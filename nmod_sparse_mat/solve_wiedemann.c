@@ -0,0 +1,115 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+/*
+    The sequence u^T A^i b has a generator C_0 z^L + ... + C_L dividing the
+    minimal polynomial of b, and equal to it for most u. If C_L is nonzero,
+    then x = -(C_0 A^(L-1) + ... + C_(L-1)) b / C_L solves A x = b.
+*/
+int
+nmod_sparse_mat_solve_wiedemann(mp_ptr x, const nmod_sparse_mat_t A,
+                                           mp_srcptr b, flint_rand_t state)
+{
+    slong i, j, n, L, len;
+    mp_ptr u, v, w, s, C;
+    nmod_t mod = A->mod;
+    int nlimbs, attempt, success = 0;
+
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (nmod_sparse_mat_solve_wiedemann). "
+                     "Non-square matrix.\n");
+        abort();
+    }
+
+    n = A->r;
+
+    if (_nmod_vec_is_zero(b, n))
+    {
+        _nmod_vec_zero(x, n);
+        return 1;
+    }
+
+    len = 2 * n;
+    nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
+    u = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+    s = _nmod_vec_init(len);
+    C = _nmod_vec_init(len + 1);
+
+    for (attempt = 0; attempt < NMOD_SPARSE_MAT_SOLVE_TRIES && !success;
+                                                                   attempt++)
+    {
+        for (i = 0; i < n; i++)
+            u[i] = n_randint(state, mod.n);
+
+        _nmod_vec_set(v, b, n);
+        for (i = 0; i < len; i++)
+        {
+            s[i] = _nmod_vec_dot(u, v, n, mod, nlimbs);
+            if (i + 1 < len)
+            {
+                nmod_sparse_mat_mul_vec(w, A, v);
+                MP_PTR_SWAP(v, w);
+            }
+        }
+
+        L = _nmod_sparse_mat_berlekamp_massey(C, s, len, mod);
+
+        if (L == 0 || C[L] == 0)
+            continue;
+
+        /* Horner evaluation of the quotient by z */
+        _nmod_vec_set(v, b, n);
+        for (j = 1; j < L; j++)
+        {
+            nmod_sparse_mat_mul_vec(w, A, v);
+            _nmod_vec_scalar_addmul_nmod(w, b, n, C[j], mod);
+            MP_PTR_SWAP(v, w);
+        }
+
+        _nmod_vec_scalar_mul_nmod(x, v, n,
+                      nmod_neg(n_invmod(C[L], mod.n), mod), mod);
+
+        nmod_sparse_mat_mul_vec(w, A, x);
+        success = _nmod_vec_equal(w, b, n);
+    }
+
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(v);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(s);
+    _nmod_vec_clear(C);
+
+    return success;
+}
@@ -0,0 +1,102 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_mat....");
+    fflush(stdout);
+
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t M, X, Y, Z;
+        slong r, c, k;
+        mp_limb_t n;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        /* sometimes large enough to use threads */
+        if (n_randint(state, 20) == 0)
+        {
+            r = 300 + n_randint(state, 300);
+            c = 300 + n_randint(state, 300);
+            k = 16 + n_randint(state, 16);
+        }
+        else
+        {
+            r = n_randint(state, 40);
+            c = n_randint(state, 40);
+            k = n_randint(state, 10);
+        }
+        n = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(A, r, c, n);
+        nmod_mat_init(M, r, c, n);
+        nmod_mat_init(X, c, k, n);
+        nmod_mat_init(Y, r, k, n);
+        nmod_mat_init(Z, r, k, n);
+
+        nmod_sparse_mat_randtest(A, state, n_randint(state, 30));
+        nmod_mat_randtest(X, state);
+        nmod_mat_randtest(Y, state);
+
+        nmod_sparse_mat_mul_mat(Y, A, X);
+
+        nmod_sparse_mat_get_nmod_mat(M, A);
+        nmod_mat_mul(Z, M, X);
+
+        if (!nmod_mat_equal(Y, Z))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("r = %wd, c = %wd, k = %wd, n = %wu\n", r, c, k, n);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(M);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        nmod_mat_clear(Z);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
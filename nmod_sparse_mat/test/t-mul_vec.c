@@ -0,0 +1,108 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_vec....");
+    fflush(stdout);
+
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t M, X, Y;
+        mp_ptr x, y;
+        slong j, r, c;
+        mp_limb_t n;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        /* sometimes large enough to use threads */
+        if (n_randint(state, 20) == 0)
+        {
+            r = 1000 + n_randint(state, 1000);
+            c = 1000 + n_randint(state, 1000);
+        }
+        else
+        {
+            r = n_randint(state, 50);
+            c = n_randint(state, 50);
+        }
+        n = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(A, r, c, n);
+        nmod_mat_init(M, r, c, n);
+        nmod_mat_init(X, c, 1, n);
+        nmod_mat_init(Y, r, 1, n);
+        x = _nmod_vec_init(c);
+        y = _nmod_vec_init(r);
+
+        nmod_sparse_mat_randtest(A, state, n_randint(state, 70));
+        _nmod_vec_randtest(x, state, c, A->mod);
+
+        nmod_sparse_mat_mul_vec(y, A, x);
+
+        nmod_sparse_mat_get_nmod_mat(M, A);
+        for (j = 0; j < c; j++)
+            nmod_mat_entry(X, j, 0) = x[j];
+        nmod_mat_mul(Y, M, X);
+
+        for (j = 0; j < r; j++)
+        {
+            if (y[j] != nmod_mat_entry(Y, j, 0))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("r = %wd, c = %wd, n = %wu, entry %wd\n",
+                             r, c, n, j);
+                abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(M);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,95 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rank....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t M;
+        slong j, k, r, c, rank1, rank2;
+        mp_limb_t p;
+
+        r = n_randint(state, 60);
+        c = n_randint(state, 60);
+        p = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(A, r, c, p);
+        nmod_mat_init(M, r, c, p);
+
+        /* low weights leave long chains for structured elimination */
+        nmod_sparse_mat_randtest(A, state, n_randint(state, 6));
+        nmod_sparse_mat_get_nmod_mat(M, A);
+
+        /* repeat some rows, up to a scalar */
+        if (r >= 2 && n_randint(state, 2))
+        {
+            for (k = n_randint(state, r); k > 0; k--)
+            {
+                slong s = n_randint(state, r), t = n_randint(state, r);
+                mp_limb_t a = n_randint(state, p);
+
+                for (j = 0; j < c; j++)
+                    nmod_mat_entry(M, t, j) =
+                        nmod_mul(a, nmod_mat_entry(M, s, j), M->mod);
+            }
+            nmod_sparse_mat_set_nmod_mat(A, M);
+        }
+
+        rank1 = nmod_sparse_mat_rank(A);
+        rank2 = nmod_mat_rank(M);
+
+        if (rank1 != rank2)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("rank = %wd, expected %wd\n", rank1, rank2);
+            nmod_mat_print_pretty(M);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(M);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_entries....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t A, B;
+        nmod_mat_t M, N;
+        slong j, k, r, c, len;
+        slong * rows, * cols;
+        mp_ptr vals;
+        mp_limb_t n;
+
+        r = n_randint(state, 20);
+        c = n_randint(state, 20);
+        n = n_randtest_not_zero(state);
+
+        len = (r == 0 || c == 0) ? 0 : n_randint(state, 3 * r * c + 1);
+        rows = flint_malloc(len * sizeof(slong));
+        cols = flint_malloc(len * sizeof(slong));
+        vals = _nmod_vec_init(len);
+
+        nmod_mat_init(M, r, c, n);
+        nmod_mat_init(N, r, c, n);
+        nmod_sparse_mat_init(A, r, c, n);
+        nmod_sparse_mat_init(B, r, c, n);
+
+        /* small values make repeated positions likely to cancel */
+        for (j = 0; j < len; j++)
+        {
+            rows[j] = n_randint(state, r);
+            cols[j] = n_randint(state, c);
+            vals[j] = n_randint(state, 2) ? n_randtest(state) :
+                                            n_randint(state, 3) % n;
+            nmod_mat_entry(M, rows[j], cols[j]) = nmod_add(
+                nmod_mat_entry(M, rows[j], cols[j]), vals[j] % n, M->mod);
+        }
+
+        nmod_sparse_mat_set_entries(A, rows, cols, vals, len);
+        nmod_sparse_mat_get_nmod_mat(N, A);
+
+        if (!nmod_mat_equal(M, N))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("wrong entries\n");
+            nmod_mat_print_pretty(M);
+            nmod_mat_print_pretty(N);
+            abort();
+        }
+
+        for (j = 0; j < r; j++)
+        {
+            for (k = A->row_start[j]; k < A->row_start[j + 1]; k++)
+            {
+                if (A->entries[k] == 0 || (k > A->row_start[j] &&
+                                           A->cols[k - 1] >= A->cols[k]))
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("row %wd not normalised\n", j);
+                    abort();
+                }
+            }
+        }
+
+        nmod_sparse_mat_set_nmod_mat(B, M);
+
+        if (nmod_sparse_mat_nnz(B) != nmod_sparse_mat_nnz(A)
+                || !_nmod_vec_equal(B->entries, A->entries,
+                                                   nmod_sparse_mat_nnz(A)))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("set_nmod_mat does not agree\n");
+            abort();
+        }
+
+        nmod_mat_clear(M);
+        nmod_mat_clear(N);
+        nmod_sparse_mat_clear(A);
+        nmod_sparse_mat_clear(B);
+        flint_free(rows);
+        flint_free(cols);
+        _nmod_vec_clear(vals);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_lanczos....");
+    fflush(stdout);
+
+    for (i = 0; i < 300 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t M;
+        mp_ptr x, b, y;
+        slong j, m, n, bits;
+        mp_limb_t p;
+        int ok, in_image;
+
+        n = n_randint(state, 50);
+        m = n + n_randint(state, 10);
+        bits = 2 + n_randint(state, FLINT_BITS - 1);
+        p = n_randprime(state, bits, 1);
+
+        nmod_sparse_mat_init(A, m, n, p);
+        nmod_mat_init(M, m, n, p);
+        x = _nmod_vec_init(n);
+        b = _nmod_vec_init(m);
+        y = _nmod_vec_init(FLINT_MAX(m, n));
+
+        nmod_sparse_mat_randtest(A, state, n_randint(state, 5));
+        nmod_sparse_mat_get_nmod_mat(M, A);
+        if (n_randint(state, 4) != 0)
+            for (j = 0; j < n; j++)
+                nmod_mat_entry(M, j, j) = 1 + n_randint(state, p - 1);
+        nmod_sparse_mat_set_nmod_mat(A, M);
+
+        /* b is in the image, except sometimes when it is random */
+        in_image = (n_randint(state, 8) != 0);
+        if (!in_image)
+            _nmod_vec_randtest(b, state, m, A->mod);
+        else
+        {
+            _nmod_vec_randtest(y, state, n, A->mod);
+            nmod_sparse_mat_mul_vec(b, A, y);
+        }
+
+        ok = nmod_sparse_mat_solve_lanczos(x, A, b, state);
+
+        if (ok)
+        {
+            nmod_sparse_mat_mul_vec(y, A, x);
+            if (!_nmod_vec_equal(y, b, m))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("wrong solution\n");
+                nmod_mat_print_pretty(M);
+                abort();
+            }
+        }
+        else if (in_image && bits > 20 && nmod_mat_rank(M) == n)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("no solution found for an injective matrix\n");
+            nmod_mat_print_pretty(M);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(M);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
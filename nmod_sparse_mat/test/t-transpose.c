@@ -0,0 +1,95 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("transpose....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t A, B;
+        nmod_mat_t M, N, T;
+        slong r, c;
+        mp_limb_t n;
+
+        r = n_randint(state, 30);
+        c = n_randint(state, 30);
+        n = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(A, r, c, n);
+        nmod_sparse_mat_init(B, c, r, n);
+        nmod_mat_init(M, r, c, n);
+        nmod_mat_init(N, c, r, n);
+        nmod_mat_init(T, c, r, n);
+
+        nmod_sparse_mat_randtest(A, state, n_randint(state, 10));
+        nmod_sparse_mat_get_nmod_mat(M, A);
+        nmod_mat_transpose(T, M);
+
+        if (n_randint(state, 2))
+        {
+            nmod_sparse_mat_transpose(B, A);
+        }
+        else
+        {
+            nmod_sparse_mat_transpose(A, A);
+            nmod_sparse_mat_swap(A, B);
+        }
+
+        nmod_sparse_mat_get_nmod_mat(N, B);
+
+        if (!nmod_mat_equal(N, T) || nmod_sparse_mat_nrows(B) != c)
+        {
+            flint_printf("FAIL:\n");
+            nmod_mat_print_pretty(M);
+            nmod_mat_print_pretty(N);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_sparse_mat_clear(B);
+        nmod_mat_clear(M);
+        nmod_mat_clear(N);
+        nmod_mat_clear(T);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,73 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_transpose(nmod_sparse_mat_t B, const nmod_sparse_mat_t A)
+{
+    slong i, k, pos, nnz = nmod_sparse_mat_nnz(A);
+    slong * start = B->row_start;
+
+    if (B == A)
+    {
+        nmod_sparse_mat_t t;
+        nmod_sparse_mat_init(t, A->c, A->r, A->mod.n);
+        nmod_sparse_mat_transpose(t, A);
+        nmod_sparse_mat_swap(B, t);
+        nmod_sparse_mat_clear(t);
+        return;
+    }
+
+    nmod_sparse_mat_fit_nnz(B, nnz);
+
+    /* counting sort by column; rows are visited in order, so the columns
+       of B come out sorted */
+    for (i = 0; i <= B->r; i++)
+        start[i] = 0;
+    for (k = 0; k < nnz; k++)
+        start[A->cols[k] + 1]++;
+    for (i = 0; i < B->r; i++)
+        start[i + 1] += start[i];
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (k = A->row_start[i]; k < A->row_start[i + 1]; k++)
+        {
+            pos = start[A->cols[k]]++;
+            B->cols[pos] = i;
+            B->entries[pos] = A->entries[k];
+        }
+    }
+
+    /* start[i] now holds the end of row i */
+    for (i = B->r; i > 0; i--)
+        start[i] = start[i - 1];
+    start[0] = 0;
+}
@@ -309,6 +309,33 @@ FLINT_DLL mp_limb_t _nmod_vec_dot(mp_srcptr vec1, mp_srcptr vec2,
 FLINT_DLL mp_limb_t _nmod_vec_dot_ptr(mp_srcptr vec1, const mp_ptr * vec2, slong offset,
     slong len, nmod_t mod, int nlimbs);
 
+/* Kernels selected at runtime according to flint_get_cpu_features() */
+
+/* dot products of at least this length use the vector kernels */
+#define NMOD_VEC_DOT_SIMD_CUTOFF 16
+
+/* the vector dot product kernels require entries of at most 32 bits */
+#define NMOD_VEC_DOT_SIMD_OK(mod, nlimbs) \
+   ((nlimbs) == 1 || ((nlimbs) == 2 && (mod).n <= (UWORD(1) << 32)))
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_avx2(mp_srcptr vec1, mp_srcptr vec2,
+    slong len, nmod_t mod, int nlimbs);
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_ptr_avx2(mp_srcptr vec1,
+    const mp_ptr * vec2, slong offset, slong len, nmod_t mod, int nlimbs);
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_avx512(mp_srcptr vec1, mp_srcptr vec2,
+    slong len, nmod_t mod, int nlimbs);
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_ptr_avx512(mp_srcptr vec1,
+    const mp_ptr * vec2, slong offset, slong len, nmod_t mod, int nlimbs);
+
+FLINT_DLL void _nmod_vec_scalar_addmul_nmod_avx2(mp_ptr res, mp_srcptr vec,
+    slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_addmul_nmod_avx512(mp_ptr res,
+    mp_srcptr vec, slong len, mp_limb_t c, nmod_t mod);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,149 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+
+/*
+   Kernels for the cases nlimbs == 1, and nlimbs == 2 with n at most
+   2^32. In both cases the entries fit in 32 bits, so vpmuludq gives the
+   products exactly. For nlimbs == 2 the low and high halves of the
+   products are accumulated separately, in blocks short enough that the
+   64-bit lanes cannot overflow.
+*/
+
+#if HAVE_AVX2
+
+#include <immintrin.h>
+
+#define DOT_BLOCK (WORD(1) << 24)
+
+static __inline__ __attribute__((target("avx2")))
+mp_limb_t _hsum_avx2(__m256i a)
+{
+    __m128i t = _mm_add_epi64(_mm256_castsi256_si128(a),
+                              _mm256_extracti128_si256(a, 1));
+
+    return (mp_limb_t) _mm_cvtsi128_si64(t)
+         + (mp_limb_t) _mm_extract_epi64(t, 1);
+}
+
+#define DOT_AVX2_BODY                                                      \
+    mp_limb_t s0 = 0, s1 = 0, lo, hi;                                      \
+    slong i = 0, end;                                                      \
+    __m256i p, a0, a1, mask;                                               \
+                                                                           \
+    if (nlimbs == 1)                                                       \
+    {                                                                      \
+        a0 = a1 = _mm256_setzero_si256();                                  \
+        for ( ; i + 8 <= len; i += 8)                                      \
+        {                                                                  \
+            a0 = _mm256_add_epi64(a0, _mm256_mul_epu32(VA(i), VB(i)));     \
+            a1 = _mm256_add_epi64(a1,                                      \
+                                _mm256_mul_epu32(VA(i + 4), VB(i + 4)));   \
+        }                                                                  \
+        s0 = _hsum_avx2(_mm256_add_epi64(a0, a1));                         \
+        for ( ; i < len; i++)                                              \
+            s0 += SA(i) * SB(i);                                           \
+        NMOD_RED(s0, s0, mod);                                             \
+    }                                                                      \
+    else                                                                   \
+    {                                                                      \
+        mask = _mm256_set1_epi64x(WORD(0xffffffff));                       \
+        while (i + 4 <= len)                                               \
+        {                                                                  \
+            end = i + FLINT_MIN(len - i, DOT_BLOCK);                       \
+            a0 = a1 = _mm256_setzero_si256();                              \
+            for ( ; i + 4 <= end; i += 4)                                  \
+            {                                                              \
+                p = _mm256_mul_epu32(VA(i), VB(i));                        \
+                a0 = _mm256_add_epi64(a0, _mm256_and_si256(p, mask));      \
+                a1 = _mm256_add_epi64(a1, _mm256_srli_epi64(p, 32));       \
+            }                                                              \
+            lo = _hsum_avx2(a0);                                           \
+            hi = _hsum_avx2(a1);                                           \
+            add_ssaaaa(s1, s0, s1, s0, hi >> 32, hi << 32);                \
+            add_ssaaaa(s1, s0, s1, s0, 0, lo);                             \
+        }                                                                  \
+        for ( ; i < len; i++)                                              \
+        {                                                                  \
+            lo = SA(i) * SB(i);                                            \
+            add_ssaaaa(s1, s0, s1, s0, 0, lo);                             \
+        }                                                                  \
+        NMOD2_RED2(s0, s1, s0, mod);                                       \
+    }                                                                      \
+                                                                           \
+    return s0;
+
+#define SA(i) vec1[i]
+#define VA(i) _mm256_loadu_si256((const __m256i *) (vec1 + (i)))
+
+#define SB(i) vec2[i]
+#define VB(i) _mm256_loadu_si256((const __m256i *) (vec2 + (i)))
+
+__attribute__((target("avx2")))
+mp_limb_t _nmod_vec_dot_avx2(mp_srcptr vec1, mp_srcptr vec2,
+                                         slong len, nmod_t mod, int nlimbs)
+{
+    DOT_AVX2_BODY
+}
+
+#undef SB
+#undef VB
+
+#define SB(i) vec2[i][offset]
+#define VB(i) _mm256_set_epi64x(vec2[(i) + 3][offset],                     \
+                  vec2[(i) + 2][offset], vec2[(i) + 1][offset],            \
+                  vec2[i][offset])
+
+__attribute__((target("avx2")))
+mp_limb_t _nmod_vec_dot_ptr_avx2(mp_srcptr vec1, const mp_ptr * vec2,
+                         slong offset, slong len, nmod_t mod, int nlimbs)
+{
+    DOT_AVX2_BODY
+}
+
+#else
+
+mp_limb_t _nmod_vec_dot_avx2(mp_srcptr vec1, mp_srcptr vec2,
+                                         slong len, nmod_t mod, int nlimbs)
+{
+    mp_limb_t res;
+    slong i;
+    NMOD_VEC_DOT(res, i, len, vec1[i], vec2[i], mod, nlimbs);
+    return res;
+}
+
+mp_limb_t _nmod_vec_dot_ptr_avx2(mp_srcptr vec1, const mp_ptr * vec2,
+                         slong offset, slong len, nmod_t mod, int nlimbs)
+{
+    mp_limb_t res;
+    slong i;
+    NMOD_VEC_DOT(res, i, len, vec1[i], vec2[i][offset], mod, nlimbs);
+    return res;
+}
+
+#endif
@@ -0,0 +1,129 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+
+/* As for the AVX2 kernels in dot_avx2.c, with eight lanes */
+
+#if HAVE_AVX512
+
+#include <immintrin.h>
+
+#define DOT_BLOCK (WORD(1) << 24)
+
+#define DOT_AVX512_BODY                                                    \
+    mp_limb_t s0 = 0, s1 = 0, lo, hi;                                      \
+    slong i = 0, end;                                                      \
+    __m512i p, a0, a1, mask;                                               \
+                                                                           \
+    if (nlimbs == 1)                                                       \
+    {                                                                      \
+        a0 = a1 = _mm512_setzero_si512();                                  \
+        for ( ; i + 16 <= len; i += 16)                                    \
+        {                                                                  \
+            a0 = _mm512_add_epi64(a0, _mm512_mul_epu32(VA(i), VB(i)));     \
+            a1 = _mm512_add_epi64(a1,                                      \
+                                _mm512_mul_epu32(VA(i + 8), VB(i + 8)));   \
+        }                                                                  \
+        s0 = _mm512_reduce_add_epi64(_mm512_add_epi64(a0, a1));            \
+        for ( ; i < len; i++)                                              \
+            s0 += SA(i) * SB(i);                                           \
+        NMOD_RED(s0, s0, mod);                                             \
+    }                                                                      \
+    else                                                                   \
+    {                                                                      \
+        mask = _mm512_set1_epi64(WORD(0xffffffff));                        \
+        while (i + 8 <= len)                                               \
+        {                                                                  \
+            end = i + FLINT_MIN(len - i, DOT_BLOCK);                       \
+            a0 = a1 = _mm512_setzero_si512();                              \
+            for ( ; i + 8 <= end; i += 8)                                  \
+            {                                                              \
+                p = _mm512_mul_epu32(VA(i), VB(i));                        \
+                a0 = _mm512_add_epi64(a0, _mm512_and_si512(p, mask));      \
+                a1 = _mm512_add_epi64(a1, _mm512_srli_epi64(p, 32));       \
+            }                                                              \
+            lo = _mm512_reduce_add_epi64(a0);                              \
+            hi = _mm512_reduce_add_epi64(a1);                              \
+            add_ssaaaa(s1, s0, s1, s0, hi >> 32, hi << 32);                \
+            add_ssaaaa(s1, s0, s1, s0, 0, lo);                             \
+        }                                                                  \
+        for ( ; i < len; i++)                                              \
+        {                                                                  \
+            lo = SA(i) * SB(i);                                            \
+            add_ssaaaa(s1, s0, s1, s0, 0, lo);                             \
+        }                                                                  \
+        NMOD2_RED2(s0, s1, s0, mod);                                       \
+    }                                                                      \
+                                                                           \
+    return s0;
+
+#define SA(i) vec1[i]
+#define VA(i) _mm512_loadu_si512((const void *) (vec1 + (i)))
+
+#define SB(i) vec2[i]
+#define VB(i) _mm512_loadu_si512((const void *) (vec2 + (i)))
+
+__attribute__((target("avx512f")))
+mp_limb_t _nmod_vec_dot_avx512(mp_srcptr vec1, mp_srcptr vec2,
+                                         slong len, nmod_t mod, int nlimbs)
+{
+    DOT_AVX512_BODY
+}
+
+#undef SB
+#undef VB
+
+#define SB(i) vec2[i][offset]
+#define VB(i) _mm512_set_epi64(vec2[(i) + 7][offset],                      \
+                  vec2[(i) + 6][offset], vec2[(i) + 5][offset],            \
+                  vec2[(i) + 4][offset], vec2[(i) + 3][offset],            \
+                  vec2[(i) + 2][offset], vec2[(i) + 1][offset],            \
+                  vec2[i][offset])
+
+__attribute__((target("avx512f")))
+mp_limb_t _nmod_vec_dot_ptr_avx512(mp_srcptr vec1, const mp_ptr * vec2,
+                         slong offset, slong len, nmod_t mod, int nlimbs)
+{
+    DOT_AVX512_BODY
+}
+
+#else
+
+mp_limb_t _nmod_vec_dot_avx512(mp_srcptr vec1, mp_srcptr vec2,
+                                         slong len, nmod_t mod, int nlimbs)
+{
+    return _nmod_vec_dot_avx2(vec1, vec2, len, mod, nlimbs);
+}
+
+mp_limb_t _nmod_vec_dot_ptr_avx512(mp_srcptr vec1, const mp_ptr * vec2,
+                         slong offset, slong len, nmod_t mod, int nlimbs)
+{
+    return _nmod_vec_dot_ptr_avx2(vec1, vec2, offset, len, mod, nlimbs);
+}
+
+#endif
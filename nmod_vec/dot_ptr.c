@@ -35,6 +35,22 @@ _nmod_vec_dot_ptr(mp_srcptr vec1, const mp_ptr * vec2, slong offset,
 {
     mp_limb_t res;
     slong i;
+
+#if HAVE_AVX2
+    if (len >= NMOD_VEC_DOT_SIMD_CUTOFF && NMOD_VEC_DOT_SIMD_OK(mod, nlimbs))
+    {
+        ulong features = flint_get_cpu_features();
+
+        if (features & FLINT_CPU_AVX512F)
+            return _nmod_vec_dot_ptr_avx512(vec1, vec2, offset,
+                                                         len, mod, nlimbs);
+
+        if (features & FLINT_CPU_AVX2)
+            return _nmod_vec_dot_ptr_avx2(vec1, vec2, offset,
+                                                         len, mod, nlimbs);
+    }
+#endif
+
     NMOD_VEC_DOT(res, i, len, vec1[i], vec2[i][offset], mod, nlimbs);
     return res;
 }
@@ -0,0 +1,112 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+typedef struct
+{
+   mp_bitcnt_t bits;
+   slong length;
+   ulong features;
+} info_t;
+
+void sample(void * arg, ulong count)
+{
+   mp_limb_t n, r = 0;
+   nmod_t mod;
+   info_t * info = (info_t *) arg;
+   mp_bitcnt_t bits = info->bits;
+   slong length = info->length;
+   slong i, j;
+   int nlimbs;
+   mp_ptr vec = _nmod_vec_init(length);
+   mp_ptr vec2 = _nmod_vec_init(length);
+   FLINT_TEST_INIT(state);
+
+   flint_set_cpu_features(info->features);
+
+   for (i = 0; i < count; i++)
+   {
+      n = n_randbits(state, bits);
+      if (n == UWORD(0)) n++;
+      for (j = 0; j < length; j++)
+      {
+         vec[j] = n_randint(state, n);
+         vec2[j] = n_randint(state, n);
+      }
+
+      nmod_init(&mod, n);
+      nlimbs = _nmod_vec_dot_bound_limbs(length, mod);
+
+      prof_start();
+      for (j = 0; j < 30; j++)
+         r += _nmod_vec_dot(vec, vec2, length, mod, nlimbs);
+      prof_stop();
+   }
+
+   if (r == UWORD(1))
+      flint_printf("\r");
+
+   flint_set_cpu_features(~UWORD(0));
+
+   flint_randclear(state);
+   _nmod_vec_clear(vec);
+   _nmod_vec_clear(vec2);
+}
+
+int main(void)
+{
+   double min1, min2, max;
+   info_t info;
+   mp_bitcnt_t i;
+   slong len;
+
+   for (len = 16; len <= 4096; len *= 16)
+   {
+      for (i = 8; i <= FLINT_BITS; i += 8)
+      {
+         info.bits = i;
+         info.length = len;
+
+         info.features = 0;
+         prof_repeat(&min1, &max, sample, (void *) &info);
+
+         info.features = ~UWORD(0);
+         prof_repeat(&min2, &max, sample, (void *) &info);
+
+         flint_printf("length %wd, bits %wd, generic %.2lf c/l, "
+            "dispatched %.2lf c/l\n", len, i,
+            (min1/(double)FLINT_CLOCK_SCALE_FACTOR)/(len*30),
+            (min2/(double)FLINT_CLOCK_SCALE_FACTOR)/(len*30));
+      }
+   }
+
+   return 0;
+}
@@ -32,6 +32,25 @@
 void _nmod_vec_scalar_addmul_nmod(mp_ptr res, mp_srcptr vec, 
 				             slong len, mp_limb_t c, nmod_t mod)
 {
+#if HAVE_AVX2
+    if (len >= 8 && mod.norm >= FLINT_BITS/2)
+    {
+        ulong features = flint_get_cpu_features();
+
+        if (features & FLINT_CPU_AVX512F)
+        {
+            _nmod_vec_scalar_addmul_nmod_avx512(res, vec, len, c, mod);
+            return;
+        }
+
+        if (features & FLINT_CPU_AVX2)
+        {
+            _nmod_vec_scalar_addmul_nmod_avx2(res, vec, len, c, mod);
+            return;
+        }
+    }
+#endif
+
     if (mod.norm >= FLINT_BITS/2) /* addmul will fit in a limb */
     {
         mpn_addmul_1(res, vec, len, c);
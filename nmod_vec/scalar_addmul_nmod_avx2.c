@@ -0,0 +1,88 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+
+/*
+   Requires n < 2^32. Each product c*v is reduced with Shoup's method
+   using the precomputed quotient floor(c*2^32/n), so that all products
+   are of 32-bit values and fit in the 64-bit lanes.
+*/
+
+#if HAVE_AVX2
+
+#include <immintrin.h>
+
+__attribute__((target("avx2")))
+void _nmod_vec_scalar_addmul_nmod_avx2(mp_ptr res, mp_srcptr vec,
+                                     slong len, mp_limb_t c, nmod_t mod)
+{
+    mp_limb_t cq = (c << 32) / mod.n, q, r;
+    __m256i vn, vc, vcq, v, vq, vr;
+    slong i;
+
+    vn = _mm256_set1_epi64x(mod.n);
+    vc = _mm256_set1_epi64x(c);
+    vcq = _mm256_set1_epi64x(cq);
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        v = _mm256_loadu_si256((const __m256i *) (vec + i));
+        vq = _mm256_srli_epi64(_mm256_mul_epu32(v, vcq), 32);
+        vr = _mm256_sub_epi64(_mm256_mul_epu32(v, vc),
+                              _mm256_mul_epu32(vq, vn));
+        vr = _mm256_sub_epi64(vr,
+                 _mm256_andnot_si256(_mm256_cmpgt_epi64(vn, vr), vn));
+        vr = _mm256_add_epi64(vr,
+                 _mm256_loadu_si256((const __m256i *) (res + i)));
+        vr = _mm256_sub_epi64(vr,
+                 _mm256_andnot_si256(_mm256_cmpgt_epi64(vn, vr), vn));
+        _mm256_storeu_si256((__m256i *) (res + i), vr);
+    }
+
+    for ( ; i < len; i++)
+    {
+        q = (vec[i] * cq) >> 32;
+        r = vec[i] * c - q * mod.n;
+        if (r >= mod.n)
+            r -= mod.n;
+        res[i] = nmod_add(res[i], r, mod);
+    }
+}
+
+#else
+
+void _nmod_vec_scalar_addmul_nmod_avx2(mp_ptr res, mp_srcptr vec,
+                                     slong len, mp_limb_t c, nmod_t mod)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        NMOD_ADDMUL(res[i], vec[i], c, mod);
+}
+
+#endif
@@ -0,0 +1,79 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+
+/* As for the AVX2 kernel in scalar_addmul_nmod_avx2.c, with eight lanes */
+
+#if HAVE_AVX512
+
+#include <immintrin.h>
+
+__attribute__((target("avx512f")))
+void _nmod_vec_scalar_addmul_nmod_avx512(mp_ptr res, mp_srcptr vec,
+                                     slong len, mp_limb_t c, nmod_t mod)
+{
+    mp_limb_t cq = (c << 32) / mod.n, q, r;
+    __m512i vn, vc, vcq, v, vq, vr;
+    slong i;
+
+    vn = _mm512_set1_epi64(mod.n);
+    vc = _mm512_set1_epi64(c);
+    vcq = _mm512_set1_epi64(cq);
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        v = _mm512_loadu_si512((const void *) (vec + i));
+        vq = _mm512_srli_epi64(_mm512_mul_epu32(v, vcq), 32);
+        vr = _mm512_sub_epi64(_mm512_mul_epu32(v, vc),
+                              _mm512_mul_epu32(vq, vn));
+        vr = _mm512_min_epu64(vr, _mm512_sub_epi64(vr, vn));
+        vr = _mm512_add_epi64(vr,
+                 _mm512_loadu_si512((const void *) (res + i)));
+        vr = _mm512_min_epu64(vr, _mm512_sub_epi64(vr, vn));
+        _mm512_storeu_si512((void *) (res + i), vr);
+    }
+
+    for ( ; i < len; i++)
+    {
+        q = (vec[i] * cq) >> 32;
+        r = vec[i] * c - q * mod.n;
+        if (r >= mod.n)
+            r -= mod.n;
+        res[i] = nmod_add(res[i], r, mod);
+    }
+}
+
+#else
+
+void _nmod_vec_scalar_addmul_nmod_avx512(mp_ptr res, mp_srcptr vec,
+                                     slong len, mp_limb_t c, nmod_t mod)
+{
+    _nmod_vec_scalar_addmul_nmod_avx2(res, vec, len, c, mod);
+}
+
+#endif
@@ -51,6 +51,10 @@ main(void)
         slong j;
 
         len = n_randint(state, 1000) + 1;
+
+        /* exercise each of the kernels available on this machine */
+        flint_set_cpu_features(n_randlimb(state));
+
         m = n_randtest_not_zero(state);
 
         nmod_init(&mod, m);
@@ -92,6 +96,8 @@ main(void)
         _nmod_vec_clear(y);
     }
 
+    flint_set_cpu_features(~UWORD(0));
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -51,6 +51,10 @@ main(void)
         slong j, offset;
 
         len = n_randint(state, 1000) + 1;
+
+        /* exercise each of the kernels available on this machine */
+        flint_set_cpu_features(n_randlimb(state));
+
         m = n_randtest_not_zero(state);
         offset = n_randint(state, 10);
 
@@ -85,6 +89,8 @@ main(void)
         flint_free(z);
     }
 
+    flint_set_cpu_features(~UWORD(0));
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
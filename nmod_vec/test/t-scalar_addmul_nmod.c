@@ -54,6 +54,9 @@ main(void)
 
         nmod_init(&mod, n);
 
+        /* exercise each of the kernels available on this machine */
+        flint_set_cpu_features(n_randlimb(state));
+
         _nmod_vec_randtest(vec, state, len, mod);
         _nmod_vec_randtest(vec2, state, len, mod);
         flint_mpn_copyi(vec3, vec2, len);
@@ -76,6 +79,8 @@ main(void)
         _nmod_vec_clear(vec3);
     }
 
+    flint_set_cpu_features(~UWORD(0));
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
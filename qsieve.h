@@ -71,6 +71,51 @@ typedef struct fac_t /* struct for factors of relations */
    slong exp;
 } fac_t;
 
+typedef struct qs_partial_t /* partial relation */
+{
+   mp_limb_t L1; /* large primes, L1 = 1 if there is only one */
+   mp_limb_t L2;
+   fmpz Y; /* Y value of the relation */
+   slong * fac; /* number of factors followed by (index, exponent) pairs */
+} qs_partial_t;
+
+typedef struct qs_vertex_t /* vertex of the large prime graph */
+{
+   mp_limb_t p; /* large prime, or 1 */
+   slong parent; /* parent in the spanning forest, -1 for a root */
+   slong edge; /* partial relation joining the vertex to its parent */
+   slong size; /* number of vertices in the tree, valid for roots */
+   slong mark; /* used when searching for cycles */
+} qs_vertex_t;
+
+typedef struct qs_poly_s /* polynomial and relation data for one thread */
+{
+   fmpz_t B; /* coefficient B of the current polynomial */
+   fmpz_t C; /* coefficient C = (B^2 - kn)/A */
+
+   mp_limb_t * soln1; /* first root of the polynomial, offset by M */
+   mp_limb_t * soln2; /* second root, or -1 for primes dividing A */
+   mp_limb_t * pos1; /* next sieve position of the first root */
+   mp_limb_t * pos2; /* next sieve position of the second root */
+
+   unsigned char * sieve; /* sieve block */
+
+   slong * small; /* exponents of small primes in the current relation */
+   fac_t * factor; /* factors of the current relation */
+   slong num_factors; /* number of factors of the current relation */
+
+   /* relations found, waiting to be merged by qsieve_process_relations */
+   fmpz * Y; /* Y values of the relations */
+   mp_limb_t * L; /* large primes L1, L2 of each relation, 1 if absent */
+   slong * data; /* small exponents, num_factors, (ind, exp) pairs */
+   slong num_rels;
+   slong rels_alloc;
+   slong data_len;
+   slong data_alloc;
+} qs_poly_s;
+
+typedef qs_poly_s qs_poly_t[1];
+
 typedef struct la_col_t /* matrix column */
 {
 	slong * data;		/* The list of occupied rows in this column */
@@ -82,6 +127,7 @@ typedef struct qs_s
 {
    mp_limb_t hi; /* Number to factor */
    mp_limb_t lo;
+   fmpz_t n; /* n as a multiprecision integer */
 
    mp_bitcnt_t bits; /* Number of bits of n */
    
@@ -136,6 +182,49 @@ typedef struct qs_s
    slong high; /* end of range for middle factor */
 
 
+   /***************************
+     Multi-limb polynomial data
+   ***************************/
+
+   fmpz_t A_mp; /* coefficient A */
+   fmpz_t B_mp; /* coefficient B */
+   fmpz * B_terms_mp; /* B_terms, for the multi-limb sieve */
+   fmpz_t target_A_mp; /* approximate target value for A */
+
+   fmpz * A_used; /* A coefficients which have been used so far */
+   slong A_used_num;
+   slong A_used_alloc;
+
+   qs_poly_s * poly; /* per thread roots, sieves and relations */
+   slong num_threads; /* number of threads sieving */
+   slong poly_index; /* next polynomial to sieve for the current A */
+
+   slong block_size; /* size of the sieve blocks */
+   slong sieve_thresh; /* sieve value above which candidates are checked */
+
+   flint_rand_t state; /* used for choosing A coefficients */
+
+   /**************************
+     Large prime variations
+   **************************/
+
+   mp_limb_t large_prime; /* bound for large primes */
+   mp_limb_t dlp_bound; /* bound for cofactors with two large primes, or 0 */
+
+   qs_partial_t * partials; /* partial relations */
+   slong num_partials;
+   slong partials_alloc;
+
+   qs_vertex_t * vertices; /* vertices of the large prime graph */
+   slong num_vertices;
+   slong vertices_alloc;
+
+   slong * lp_hash; /* hash table from large primes to vertices */
+   slong lp_hash_alloc;
+
+   slong num_cycles; /* number of relations found from cycles */
+   slong mark; /* current mark for cycle searching */
+
    /*********************
      Relations data
    **********************/
@@ -212,11 +301,55 @@ static const mp_limb_t qsieve_ll_tune[][5] =
 /* number of entries in the tuning table */
 #define QS_LL_TUNE_SIZE (sizeof(qsieve_ll_tune)/(5*sizeof(mp_limb_t)))
 
+/*
+   Tuning parameters { bits, ks_primes, fb_primes, small_primes, sieve_size,
+   lp_mult, dlp } for qsieve_factor where:
+     * bits is the number of bits of kn
+     * ks_primes is the max number of primes to try in Knuth-Schroeppel algo
+     * fb_primes is the number of factor base primes to use (including -1 and 2)
+     * small_primes is the number of small primes to not sieve with
+     * sieve_size is the size of the sieve interval to use
+     * lp_mult is the large prime bound as a multiple of the largest FB prime
+     * dlp is 1 if the double large prime variation is to be used
+*/
+static const mp_limb_t qsieve_tune[][7] =
+{
+    {0, 50, 60, 4, 8192, 10, 0},
+    {60, 50, 100, 4, 16384, 20, 0},
+    {80, 100, 150, 5, 32768, 20, 0},
+    {100, 100, 250, 5, 32768, 30, 0},
+    {120, 100, 400, 6, 65536, 30, 0},
+    {140, 100, 600, 6, 65536, 40, 0},
+    {160, 100, 1000, 7, 65536, 40, 0},
+    {180, 100, 1600, 7, 65536, 50, 0},
+    {200, 100, 2400, 8, 131072, 50, 1},
+    {220, 100, 4000, 8, 196608, 50, 1},
+    {240, 100, 8000, 9, 196608, 80, 1},
+    {260, 100, 16000, 9, 393216, 80, 1},
+    {280, 100, 28000, 10, 393216, 100, 1},
+    {300, 100, 40000, 10, 589824, 100, 1},
+    {320, 100, 60000, 11, 589824, 150, 1},
+    {340, 100, 80000, 11, 786432, 150, 1}
+};
+
+/* number of entries in the tuning table */
+#define QS_TUNE_SIZE (sizeof(qsieve_tune)/(7*sizeof(mp_limb_t)))
+
 #define P_GOODNESS 100 /* within what factor of target_A must A be */
 #define P_GOODNESS2 200 /* within what factor of target_A must A be when s = 2 */
 
 #define BITS_ADJUST 10 /* no. bits less than f(X) to qualify for trial division */
 
+#define QS_THRESH_ADJUST 4 /* no. bits to lower the threshold of the multi-limb sieve by */
+
+#define QS_DLP_THRESH_ADJUST 7 /* no. bits to raise it by with two large primes */
+
+#define QS_A_TRIES 100 /* tries to find an A coefficient of the right size */
+
+#define QS_POLY_BATCH 8 /* polynomials sieved by each thread per round */
+
+#define QS_DENSE_LINALG_CUTOFF 4096 /* max. columns for dense linear algebra */
+
 FLINT_DLL void qsieve_ll_init(qs_t qs_inf, mp_limb_t hi, mp_limb_t lo);
 
 FLINT_DLL void qsieve_ll_clear(qs_t qs_inf);
@@ -292,6 +425,50 @@ static __inline__ void free_col(la_col_t * col)
    if (col->weight) flint_free(col->data);
 }
 
+FLINT_DLL void qsieve_init(qs_t qs_inf, const fmpz_t n);
+
+FLINT_DLL void qsieve_clear(qs_t qs_inf);
+
+FLINT_DLL mp_limb_t qsieve_primes_init(qs_t qs_inf);
+
+FLINT_DLL void qsieve_poly_init(qs_t qs_inf);
+
+FLINT_DLL void qsieve_linalg_init(qs_t qs_inf);
+
+FLINT_DLL void qsieve_compute_A(qs_t qs_inf);
+
+FLINT_DLL void qsieve_compute_B_terms(qs_t qs_inf);
+
+FLINT_DLL void qsieve_compute_off_adj(qs_t qs_inf);
+
+FLINT_DLL void qsieve_compute_roots(qs_t qs_inf, qs_poly_t poly);
+
+FLINT_DLL void qsieve_compute_C(qs_t qs_inf, qs_poly_t poly);
+
+FLINT_DLL void qsieve_update_offsets(qs_t qs_inf, qs_poly_t poly,
+                                       int poly_add, mp_limb_t * poly_corr);
+
+FLINT_DLL void qsieve_do_sieving(qs_t qs_inf, qs_poly_t poly,
+                                                slong start, slong length);
+
+FLINT_DLL int qsieve_evaluate_candidate(qs_t qs_inf, qs_poly_t poly,
+                                               slong i, unsigned char value);
+
+FLINT_DLL slong qsieve_evaluate_sieve(qs_t qs_inf, qs_poly_t poly,
+                                                slong start, slong length);
+
+FLINT_DLL slong qsieve_sieve_polys(qs_t qs_inf, qs_poly_t poly,
+                                                   slong start, slong end);
+
+FLINT_DLL slong qsieve_process_relations(qs_t qs_inf, qs_poly_t poly);
+
+FLINT_DLL slong qsieve_collect_relations(qs_t qs_inf);
+
+FLINT_DLL slong qsieve_add_partial(qs_t qs_inf, fmpz_t Y, mp_limb_t L1,
+                                                               mp_limb_t L2);
+
+FLINT_DLL void qsieve_factor(fmpz_t f, const fmpz_t n);
+
 FLINT_DLL uint64_t get_null_entry(uint64_t * nullrows, slong i, slong l);
 
 FLINT_DLL void reduce_matrix(qs_t qs_inf, slong * nrows, slong * ncols, la_col_t * cols);
@@ -299,6 +476,9 @@ FLINT_DLL void reduce_matrix(qs_t qs_inf, slong * nrows, slong * ncols, la_col_t
 uint64_t * block_lanczos(flint_rand_t state, slong nrows, slong dense_rows, 
                                                        slong ncols, la_col_t *B);
 
+FLINT_DLL uint64_t * qsieve_dense_nullspace(slong nrows, slong ncols,
+                                                            la_col_t * B);
+
 FLINT_DLL void qsieve_ll_square_root(fmpz_t X, fmpz_t Y, qs_t qs_inf,
                              uint64_t * nullrows, slong ncols, slong l, fmpz_t N);
 
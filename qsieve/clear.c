@@ -0,0 +1,86 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+void qsieve_clear(qs_t qs_inf)
+{
+    slong i;
+
+    fmpz_clear(qs_inf->A_mp);
+    fmpz_clear(qs_inf->B_mp);
+    fmpz_clear(qs_inf->target_A_mp);
+
+    if (qs_inf->B_terms_mp != NULL)
+        _fmpz_vec_clear(qs_inf->B_terms_mp, qs_inf->s);
+
+    if (qs_inf->A_used != NULL)
+        _fmpz_vec_clear(qs_inf->A_used, qs_inf->A_used_alloc);
+
+    for (i = 0; i < qs_inf->num_threads; i++)
+    {
+        qs_poly_s * poly = qs_inf->poly + i;
+
+        fmpz_clear(poly->B);
+        fmpz_clear(poly->C);
+        flint_free(poly->soln1);
+        flint_free(poly->sieve);
+        flint_free(poly->small);
+        flint_free(poly->factor);
+        _fmpz_vec_clear(poly->Y, poly->rels_alloc);
+        flint_free(poly->L);
+        flint_free(poly->data);
+    }
+
+    flint_free(qs_inf->poly);
+
+    for (i = 0; i < qs_inf->num_partials; i++)
+    {
+        fmpz_clear(&qs_inf->partials[i].Y);
+        flint_free(qs_inf->partials[i].fac);
+    }
+
+    flint_free(qs_inf->partials);
+    flint_free(qs_inf->vertices);
+    flint_free(qs_inf->lp_hash);
+
+    qs_inf->B_terms_mp = NULL;
+    qs_inf->A_used     = NULL;
+    qs_inf->poly       = NULL;
+    qs_inf->num_threads = 0;
+    qs_inf->partials   = NULL;
+    qs_inf->vertices   = NULL;
+    qs_inf->lp_hash    = NULL;
+
+    flint_randclear(qs_inf->state);
+
+    /* the remaining data is shared with the two limb sieve */
+    qsieve_ll_clear(qs_inf);
+}
@@ -0,0 +1,492 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#define ulong ulongxx /* interferes with system includes */
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#undef ulong
+#define ulong mp_limb_t
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+#include "fmpz.h"
+#include "thread_pool.h"
+
+/*
+   Sieve the block [start, start + length) of the sieve interval, where
+   pos1 and pos2 hold the next positions of the roots of each prime and
+   are advanced past the block.
+*/
+void qsieve_do_sieving(qs_t qs_inf, qs_poly_t poly, slong start, slong length)
+{
+    slong num_primes = qs_inf->num_primes;
+    mp_limb_t * soln1 = poly->soln1;
+    mp_limb_t * soln2 = poly->soln2;
+    mp_limb_t * pos1 = poly->pos1;
+    mp_limb_t * pos2 = poly->pos2;
+    prime_t * factor_base = qs_inf->factor_base;
+    unsigned char * sieve = poly->sieve;
+    mp_limb_t p, pos, end = start + length;
+    unsigned char size;
+    slong pind;
+
+    memset(sieve, 0, length);
+    sieve -= start;
+
+    for (pind = qs_inf->small_primes; pind < num_primes; pind++)
+    {
+        if (soln2[pind] == -1) continue; /* don't sieve with A factors */
+
+        p = factor_base[pind].p;
+        size = factor_base[pind].size;
+
+        for (pos = pos1[pind]; pos < end; pos += p)
+            sieve[pos] += size;
+        pos1[pind] = pos;
+
+        if (soln1[pind] == soln2[pind]) continue; /* p divides k */
+
+        for (pos = pos2[pind]; pos < end; pos += p)
+            sieve[pos] += size;
+        pos2[pind] = pos;
+    }
+}
+
+/* save the relation in poly->small and poly->factor for merging later */
+static void
+_qsieve_store_relation(qs_t qs_inf, qs_poly_t poly, fmpz_t Y,
+                                                mp_limb_t L1, mp_limb_t L2)
+{
+    slong i, len = qs_inf->small_primes + 2*poly->num_factors + 1;
+    slong * data;
+
+    if (poly->num_rels == poly->rels_alloc)
+    {
+        slong alloc = FLINT_MAX(2*poly->rels_alloc, 16);
+
+        poly->Y = flint_realloc(poly->Y, alloc*sizeof(fmpz));
+        for (i = poly->rels_alloc; i < alloc; i++)
+            fmpz_init(poly->Y + i);
+        poly->L = flint_realloc(poly->L, 2*alloc*sizeof(mp_limb_t));
+        poly->rels_alloc = alloc;
+    }
+
+    if (poly->data_len + len > poly->data_alloc)
+    {
+        poly->data_alloc = FLINT_MAX(2*poly->data_alloc,
+                                     poly->data_len + len);
+        poly->data = flint_realloc(poly->data,
+                                   poly->data_alloc*sizeof(slong));
+    }
+
+    fmpz_set(poly->Y + poly->num_rels, Y);
+    poly->L[2*poly->num_rels] = L1;
+    poly->L[2*poly->num_rels + 1] = L2;
+    poly->num_rels++;
+
+    data = poly->data + poly->data_len;
+
+    for (i = 0; i < qs_inf->small_primes; i++)
+        *data++ = poly->small[i];
+
+    *data++ = poly->num_factors;
+
+    for (i = 0; i < poly->num_factors; i++)
+    {
+        *data++ = poly->factor[i].ind;
+        *data++ = poly->factor[i].exp;
+    }
+
+    poly->data_len += len;
+}
+
+/*
+   Factor Q(x) = Ax^2 + 2Bx + C for x = i - M over the factor base, where
+   value is the sieve value at i. Full relations and relations with one
+   or two large primes are stored in poly, to be merged by
+   qsieve_process_relations. Returns 1 if a relation was stored. Only
+   poly is written to, so that threads can evaluate candidates at the
+   same time.
+*/
+int qsieve_evaluate_candidate(qs_t qs_inf, qs_poly_t poly, slong i,
+                                                        unsigned char value)
+{
+    slong num_primes = qs_inf->num_primes;
+    slong small_primes = qs_inf->small_primes;
+    prime_t * factor_base = qs_inf->factor_base;
+    fac_t * factor = poly->factor;
+    mp_limb_t * soln1 = poly->soln1;
+    mp_limb_t * soln2 = poly->soln2;
+    mp_limb_t * A_ind = qs_inf->A_ind;
+    slong * small = poly->small;
+    slong max = qs_inf->max_factors - small_primes - 1;
+    slong num_factors = 0, found = 0;
+    slong j, k, exp;
+    mp_limb_t modp, prime, L, f;
+    int stored = 0;
+
+    fmpz_t X, Y, res, p;
+    fmpz_init(X);
+    fmpz_init(Y);
+    fmpz_init(res);
+    fmpz_init(p);
+
+    fmpz_set_si(X, i - qs_inf->sieve_size/2); /* X */
+
+    fmpz_mul(Y, X, qs_inf->A_mp);
+    fmpz_add(Y, Y, poly->B); /* Y = AX + B */
+    fmpz_add(res, Y, poly->B);
+    fmpz_mul(res, res, X);
+    fmpz_add(res, res, poly->C); /* res = AX^2 + 2BX + C */
+
+    if (fmpz_is_zero(res))
+        goto cleanup;
+
+    small[0] = (fmpz_sgn(res) < 0); /* the sign */
+    fmpz_abs(res, res);
+
+    small[1] = fmpz_val2(res); /* powers of 2 */
+    fmpz_tdiv_q_2exp(res, res, small[1]);
+
+    for (j = 2; j < small_primes; j++) /* pull out small primes */
+    {
+        fmpz_set_ui(p, factor_base[j].p);
+        small[j] = fmpz_remove(res, res, p);
+    }
+
+    /*
+       pull out the sieving primes until the sieve value is accounted
+       for, and the factors of A, which are not sieved with
+    */
+    for (j = small_primes; j < num_primes && found < value; j++)
+    {
+        prime = factor_base[j].p;
+
+        if (soln2[j] == -1)
+        {
+            fmpz_set_ui(p, prime);
+            exp = fmpz_remove(res, res, p);
+            factor[num_factors].ind = j;
+            factor[num_factors++].exp = exp + 1;
+        } else
+        {
+            modp = n_mod2_preinv(i, prime, factor_base[j].pinv);
+
+            if (modp == soln1[j] || modp == soln2[j])
+            {
+                fmpz_set_ui(p, prime);
+                exp = fmpz_remove(res, res, p);
+                factor[num_factors].ind = j;
+                factor[num_factors++].exp = exp;
+                found += factor_base[j].size;
+            }
+        }
+
+        if (num_factors >= max)
+            goto cleanup;
+    }
+
+    for (k = 0; k < qs_inf->s; k++) /* commit any outstanding A factors */
+    {
+        if (A_ind[k] >= j)
+        {
+            fmpz_set_ui(p, factor_base[A_ind[k]].p);
+            exp = fmpz_remove(res, res, p);
+            factor[num_factors].ind = A_ind[k];
+            factor[num_factors++].exp = exp + 1;
+
+            if (num_factors >= max)
+                goto cleanup;
+        }
+    }
+
+    poly->num_factors = num_factors;
+
+    if (fmpz_is_one(res)) /* we've found a full relation */
+    {
+        _qsieve_store_relation(qs_inf, poly, Y, 1, 1);
+        stored = 1;
+    } else if (fmpz_abs_fits_ui(res))
+    {
+        L = fmpz_get_ui(res);
+
+        if (L <= qs_inf->large_prime) /* one large prime */
+        {
+            _qsieve_store_relation(qs_inf, poly, Y, 1, L);
+            stored = 1;
+        }
+        else if (L <= qs_inf->dlp_bound && !n_is_prime(L))
+        {
+            /* two large primes */
+            f = n_factor_SQUFOF(L, 2000);
+
+            if (f != 0)
+            {
+                L /= f;
+                if (f > L)
+                {
+                    mp_limb_t t = f; f = L; L = t;
+                }
+
+                if (L <= qs_inf->large_prime)
+                {
+                    _qsieve_store_relation(qs_inf, poly, Y, f, L);
+                    stored = 1;
+                }
+            }
+        }
+    }
+
+cleanup:
+    fmpz_clear(X);
+    fmpz_clear(Y);
+    fmpz_clear(res);
+    fmpz_clear(p);
+
+    return stored;
+}
+
+/* evaluate the candidates in the block [start, start + length) */
+slong qsieve_evaluate_sieve(qs_t qs_inf, qs_poly_t poly,
+                                                slong start, slong length)
+{
+    unsigned char * sieve = poly->sieve;
+    ulong * sieve2 = (ulong *) sieve;
+    slong thresh = FLINT_MAX(qs_inf->sieve_thresh, 1);
+    ulong mask;
+    slong i, j, rels = 0;
+
+    /* bytes of at least thresh have some bit at least this set */
+    mask = UWORD(256) - (UWORD(1) << (FLINT_BIT_COUNT(thresh) - 1));
+    mask *= (UWORD_MAX/255);
+
+    for (j = 0; j < length/sizeof(ulong); j++)
+    {
+        if ((sieve2[j] & mask) == 0)
+            continue;
+
+        for (i = j*sizeof(ulong); i < (j + 1)*sizeof(ulong); i++)
+        {
+            if (sieve[i] >= thresh)
+                rels += qsieve_evaluate_candidate(qs_inf, poly, start + i,
+                                                  sieve[i]);
+        }
+    }
+
+    return rels;
+}
+
+/*
+   Sieve with the polynomials of index start to end - 1 for the current
+   A, in Gray code order, storing the relations found in poly. The data
+   for A is only read, so that several threads can sieve at once.
+   Returns the number of relations stored.
+*/
+slong qsieve_sieve_polys(qs_t qs_inf, qs_poly_t poly, slong start, slong end)
+{
+    slong s = qs_inf->s;
+    slong num_primes = qs_inf->num_primes;
+    mp_limb_t ** A_inv2B = qs_inf->A_inv2B;
+    slong relations = 0;
+    slong poly_index, i, j, m, pos;
+    int poly_add;
+
+    /*
+       The polynomial of index g is reached from B = sum B_terms[j] by the
+       steps for indices 1 to g, the step for index i changing the sign
+       of B_terms[j] for j the number of trailing zeros of i, to plus if
+       bit j + 1 of i is set. So the sign of B_terms[j] is given by the
+       last such step.
+    */
+    fmpz_zero(poly->B);
+    for (j = 0; j < s; j++)
+    {
+        m = (start >> j);
+        if (m != 0 && (m & 1) == 0)
+            m--;
+
+        if (m == 0 || (m & 2) != 0)
+            fmpz_add(poly->B, poly->B, qs_inf->B_terms_mp + j);
+        else
+            fmpz_sub(poly->B, poly->B, qs_inf->B_terms_mp + j);
+    }
+
+    qsieve_compute_roots(qs_inf, poly);
+    qsieve_compute_C(qs_inf, poly);
+
+    for (poly_index = start; ; )
+    {
+#if (QS_DEBUG & 4)
+        fmpz_print(qs_inf->A_mp); flint_printf("X^2+2*");
+        fmpz_print(poly->B); flint_printf("X+");
+        fmpz_print(poly->C); flint_printf("\n");
+#endif
+
+        for (i = qs_inf->small_primes; i < num_primes; i++)
+        {
+            poly->pos1[i] = poly->soln1[i];
+            poly->pos2[i] = poly->soln2[i];
+        }
+
+        for (pos = 0; pos < qs_inf->sieve_size; pos += qs_inf->block_size)
+        {
+            qsieve_do_sieving(qs_inf, poly, pos, qs_inf->block_size);
+            relations += qsieve_evaluate_sieve(qs_inf, poly, pos,
+                                               qs_inf->block_size);
+        }
+
+        if (++poly_index == end)
+            break;
+
+        /* move to the next polynomial in Gray code order */
+        for (j = 0; j < s; j++)
+            if (((poly_index >> j) & UWORD(1)) != UWORD(0)) break;
+
+        poly_add = ((poly_index >> j) & 2);
+
+        qsieve_update_offsets(qs_inf, poly, poly_add, A_inv2B[j]);
+
+        if (poly_add)
+            fmpz_addmul_ui(poly->B, qs_inf->B_terms_mp + j, 2);
+        else
+            fmpz_submul_ui(poly->B, qs_inf->B_terms_mp + j, 2);
+
+        qsieve_compute_C(qs_inf, poly);
+    }
+
+    return relations;
+}
+
+/*
+   Insert the relations stored in poly into the matrix, or into the large
+   prime graph if they are partial, and empty poly. Returns the number of
+   relations merged into the matrix.
+*/
+slong qsieve_process_relations(qs_t qs_inf, qs_poly_t poly)
+{
+    slong * data = poly->data;
+    slong relations = 0;
+    slong i, j;
+
+    for (i = 0; i < poly->num_rels; i++)
+    {
+        for (j = 0; j < qs_inf->small_primes; j++)
+            qs_inf->small[j] = *data++;
+
+        qs_inf->num_factors = *data++;
+
+        for (j = 0; j < qs_inf->num_factors; j++)
+        {
+            qs_inf->factor[j].ind = *data++;
+            qs_inf->factor[j].exp = *data++;
+        }
+
+        if (poly->L[2*i + 1] == 1) /* full relation */
+        {
+            if (qs_inf->num_relations < qs_inf->buffer_size)
+                relations += qsieve_ll_insert_relation(qs_inf, poly->Y + i);
+        } else
+            relations += qsieve_add_partial(qs_inf, poly->Y + i,
+                                            poly->L[2*i], poly->L[2*i + 1]);
+    }
+
+    poly->num_rels = 0;
+    poly->data_len = 0;
+
+    return relations;
+}
+
+typedef struct
+{
+    qs_s * qs_inf;
+    qs_poly_s * poly;
+    slong start;
+    slong end;
+} _qsieve_sieve_arg_t;
+
+static void *
+_qsieve_sieve_worker(void * arg_ptr)
+{
+    _qsieve_sieve_arg_t * arg = (_qsieve_sieve_arg_t *) arg_ptr;
+
+    qsieve_sieve_polys(arg->qs_inf, arg->poly, arg->start, arg->end);
+
+    return NULL;
+}
+
+/*
+   Sieve with the next QS_POLY_BATCH polynomials per thread, choosing a
+   new A coefficient when all the polynomials for the current one have
+   been used. The threads share the factor base and the data for A and
+   each has its own roots, sieve and relations. The relations are then
+   merged in a fixed order, duplicates being removed by the merge.
+   Returns the number of relations merged into the matrix.
+*/
+slong qsieve_collect_relations(qs_t qs_inf)
+{
+    slong num_polys = WORD(1) << (qs_inf->s - 1);
+    slong relations = 0;
+    slong i, num_tasks;
+    _qsieve_sieve_arg_t * args;
+
+    if (qs_inf->poly_index == 0 || qs_inf->poly_index == num_polys)
+    {
+        qsieve_compute_A(qs_inf);
+        qsieve_compute_B_terms(qs_inf);
+        qsieve_compute_off_adj(qs_inf);
+        qs_inf->poly_index = 0;
+    }
+
+    args = flint_malloc(qs_inf->num_threads*sizeof(_qsieve_sieve_arg_t));
+
+    for (num_tasks = 0; num_tasks < qs_inf->num_threads
+                        && qs_inf->poly_index < num_polys; num_tasks++)
+    {
+        args[num_tasks].qs_inf = qs_inf;
+        args[num_tasks].poly = qs_inf->poly + num_tasks;
+        args[num_tasks].start = qs_inf->poly_index;
+        args[num_tasks].end = FLINT_MIN(qs_inf->poly_index + QS_POLY_BATCH,
+                                        num_polys);
+        qs_inf->poly_index = args[num_tasks].end;
+    }
+
+    if (num_tasks == 1)
+        _qsieve_sieve_worker(args);
+    else
+        flint_parallel_do(_qsieve_sieve_worker, args,
+                          sizeof(_qsieve_sieve_arg_t), num_tasks);
+
+    for (i = 0; i < num_tasks; i++)
+        relations += qsieve_process_relations(qs_inf, qs_inf->poly + i);
+
+    relations += qsieve_ll_merge_relations(qs_inf);
+
+    flint_free(args);
+
+    return relations;
+}
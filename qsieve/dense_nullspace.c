@@ -0,0 +1,74 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "qsieve.h"
+#include "gf2_mat.h"
+
+/*
+   Finds up to 64 vectors in the nullspace of the nrows x ncols matrix
+   over GF(2) given by the columns B, in the format returned by
+   block_lanczos: bit l of entry i is set if column i is part of
+   vector l. The matrix is packed and reduced with gf2_mat_nullspace,
+   which is faster than block Lanczos for small matrices and never
+   needs to be restarted.
+*/
+uint64_t * qsieve_dense_nullspace(slong nrows, slong ncols, la_col_t * B)
+{
+    gf2_mat_t M, X;
+    uint64_t * nullrows;
+    slong i, j, l, row, nullity;
+
+    gf2_mat_init(M, nrows, ncols);
+
+    for (i = 0; i < ncols; i++)
+    {
+        for (j = 0; j < B[i].weight; j++)
+        {
+            row = B[i].data[j];
+            M->rows[row][i / FLINT_BITS] ^= UWORD(1) << (i % FLINT_BITS);
+        }
+    }
+
+    gf2_mat_init(X, ncols, ncols);
+    nullity = gf2_mat_nullspace(X, M);
+
+    nullrows = flint_malloc(FLINT_MAX(ncols, 1) * sizeof(uint64_t));
+
+    for (i = 0; i < ncols; i++)
+    {
+        nullrows[i] = 0;
+        for (l = 0; l < FLINT_MIN(nullity, 64); l++)
+            if (gf2_mat_entry(X, i, l))
+                nullrows[i] |= (uint64_t)(1) << l;
+    }
+
+    gf2_mat_clear(M);
+    gf2_mat_clear(X);
+
+    return nullrows;
+}
@@ -0,0 +1,201 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#define ulong ulongxx /* interferes with system includes */
+#include <stdio.h>
+#undef ulong
+#define ulong mp_limb_t
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+#include "fmpz.h"
+
+/* number of times to restart the sieve if no factor is found */
+#define QS_ATTEMPTS 5
+
+static int
+_qsieve_factor(fmpz_t f, const fmpz_t n, slong attempt)
+{
+    qs_t qs_inf;
+    mp_limb_t small_factor;
+    slong ncols, nrows, i, count;
+    uint64_t * nullrows;
+    uint64_t mask;
+    flint_rand_t state;
+    fmpz_t X, Y;
+    int found = 0;
+
+    /************************************************************************
+        INITIALISATION:
+
+        Initialise the qs_t structure.
+    ************************************************************************/
+
+    qsieve_init(qs_inf, n);
+
+    /* use different A coefficients on each attempt */
+    for (i = 0; i < attempt; i++)
+        n_randlimb(qs_inf->state);
+
+#if QS_DEBUG
+    flint_printf("\nFactoring "); fmpz_print(qs_inf->n);
+    flint_printf(" of %wd bits\n", qs_inf->bits);
+#endif
+
+    /************************************************************************
+        KNUTH SCHROEPPEL:
+
+        Try to compute a multiplier k such that there are a lot of small
+        primes which are quadratic residues modulo kn. If a small factor of n
+        is found during this process it is returned.
+    ************************************************************************/
+
+    small_factor = qsieve_ll_knuth_schroeppel(qs_inf);
+    if (small_factor)
+    {
+        fmpz_set_ui(f, small_factor);
+        found = 1;
+        goto cleanup;
+    }
+
+    fmpz_mul_ui(qs_inf->kn, qs_inf->n, qs_inf->k); /* compute kn */
+    qs_inf->bits = fmpz_bits(qs_inf->kn);
+
+    /************************************************************************
+        COMPUTE FACTOR BASE:
+
+        Compute the factor base primes and the sieve parameters. If a small
+        factor of n is found during this process it is returned.
+    ************************************************************************/
+
+    small_factor = qsieve_primes_init(qs_inf);
+    if (small_factor)
+    {
+        fmpz_set_ui(f, small_factor);
+        found = 1;
+        goto cleanup;
+    }
+
+    /************************************************************************
+        INITIALISE POLYNOMIAL, RELATION AND LINEAR ALGEBRA DATA
+    ************************************************************************/
+
+    qsieve_linalg_init(qs_inf);
+    qsieve_poly_init(qs_inf);
+
+    /************************************************************************
+        SIEVE:
+
+        Sieve for relations, a batch of polynomials per thread at a time
+    ************************************************************************/
+
+    ncols = qs_inf->num_primes + qs_inf->extra_rels;
+    nrows = qs_inf->num_primes;
+
+    while (qs_inf->columns < ncols)
+    {
+        qsieve_collect_relations(qs_inf);
+
+#if (QS_DEBUG & 128)
+        flint_printf("%wd/%wd relations, %wd from %wd partials.\n",
+                     qs_inf->columns, ncols, qs_inf->num_cycles,
+                     qs_inf->num_partials);
+#endif
+    }
+
+    /************************************************************************
+        REDUCE MATRIX AND BLOCK LANCZOS:
+
+        Perform some light filtering on the matrix and find up to 64
+        nullspace vectors, by dense elimination for small matrices
+    ************************************************************************/
+
+    reduce_matrix(qs_inf, &nrows, &ncols, qs_inf->matrix);
+
+    flint_randinit(state);
+
+    if (ncols <= QS_DENSE_LINALG_CUTOFF) /* small matrices are done densely */
+        nullrows = qsieve_dense_nullspace(nrows, ncols, qs_inf->matrix);
+    else
+    {
+        do /* repeat block lanczos until it succeeds */
+        {
+            nullrows = block_lanczos(state, nrows, 0, ncols, qs_inf->matrix);
+        } while (nullrows == NULL);
+    }
+
+    flint_randclear(state);
+
+    for (i = 0, mask = 0; i < ncols; i++) /* create mask of nullspace vectors */
+        mask |= nullrows[i];
+
+    /************************************************************************
+        SQUARE ROOT:
+
+        Compute the square root and take the GCD of X-Y with n
+    ************************************************************************/
+
+    fmpz_init(X);
+    fmpz_init(Y);
+
+    for (count = 0; count < 64 && !found; count++)
+    {
+        if (mask & ((uint64_t)(1) << count))
+        {
+            qsieve_ll_square_root(X, Y, qs_inf, nullrows, ncols, count,
+                                  qs_inf->n);
+            fmpz_sub(X, X, Y);
+            fmpz_gcd(X, X, qs_inf->n);
+
+            if (!fmpz_equal(X, qs_inf->n) && !fmpz_is_one(X))
+            {
+                fmpz_set(f, X);
+                found = 1;
+            }
+        }
+    }
+
+    fmpz_clear(X);
+    fmpz_clear(Y);
+    flint_free(nullrows);
+
+cleanup:
+    qsieve_clear(qs_inf);
+
+    return found;
+}
+
+void qsieve_factor(fmpz_t f, const fmpz_t n)
+{
+    slong attempt;
+
+    for (attempt = 0; attempt < QS_ATTEMPTS; attempt++)
+        if (_qsieve_factor(f, n, attempt))
+            return;
+
+    fmpz_zero(f);
+}
@@ -0,0 +1,105 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+#include "fmpz.h"
+
+void qsieve_init(qs_t qs_inf, const fmpz_t n)
+{
+    ulong i;
+
+    fmpz_init(qs_inf->n);
+    fmpz_abs(qs_inf->n, n);
+
+    /* the low limbs are not used by the multi-limb sieve */
+    qs_inf->hi = 0;
+    qs_inf->lo = 0;
+
+    /* determine the number of bits of n */
+    qs_inf->bits = fmpz_bits(qs_inf->n);
+
+    /* determine which index in the tuning table n corresponds to */
+    for (i = 1; i < QS_TUNE_SIZE; i++)
+    {
+        if (qsieve_tune[i][0] > qs_inf->bits)
+            break;
+    }
+    i--;
+
+    qs_inf->ks_primes  = qsieve_tune[i][1]; /* number of Knuth-Schroeppel primes */
+    qs_inf->num_primes = qsieve_tune[i][2]; /* number of factor base primes */
+
+    fmpz_init(qs_inf->kn);
+    fmpz_init(qs_inf->C);
+    fmpz_init(qs_inf->A_mp);
+    fmpz_init(qs_inf->B_mp);
+    fmpz_init(qs_inf->target_A_mp);
+
+    qs_inf->factor_base = NULL;
+    qs_inf->sqrts       = NULL;
+    qs_inf->B_terms     = NULL;
+    qs_inf->A_inv       = NULL;
+    qs_inf->A_inv2B     = NULL;
+    qs_inf->B_terms_mp  = NULL;
+    qs_inf->poly        = NULL;
+    qs_inf->num_threads = 0;
+    qs_inf->poly_index  = 0;
+
+    qs_inf->A_used       = NULL;
+    qs_inf->A_used_num   = 0;
+    qs_inf->A_used_alloc = 0;
+
+    qs_inf->small       = NULL;
+    qs_inf->factor      = NULL;
+    qs_inf->matrix      = NULL;
+    qs_inf->Y_arr       = NULL;
+    qs_inf->relation    = NULL;
+    qs_inf->qsort_arr   = NULL;
+
+    qs_inf->prime_count = NULL;
+
+    qs_inf->partials       = NULL;
+    qs_inf->num_partials   = 0;
+    qs_inf->partials_alloc = 0;
+    qs_inf->vertices       = NULL;
+    qs_inf->num_vertices   = 0;
+    qs_inf->vertices_alloc = 0;
+    qs_inf->lp_hash        = NULL;
+    qs_inf->lp_hash_alloc  = 0;
+    qs_inf->num_cycles     = 0;
+    qs_inf->mark           = 0;
+
+    qs_inf->A = 0;
+    qs_inf->s = 0;
+
+    flint_randinit(qs_inf->state);
+
+#if (QS_DEBUG & 16)
+    qs_inf->sieve_tally = flint_malloc(256*sizeof(slong));
+#endif
+}
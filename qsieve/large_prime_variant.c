@@ -0,0 +1,324 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#define ulong ulongxx /* interferes with system includes */
+#include <string.h>
+#include <stdlib.h>
+#undef ulong
+#define ulong mp_limb_t
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+#include "fmpz.h"
+
+/*
+   Partial relations are edges of a graph whose vertices are the large
+   primes and 1: a relation with one large prime p joins 1 and p and one
+   with two large primes p and q joins p and q. The product of the
+   relations on a cycle of this graph has every large prime to an even
+   power and gives a full relation. A spanning forest is kept so that
+   cycles are found as soon as the edge closing them arrives.
+*/
+
+static slong
+lp_hash_func(mp_limb_t p, slong alloc)
+{
+    p *= UWORD(2654435761);
+    return (slong) ((p ^ (p >> 17)) & (alloc - 1));
+}
+
+/* returns the vertex for p, creating it if necessary */
+static slong
+lp_vertex(qs_t qs_inf, mp_limb_t p)
+{
+    slong h, i, v;
+
+    if (2*(qs_inf->num_vertices + 1) > qs_inf->lp_hash_alloc)
+    {
+        slong alloc = FLINT_MAX(2*qs_inf->lp_hash_alloc, 1024);
+
+        flint_free(qs_inf->lp_hash);
+        qs_inf->lp_hash = flint_malloc(alloc*sizeof(slong));
+        qs_inf->lp_hash_alloc = alloc;
+
+        for (i = 0; i < alloc; i++)
+            qs_inf->lp_hash[i] = -1;
+
+        for (v = 0; v < qs_inf->num_vertices; v++)
+        {
+            h = lp_hash_func(qs_inf->vertices[v].p, alloc);
+            while (qs_inf->lp_hash[h] != -1)
+                h = (h + 1) & (alloc - 1);
+            qs_inf->lp_hash[h] = v;
+        }
+    }
+
+    h = lp_hash_func(p, qs_inf->lp_hash_alloc);
+    while ((v = qs_inf->lp_hash[h]) != -1)
+    {
+        if (qs_inf->vertices[v].p == p)
+            return v;
+        h = (h + 1) & (qs_inf->lp_hash_alloc - 1);
+    }
+
+    if (qs_inf->num_vertices == qs_inf->vertices_alloc)
+    {
+        qs_inf->vertices_alloc = FLINT_MAX(2*qs_inf->vertices_alloc, 256);
+        qs_inf->vertices = flint_realloc(qs_inf->vertices,
+                                 qs_inf->vertices_alloc*sizeof(qs_vertex_t));
+    }
+
+    v = qs_inf->num_vertices++;
+    qs_inf->vertices[v].p = p;
+    qs_inf->vertices[v].parent = -1;
+    qs_inf->vertices[v].edge = -1;
+    qs_inf->vertices[v].size = 1;
+    qs_inf->vertices[v].mark = 0;
+    qs_inf->lp_hash[h] = v;
+
+    return v;
+}
+
+static slong
+lp_root(qs_vertex_t * vertices, slong v)
+{
+    while (vertices[v].parent != -1)
+        v = vertices[v].parent;
+
+    return v;
+}
+
+/* make v the root of its tree by reversing the path to the old root */
+static void
+lp_reroot(qs_vertex_t * vertices, slong v)
+{
+    slong prev = -1, prev_edge = -1, next, next_edge;
+
+    while (v != -1)
+    {
+        next = vertices[v].parent;
+        next_edge = vertices[v].edge;
+        vertices[v].parent = prev;
+        vertices[v].edge = prev_edge;
+        prev = v;
+        prev_edge = next_edge;
+        v = next;
+    }
+}
+
+static int
+slong_cmp(const void * a, const void * b)
+{
+    slong x = *((slong *) a), y = *((slong *) b);
+
+    return (x > y) - (x < y);
+}
+
+/*
+   Combine the partial relations on the cycle closed by edge e joining u
+   and v into a full relation and insert it. Returns the number of
+   relations merged into the matrix as a result.
+*/
+static slong
+lp_cycle(qs_t qs_inf, slong u, slong v, slong e)
+{
+    qs_vertex_t * vertices = qs_inf->vertices;
+    slong * count = qs_inf->prime_count;
+    slong * touched, * edges;
+    slong num_edges = 0, num_touched = 0, num_factors = 0;
+    slong i, j, w, x, ind, total;
+    slong relations = 0;
+    fmpz_t Y, L;
+
+    qs_inf->mark++;
+
+    for (x = u, total = 1; x != -1; x = vertices[x].parent, total++)
+        vertices[x].mark = qs_inf->mark;
+
+    for (w = v; vertices[w].mark != qs_inf->mark; w = vertices[w].parent)
+        total++;
+
+    edges = flint_malloc(total*sizeof(slong));
+
+    fmpz_init(Y);
+    fmpz_init(L);
+    fmpz_set_ui(L, vertices[w].p);
+
+    for (x = u; x != w; x = vertices[x].parent)
+    {
+        edges[num_edges++] = vertices[x].edge;
+        fmpz_mul_ui(L, L, vertices[x].p);
+    }
+
+    for (x = v; x != w; x = vertices[x].parent)
+    {
+        edges[num_edges++] = vertices[x].edge;
+        fmpz_mul_ui(L, L, vertices[x].p);
+    }
+
+    edges[num_edges++] = e;
+
+    /* Y is the product of the Y values divided by the large primes */
+    if (!fmpz_invmod(L, L, qs_inf->n))
+        goto cleanup;
+
+    fmpz_set(Y, L);
+
+    for (i = 0, total = 0; i < num_edges; i++)
+        total += qs_inf->partials[edges[i]].fac[0];
+
+    touched = flint_malloc(total*sizeof(slong));
+
+    for (i = 0; i < num_edges; i++)
+    {
+        qs_partial_t * rel = qs_inf->partials + edges[i];
+
+        for (j = 0; j < rel->fac[0]; j++)
+        {
+            ind = rel->fac[2*j + 1];
+            if (count[ind] == 0)
+                touched[num_touched++] = ind;
+            count[ind] += rel->fac[2*j + 2];
+        }
+
+        fmpz_mul(Y, Y, &rel->Y);
+        fmpz_mod(Y, Y, qs_inf->n);
+    }
+
+    /* relations with too many factors are dropped */
+    if (num_touched >= qs_inf->max_factors
+        || qs_inf->num_relations >= qs_inf->buffer_size)
+    {
+        for (i = 0; i < num_touched; i++)
+            count[touched[i]] = 0;
+        flint_free(touched);
+        goto cleanup;
+    }
+
+    qsort(touched, num_touched, sizeof(slong), slong_cmp);
+
+    for (i = 0; i < qs_inf->small_primes; i++)
+        qs_inf->small[i] = 0;
+
+    for (i = 0; i < num_touched; i++)
+    {
+        ind = touched[i];
+
+        if (ind < qs_inf->small_primes)
+            qs_inf->small[ind] = count[ind];
+        else
+        {
+            qs_inf->factor[num_factors].ind = ind;
+            qs_inf->factor[num_factors++].exp = count[ind];
+        }
+
+        count[ind] = 0;
+    }
+
+    flint_free(touched);
+
+    {
+        qs_inf->num_factors = num_factors;
+        relations = qsieve_ll_insert_relation(qs_inf, Y);
+        qs_inf->num_cycles++;
+    }
+
+cleanup:
+    flint_free(edges);
+    fmpz_clear(Y);
+    fmpz_clear(L);
+
+    return relations;
+}
+
+/*
+   Store the relation with cofactor L1*L2 described by Y and the factors
+   in qs_inf->small and qs_inf->factor. Returns the number of relations
+   merged into the matrix if the relation closes a cycle.
+*/
+slong qsieve_add_partial(qs_t qs_inf, fmpz_t Y, mp_limb_t L1, mp_limb_t L2)
+{
+    qs_partial_t * rel;
+    slong i, num = 0, e, u, v, ru, rv;
+
+    if (qs_inf->num_partials == qs_inf->partials_alloc)
+    {
+        qs_inf->partials_alloc = FLINT_MAX(2*qs_inf->partials_alloc, 256);
+        qs_inf->partials = flint_realloc(qs_inf->partials,
+                               qs_inf->partials_alloc*sizeof(qs_partial_t));
+    }
+
+    e = qs_inf->num_partials++;
+    rel = qs_inf->partials + e;
+
+    rel->L1 = L1;
+    rel->L2 = L2;
+    fmpz_init_set(&rel->Y, Y);
+    rel->fac = flint_malloc((2*(qs_inf->small_primes
+                            + qs_inf->num_factors) + 1)*sizeof(slong));
+
+    for (i = 0; i < qs_inf->small_primes; i++)
+    {
+        if (qs_inf->small[i])
+        {
+            rel->fac[2*num + 1] = i;
+            rel->fac[2*num + 2] = qs_inf->small[i];
+            num++;
+        }
+    }
+
+    for (i = 0; i < qs_inf->num_factors; i++)
+    {
+        rel->fac[2*num + 1] = qs_inf->factor[i].ind;
+        rel->fac[2*num + 2] = qs_inf->factor[i].exp;
+        num++;
+    }
+
+    rel->fac[0] = num;
+
+    u = lp_vertex(qs_inf, L1);
+    v = lp_vertex(qs_inf, L2);
+    ru = lp_root(qs_inf->vertices, u);
+    rv = lp_root(qs_inf->vertices, v);
+
+    if (ru == rv)
+        return lp_cycle(qs_inf, u, v, e);
+
+    /* hang the smaller tree below the other endpoint */
+    if (qs_inf->vertices[ru].size > qs_inf->vertices[rv].size)
+    {
+        slong t = u; u = v; v = t;
+        t = ru; ru = rv; rv = t;
+    }
+
+    lp_reroot(qs_inf->vertices, u);
+    qs_inf->vertices[u].parent = v;
+    qs_inf->vertices[u].edge = e;
+    qs_inf->vertices[rv].size += qs_inf->vertices[ru].size;
+
+    return 0;
+}
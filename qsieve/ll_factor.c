@@ -199,7 +199,8 @@ mp_limb_t qsieve_ll_factor(mp_limb_t hi, mp_limb_t lo)
     /************************************************************************
         BLOCK LANCZOS:
         
-        Find extra_rels nullspace vectors (if they exist)
+        Find extra_rels nullspace vectors (if they exist), by dense
+        elimination for small matrices
     ************************************************************************/
 
 #if QS_DEBUG
@@ -208,10 +209,15 @@ mp_limb_t qsieve_ll_factor(mp_limb_t hi, mp_limb_t lo)
 
     flint_randinit(state); /* initialise the random generator */
    
-    do /* repeat block lanczos until it succeeds */
+    if (ncols <= QS_DENSE_LINALG_CUTOFF) /* small matrices are done densely */
+        nullrows = qsieve_dense_nullspace(nrows, ncols, qs_inf->matrix);
+    else
     {
-        nullrows = block_lanczos(state, nrows, 0, ncols, qs_inf->matrix);
-    } while (nullrows == NULL); 
+        do /* repeat block lanczos until it succeeds */
+        {
+            nullrows = block_lanczos(state, nrows, 0, ncols, qs_inf->matrix);
+        } while (nullrows == NULL);
+    }
         
     for (i = 0, mask = 0; i < ncols; i++) /* create mask of nullspace vectors */
         mask |= nullrows[i];
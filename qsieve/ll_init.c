@@ -37,6 +37,11 @@ void qsieve_ll_init(qs_t qs_inf, mp_limb_t hi, mp_limb_t lo)
     qs_inf->hi = hi;
     qs_inf->lo = lo;
 
+    fmpz_init(qs_inf->n);
+    fmpz_set_ui(qs_inf->n, hi);
+    fmpz_mul_2exp(qs_inf->n, qs_inf->n, FLINT_BITS);
+    fmpz_add_ui(qs_inf->n, qs_inf->n, lo);
+
     /* determine the number of bits of n */
     qs_inf->bits = (hi ? FLINT_BITS + FLINT_BIT_COUNT(hi) : FLINT_BIT_COUNT(lo));
 
@@ -30,6 +30,7 @@
 #include "ulong_extras.h"
 #include "longlong.h"
 #include "qsieve.h"
+#include "fmpz.h"
 
 /* Array of possible Knuth-Schroeppel multipliers */
 static const mp_limb_t multipliers[] = {1, 2, 3, 5, 6, 7, 10, 11, 13, 14, 15, 
@@ -55,11 +56,11 @@ mp_limb_t qsieve_ll_knuth_schroeppel(qs_t qs_inf)
     mp_limb_t nmod8, mod8, p, nmod, pinv, mult;
     int kron, jac;
 
-    if ((qs_inf->lo & 1) == 0) /* check 2 is not a factor */
+    if (fmpz_is_even(qs_inf->n)) /* check 2 is not a factor */
         return 2; 
 
     /* initialise weights for each multiplier k depending on kn mod 8 */
-    nmod8 = qs_inf->lo % 8; /* n modulo 8 */
+    nmod8 = fmpz_fdiv_ui(qs_inf->n, 8); /* n modulo 8 */
     
     for (i = 0; i < KS_MULTIPLIERS; i++)
     {
@@ -87,7 +88,7 @@ mp_limb_t qsieve_ll_knuth_schroeppel(qs_t qs_inf)
 
         logpdivp = log((float) p) / (float) p; /* log p / p */
 
-        nmod = n_ll_mod_preinv(qs_inf->hi, qs_inf->lo, p, pinv); 
+        nmod = fmpz_fdiv_ui(qs_inf->n, p); 
         if (nmod == 0) return p; /* we found a small factor */
 
         kron = 1; /* n mod p is even, not handled by n_jacobi */
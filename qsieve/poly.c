@@ -0,0 +1,401 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+void qsieve_poly_init(qs_t qs_inf)
+{
+    slong num_primes = qs_inf->num_primes;
+    slong s = qs_inf->s; /* number of prime factors in A coeff */
+    mp_limb_t ** A_inv2B;
+    slong i;
+
+    qs_inf->B_terms = flint_malloc(4*s*sizeof(mp_limb_t));
+    qs_inf->A_ind = qs_inf->B_terms + s;
+    qs_inf->A_modp = qs_inf->A_ind + s;
+    qs_inf->inv_p2 = qs_inf->A_modp + s;
+
+    qs_inf->B_terms_mp = _fmpz_vec_init(s);
+
+    qs_inf->A_inv2B = flint_malloc(s*sizeof(mp_limb_t *));
+
+    /* the roots are kept by each thread */
+    qs_inf->A_inv = flint_malloc(num_primes*sizeof(mp_limb_t));
+    qs_inf->soln1 = NULL;
+    qs_inf->soln2 = NULL;
+
+    A_inv2B = qs_inf->A_inv2B;
+
+    A_inv2B[0] = flint_malloc(num_primes*s*sizeof(mp_limb_t));
+    for (i = 1; i < s; i++)
+        A_inv2B[i] = A_inv2B[i - 1] + num_primes;
+
+    qs_inf->num_threads = flint_get_num_threads();
+    qs_inf->poly = flint_malloc(qs_inf->num_threads*sizeof(qs_poly_s));
+
+    for (i = 0; i < qs_inf->num_threads; i++)
+    {
+        qs_poly_s * poly = qs_inf->poly + i;
+
+        fmpz_init(poly->B);
+        fmpz_init(poly->C);
+
+        poly->soln1 = flint_malloc(4*num_primes*sizeof(mp_limb_t));
+        poly->soln2 = poly->soln1 + num_primes;
+        poly->pos1 = poly->soln2 + num_primes;
+        poly->pos2 = poly->pos1 + num_primes;
+
+        poly->sieve = flint_malloc(qs_inf->block_size + sizeof(ulong));
+
+        poly->small = flint_malloc(qs_inf->small_primes*sizeof(slong));
+        poly->factor = flint_malloc(qs_inf->max_factors*sizeof(fac_t));
+        poly->num_factors = 0;
+
+        poly->Y = NULL;
+        poly->L = NULL;
+        poly->data = NULL;
+        poly->num_rels = 0;
+        poly->rels_alloc = 0;
+        poly->data_len = 0;
+        poly->data_alloc = 0;
+    }
+
+    qs_inf->poly_index = 0;
+}
+
+/* index of the factor base prime closest to r, at least small_primes */
+static slong
+closest_prime(qs_t qs_inf, mp_limb_t r)
+{
+    prime_t * factor_base = qs_inf->factor_base;
+    slong lo = qs_inf->small_primes, hi = qs_inf->num_primes - 1, mid;
+
+    while (hi - lo > 1)
+    {
+        mid = (lo + hi)/2;
+        if (factor_base[mid].p <= r)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    if (r - factor_base[lo].p < factor_base[hi].p - r || r < factor_base[lo].p)
+        return lo;
+    else
+        return hi;
+}
+
+static int
+A_ind_valid(qs_t qs_inf, slong n, slong j)
+{
+    slong i;
+
+    /* primes dividing k have only one square root of kn */
+    if (qs_inf->sqrts[j] == 0)
+        return 0;
+
+    for (i = 0; i < n; i++)
+        if (qs_inf->A_ind[i] == j)
+            return 0;
+
+    return 1;
+}
+
+/*
+   Choose s - 1 distinct random primes in the window of primes and a last
+   prime making A close to target_A. The sizes allowed are relaxed each
+   time QS_A_TRIES attempts fail and A coefficients are never reused.
+*/
+void qsieve_compute_A(qs_t qs_inf)
+{
+    slong s = qs_inf->s;
+    slong min = qs_inf->min;
+    slong span = qs_inf->span;
+    mp_limb_t * A_ind = qs_inf->A_ind;
+    prime_t * factor_base = qs_inf->factor_base;
+    slong i, j, k, tries = 0, slack = 1;
+    mp_limb_t r;
+    fmpz_t prod, rem;
+    int ok;
+
+    fmpz_init(prod);
+    fmpz_init(rem);
+
+    while (1)
+    {
+        fmpz_one(prod);
+
+        for (i = 0; i < s - 1; i++)
+        {
+            do
+            {
+                j = min + n_randint(qs_inf->state, span);
+            } while (!A_ind_valid(qs_inf, i, j));
+
+            A_ind[i] = j;
+            fmpz_mul_ui(prod, prod, factor_base[j].p);
+        }
+
+        ok = 0;
+        fmpz_tdiv_q(rem, qs_inf->target_A_mp, prod);
+
+        if (s == 1)
+        {
+            j = min + n_randint(qs_inf->state, span);
+            ok = A_ind_valid(qs_inf, 0, j);
+        }
+        else if (fmpz_abs_fits_ui(rem) && !fmpz_is_zero(rem))
+        {
+            r = fmpz_get_ui(rem);
+            j = closest_prime(qs_inf, r);
+
+            for (k = 0; k < 2 && !ok; k++, j++)
+                ok = j < qs_inf->num_primes && A_ind_valid(qs_inf, s - 1, j);
+            j--;
+        }
+
+        if (ok)
+        {
+            A_ind[s - 1] = j;
+            fmpz_mul_ui(prod, prod, factor_base[j].p);
+
+            /* require target_A/2^slack <= A <= target_A*2^slack */
+            fmpz_mul_2exp(rem, prod, slack);
+            ok = fmpz_cmp(rem, qs_inf->target_A_mp) >= 0;
+            fmpz_mul_2exp(rem, qs_inf->target_A_mp, slack);
+            ok = ok && fmpz_cmp(prod, rem) <= 0;
+
+            for (i = 0; i < qs_inf->A_used_num && ok; i++)
+                ok = !fmpz_equal(qs_inf->A_used + i, prod);
+        }
+
+        if (ok)
+            break;
+
+        if (++tries == QS_A_TRIES)
+        {
+            tries = 0;
+            slack++;
+
+            /* all polynomials in the window have been used, widen it */
+            if (slack > 2*s + 4)
+            {
+                qs_inf->min = min = FLINT_MAX(min - span/2,
+                                              qs_inf->small_primes);
+                qs_inf->span = span = FLINT_MIN(2*span,
+                                                qs_inf->num_primes - min);
+                slack = 1;
+            }
+        }
+    }
+
+    /* sort the factors of A */
+    for (i = 1; i < s; i++)
+    {
+        for (j = i; j > 0 && A_ind[j - 1] > A_ind[j]; j--)
+        {
+            k = A_ind[j];
+            A_ind[j] = A_ind[j - 1];
+            A_ind[j - 1] = k;
+        }
+    }
+
+    fmpz_swap(qs_inf->A_mp, prod);
+
+    if (qs_inf->A_used_num == qs_inf->A_used_alloc)
+    {
+        slong alloc = FLINT_MAX(2*qs_inf->A_used_alloc, 16);
+
+        qs_inf->A_used = flint_realloc(qs_inf->A_used, alloc*sizeof(fmpz));
+        for (i = qs_inf->A_used_alloc; i < alloc; i++)
+            fmpz_init(qs_inf->A_used + i);
+        qs_inf->A_used_alloc = alloc;
+    }
+
+    fmpz_set(qs_inf->A_used + qs_inf->A_used_num, qs_inf->A_mp);
+    qs_inf->A_used_num++;
+
+    fmpz_clear(prod);
+    fmpz_clear(rem);
+
+#if (QS_DEBUG & 2)
+    flint_printf("A = "); fmpz_print(qs_inf->A_mp);
+    flint_printf(", target A = "); fmpz_print(qs_inf->target_A_mp);
+    flint_printf("\n");
+#endif
+}
+
+/*
+   For each prime q dividing A, B_terms[i] = (A/q)*g where g is the
+   smaller of the square roots of kn times (A/q)^(-1) modulo q. B is their
+   sum, so that B^2 = kn mod A.
+*/
+void qsieve_compute_B_terms(qs_t qs_inf)
+{
+    slong s = qs_inf->s;
+    mp_limb_t * A_ind = qs_inf->A_ind;
+    mp_limb_t * A_modp = qs_inf->A_modp;
+    fmpz * B_terms = qs_inf->B_terms_mp;
+    prime_t * factor_base = qs_inf->factor_base;
+    mp_limb_t p, pinv, temp;
+    slong i;
+
+    fmpz_zero(qs_inf->B_mp);
+
+    for (i = 0; i < s; i++)
+    {
+        p = factor_base[A_ind[i]].p;
+        pinv = factor_base[A_ind[i]].pinv;
+        fmpz_divexact_ui(B_terms + i, qs_inf->A_mp, p);
+        A_modp[i] = fmpz_fdiv_ui(B_terms + i, p);
+        temp = n_invmod(A_modp[i], p);
+        temp = n_mulmod2_preinv(temp, qs_inf->sqrts[A_ind[i]], p, pinv);
+        if (temp > p/2)
+            temp = p - temp;
+        fmpz_mul_ui(B_terms + i, B_terms + i, temp);
+        fmpz_add(qs_inf->B_mp, qs_inf->B_mp, B_terms + i);
+    }
+}
+
+/*
+   Compute A^(-1) modulo the sieving primes and the corrections
+   2*B_terms[j]/A used to switch between the polynomials for the same A.
+   Primes dividing A are marked by setting A_inv to 0.
+*/
+void qsieve_compute_off_adj(qs_t qs_inf)
+{
+    slong num_primes = qs_inf->num_primes;
+    mp_limb_t * A_inv = qs_inf->A_inv;
+    mp_limb_t ** A_inv2B = qs_inf->A_inv2B;
+    fmpz * B_terms = qs_inf->B_terms_mp;
+    prime_t * factor_base = qs_inf->factor_base;
+    slong s = qs_inf->s;
+    mp_limb_t p, pinv, temp;
+    slong i, j;
+
+    for (i = qs_inf->small_primes; i < num_primes; i++)
+    {
+        p = factor_base[i].p;
+        pinv = factor_base[i].pinv;
+
+        temp = fmpz_fdiv_ui(qs_inf->A_mp, p);
+        if (temp == 0) /* p divides A */
+        {
+            A_inv[i] = 0;
+            continue;
+        }
+
+        A_inv[i] = n_invmod(temp, p);
+
+        for (j = 0; j < s; j++)
+        {
+            temp = fmpz_fdiv_ui(B_terms + j, p);
+            temp = n_mulmod2_preinv(temp, A_inv[i], p, pinv);
+            temp = n_addmod(temp, temp, p);
+            A_inv2B[j][i] = temp;
+        }
+    }
+}
+
+/*
+   Compute the roots soln1, soln2 of Q(x) = (Ax + B)^2 - kn modulo the
+   sieving primes, offset by M, for the coefficient B of poly. Primes
+   dividing A are marked by setting soln2 to -1.
+*/
+void qsieve_compute_roots(qs_t qs_inf, qs_poly_t poly)
+{
+    slong num_primes = qs_inf->num_primes;
+    mp_limb_t * A_inv = qs_inf->A_inv;
+    mp_limb_t * soln1 = poly->soln1;
+    mp_limb_t * soln2 = poly->soln2;
+    int * sqrts = qs_inf->sqrts;
+    prime_t * factor_base = qs_inf->factor_base;
+    mp_limb_t p, pinv, temp, temp2, b, M = qs_inf->sieve_size/2;
+    slong i;
+
+    for (i = qs_inf->small_primes; i < num_primes; i++)
+    {
+        p = factor_base[i].p;
+        pinv = factor_base[i].pinv;
+
+        if (A_inv[i] == 0) /* p divides A */
+        {
+            soln1[i] = soln2[i] = -1;
+            continue;
+        }
+
+        b = fmpz_fdiv_ui(poly->B, p);
+        temp = n_mod2_preinv(M, p, pinv);
+
+        soln1[i] = n_mulmod2_preinv(n_submod(sqrts[i], b, p), A_inv[i],
+                                    p, pinv);
+        soln1[i] = n_addmod(soln1[i], temp, p);
+
+        temp2 = (sqrts[i] == 0) ? 0 : p - sqrts[i];
+        soln2[i] = n_mulmod2_preinv(n_submod(temp2, b, p), A_inv[i], p, pinv);
+        soln2[i] = n_addmod(soln2[i], temp, p);
+    }
+}
+
+/* C = (B^2 - kn)/A */
+void qsieve_compute_C(qs_t qs_inf, qs_poly_t poly)
+{
+    fmpz_mul(poly->C, poly->B, poly->B);
+    fmpz_sub(poly->C, poly->C, qs_inf->kn);
+    fmpz_divexact(poly->C, poly->C, qs_inf->A_mp);
+}
+
+/*
+   Update the roots when B changes to B + 2*B_terms[j] (poly_add != 0) or
+   B - 2*B_terms[j] where poly_corr = A_inv2B[j].
+*/
+void qsieve_update_offsets(qs_t qs_inf, qs_poly_t poly,
+                                        int poly_add, mp_limb_t * poly_corr)
+{
+    slong num_primes = qs_inf->num_primes;
+    mp_limb_t * soln1 = poly->soln1;
+    mp_limb_t * soln2 = poly->soln2;
+    prime_t * factor_base = qs_inf->factor_base;
+    mp_limb_t p, correction;
+    slong pind;
+
+    for (pind = qs_inf->small_primes; pind < num_primes; pind++)
+    {
+        if (soln2[pind] == -1)
+            continue;
+
+        p = factor_base[pind].p;
+        correction = (poly_add ? p - poly_corr[pind] : poly_corr[pind]);
+        soln1[pind] += correction;
+        if (soln1[pind] >= p) soln1[pind] -= p;
+        soln2[pind] += correction;
+        if (soln2[pind] >= p) soln2[pind] -= p;
+    }
+}
@@ -0,0 +1,221 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+#include "fmpz.h"
+
+/*
+   Extend the factor base to num_primes primes. Entry 0 stands for the sign
+   and entry 1 for the prime 2. The odd primes p for which kn is a square
+   modulo p follow, including the primes dividing k. If a prime dividing
+   n is encountered it is returned, otherwise the function returns 0.
+*/
+static mp_limb_t
+compute_factor_base(qs_t qs_inf, slong num_primes)
+{
+    mp_limb_t p, nmod, knmod;
+    slong num = qs_inf->num_primes;
+    slong fb_prime;
+    prime_t * factor_base;
+    n_primes_t iter;
+    int * sqrts;
+
+    if (num == 0)
+    {
+        factor_base = flint_malloc(num_primes*sizeof(prime_t));
+        sqrts = flint_malloc(num_primes*sizeof(int));
+    } else
+    {
+        factor_base = flint_realloc(qs_inf->factor_base,
+                                    num_primes*sizeof(prime_t));
+        sqrts = flint_realloc(qs_inf->sqrts, num_primes*sizeof(int));
+    }
+
+    qs_inf->factor_base = factor_base;
+    qs_inf->sqrts = sqrts;
+
+    if (num == 0)
+    {
+        factor_base[0].p = 1; /* the sign */
+        factor_base[0].pinv = 0;
+        factor_base[0].size = 0;
+        sqrts[0] = 0;
+        factor_base[1].p = 2;
+        factor_base[1].pinv = n_preinvert_limb(2);
+        factor_base[1].size = 1;
+        sqrts[1] = 0;
+        num = 2;
+        p = 2;
+    } else
+        p = factor_base[num - 1].p;
+
+    n_primes_init(iter);
+    n_primes_jump_after(iter, p);
+
+    for (fb_prime = num; fb_prime < num_primes; )
+    {
+        p = n_primes_next(iter);
+
+        nmod = fmpz_fdiv_ui(qs_inf->n, p);
+        if (nmod == 0)
+        {
+            n_primes_clear(iter);
+            qs_inf->num_primes = fb_prime;
+            return p;
+        }
+
+        knmod = n_mulmod2_preinv(nmod, qs_inf->k, p, n_preinvert_limb(p));
+
+        if (knmod == 0 || n_jacobi(knmod, p) == 1)
+        {
+            factor_base[fb_prime].p = p;
+            factor_base[fb_prime].pinv = n_preinvert_limb(p);
+            factor_base[fb_prime].size = FLINT_BIT_COUNT(p);
+            sqrts[fb_prime] = (knmod == 0) ? 0 : n_sqrtmod(knmod, p);
+            fb_prime++;
+        }
+    }
+
+    n_primes_clear(iter);
+    qs_inf->num_primes = num_primes;
+
+    return 0;
+}
+
+mp_limb_t qsieve_primes_init(qs_t qs_inf)
+{
+    slong num_primes, i, s, fact, span;
+    mp_limb_t small_factor, pmax, root;
+    slong bits, lp_bits;
+    fmpz_t temp;
+
+    /* determine which index in the tuning table kn corresponds to */
+    for (i = 1; i < QS_TUNE_SIZE; i++)
+    {
+        if (qsieve_tune[i][0] > qs_inf->bits)
+            break;
+    }
+    i--;
+
+    qs_inf->sieve_size = qsieve_tune[i][4]; /* size of sieve interval */
+    qs_inf->small_primes = qsieve_tune[i][3]; /* number of primes to not sieve with */
+    num_primes = qsieve_tune[i][2]; /* number of factor base primes */
+    qs_inf->qsort_rels = qsieve_tune[i][1]; /* number of relations to accumulate before sorting */
+
+    qs_inf->block_size = FLINT_MIN(CACHE_SIZE, qs_inf->sieve_size);
+
+    qs_inf->num_primes = 0;
+    small_factor = compute_factor_base(qs_inf, num_primes);
+    if (small_factor)
+        return small_factor;
+
+    /* target A = sqrt(2kn)/M where the sieve interval is [-M, M) */
+    fmpz_init(temp);
+    fmpz_mul_2exp(temp, qs_inf->kn, 1);
+    fmpz_sqrt(temp, temp);
+    fmpz_tdiv_q_ui(qs_inf->target_A_mp, temp, qs_inf->sieve_size/2);
+    bits = fmpz_bits(qs_inf->target_A_mp);
+
+    /*
+       Choose the number of prime factors of A so that they have about
+       11 bits, but are not too large for the factor base.
+    */
+    s = FLINT_MAX(bits/11, 1);
+    while (1)
+    {
+        fmpz_root(temp, qs_inf->target_A_mp, s);
+        root = fmpz_get_ui(temp);
+
+        if (!fmpz_abs_fits_ui(temp)
+            || root > qs_inf->factor_base[(3*num_primes)/4].p)
+            s++;
+        else
+            break;
+    }
+
+    /* find a window of primes near the s-th root of target A */
+    while (1)
+    {
+        for (fact = qs_inf->small_primes; fact < num_primes - 1; fact++)
+            if (qs_inf->factor_base[fact].p >= root)
+                break;
+
+        span = FLINT_MAX(4*s, 16);
+        qs_inf->min = FLINT_MAX(fact - span/2, qs_inf->small_primes);
+
+        if (qs_inf->min + span <= num_primes)
+            break;
+
+        /* not enough primes, increase the size of the factor base */
+        num_primes = (slong) (1.1 * (double) num_primes) + 1;
+        small_factor = compute_factor_base(qs_inf, num_primes);
+        if (small_factor)
+        {
+            fmpz_clear(temp);
+            return small_factor;
+        }
+    }
+
+    fmpz_clear(temp);
+
+    qs_inf->s = s;
+    qs_inf->fact = fact;
+    qs_inf->span = span;
+
+    /* large prime bounds, small enough for two large primes to fit a limb */
+    pmax = qs_inf->factor_base[num_primes - 1].p;
+    qs_inf->large_prime = FLINT_MIN(pmax*qsieve_tune[i][5],
+                                    UWORD(1) << (FLINT_BITS/2 - 1));
+
+    if (qsieve_tune[i][6] && qs_inf->large_prime > pmax)
+    {
+        qs_inf->dlp_bound = (qs_inf->large_prime >> 3)*qs_inf->large_prime;
+        lp_bits = FLINT_BIT_COUNT(qs_inf->dlp_bound) - QS_DLP_THRESH_ADJUST;
+    } else
+    {
+        qs_inf->dlp_bound = 0;
+        lp_bits = FLINT_BIT_COUNT(qs_inf->large_prime);
+    }
+
+    /*
+       |Q(x)| is at most M*sqrt(kn/2) on the sieve interval, allow for the
+       large primes and the primes which are not sieved with
+    */
+    qs_inf->sieve_thresh = (qs_inf->bits + 1)/2
+                         + FLINT_BIT_COUNT(qs_inf->sieve_size/2) - 1
+                         - lp_bits - QS_THRESH_ADJUST;
+
+#if QS_DEBUG
+    flint_printf("Using %wd factor base primes, largest %wu\n",
+                 qs_inf->num_primes, pmax);
+    flint_printf("s = %wd, window [%wd, %wd), threshold %wd\n", s,
+                 qs_inf->min, qs_inf->min + span, qs_inf->sieve_thresh);
+#endif
+
+    return 0;
+}
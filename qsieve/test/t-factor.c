@@ -0,0 +1,99 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "qsieve.h"
+
+int main(void)
+{
+   int i, j, result;
+   fmpz_t n, p, f, r;
+   mpz_t t;
+   slong num, bits;
+
+   FLINT_TEST_INIT(state);
+
+   flint_printf("factor....");
+   fflush(stdout);
+
+   fmpz_init(n);
+   fmpz_init(p);
+   fmpz_init(f);
+   fmpz_init(r);
+   mpz_init(t);
+
+   for (i = 0; i < 5 * flint_test_multiplier(); i++) /* products of primes */
+   {
+      num = n_randint(state, 2) + 2;
+      bits = n_randint(state, 120 / num - 15) + 25;
+
+      fmpz_one(n);
+      for (j = 0; j < num; j++)
+      {
+         do {
+            fmpz_randbits(p, state, bits + n_randint(state, 5));
+            fmpz_get_mpz(t, p);
+            mpz_abs(t, t);
+            mpz_nextprime(t, t);
+            fmpz_set_mpz(p, t);
+         } while (fmpz_divisible(n, p));
+
+         fmpz_mul(n, n, p);
+      }
+
+      flint_set_num_threads(n_randint(state, 4) + 1);
+
+      qsieve_factor(f, n);
+
+      fmpz_mod(r, n, f);
+      result = (fmpz_cmp_ui(f, 1) > 0 && fmpz_cmp(f, n) < 0
+                                      && fmpz_is_zero(r));
+      if (!result)
+      {
+         flint_printf("FAIL:\n");
+         flint_printf("n = "); fmpz_print(n); flint_printf("\n");
+         flint_printf("f = "); fmpz_print(f); flint_printf("\n");
+         abort();
+      }
+   }
+
+   flint_set_num_threads(1);
+
+   fmpz_clear(n);
+   fmpz_clear(p);
+   fmpz_clear(f);
+   fmpz_clear(r);
+   mpz_clear(t);
+
+   FLINT_TEST_CLEANUP(state);
+
+   flint_printf("PASS\n");
+   return 0;
+}
@@ -0,0 +1,175 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+static slong num_allocs = 0;
+static slong num_frees = 0;
+
+static void * counting_malloc(size_t size)
+{
+    num_allocs++;
+    return malloc(size);
+}
+
+static void * counting_calloc(size_t num, size_t size)
+{
+    num_allocs++;
+    return calloc(num, size);
+}
+
+static void * counting_realloc(void * ptr, size_t size)
+{
+    if (ptr == NULL)
+        num_allocs++;
+    return realloc(ptr, size);
+}
+
+static void counting_free(void * ptr)
+{
+    if (ptr != NULL)
+        num_frees++;
+    free(ptr);
+}
+
+/* fill blocks at each depth, recurse, then check they are intact */
+static int check_nested(flint_rand_t state, slong depth)
+{
+    mp_ptr a, b;
+    slong i, alen, blen;
+    int result = 1;
+    TMP_INIT;
+
+    if (depth == 0)
+        return 1;
+
+    alen = n_randint(state, 4) == 0 ? n_randint(state, 200000) + 1
+                                     : n_randint(state, 2000) + 1;
+    blen = n_randint(state, 3000) + 1;
+
+    TMP_START;
+
+    a = TMP_ALLOC(alen * sizeof(mp_limb_t));
+    for (i = 0; i < alen; i++)
+        a[i] = depth + i;
+
+    result = check_nested(state, depth - 1);
+
+    b = TMP_ALLOC(blen * sizeof(mp_limb_t));
+    for (i = 0; i < blen; i++)
+        b[i] = depth * i;
+
+    result &= check_nested(state, depth - 1);
+
+    for (i = 0; i < alen; i++)
+        result &= (a[i] == depth + i);
+    for (i = 0; i < blen; i++)
+        result &= (b[i] == depth * i);
+
+    TMP_END;
+
+    return result;
+}
+
+int main(void)
+{
+    int i, result;
+    void *(*alloc_func) (size_t);
+    void *(*calloc_func) (size_t, size_t);
+    void *(*realloc_func) (void *, size_t);
+    void (*free_func) (void *);
+    FLINT_TEST_INIT(state);
+
+    flint_printf("tmp_alloc....");
+    fflush(stdout);
+
+    /* nested temporary allocations of mixed sizes */
+    for (i = 0; i < 200; i++)
+    {
+        result = check_nested(state, n_randint(state, 6) + 1);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("temporary allocation overwritten, i = %d\n", i);
+            abort();
+        }
+    }
+
+    /* user allocator hooks */
+    for (i = 0; i < 100; i++)
+    {
+        void * p, * q, * r;
+
+        __flint_set_memory_functions(counting_malloc, counting_calloc,
+                                     counting_realloc, counting_free);
+
+        num_allocs = num_frees = 0;
+
+        p = flint_malloc(n_randint(state, 1000) + 1);
+        q = flint_calloc(n_randint(state, 100) + 1, sizeof(mp_limb_t));
+        r = flint_realloc(NULL, n_randint(state, 1000) + 1);
+        r = flint_realloc(r, n_randint(state, 1000) + 1);
+        flint_free(p);
+        flint_free(q);
+        flint_free(r);
+
+        __flint_get_memory_functions(&alloc_func, &calloc_func,
+                                     &realloc_func, &free_func);
+
+        result = (num_allocs == 3 && num_frees == 3
+                  && alloc_func == counting_malloc
+                  && calloc_func == counting_calloc
+                  && realloc_func == counting_realloc
+                  && free_func == counting_free);
+
+        __flint_set_memory_functions(NULL, NULL, NULL, NULL);
+
+        __flint_get_memory_functions(&alloc_func, &calloc_func,
+                                     &realloc_func, &free_func);
+
+        result &= (alloc_func != counting_malloc
+                   && calloc_func != counting_calloc
+                   && realloc_func != counting_realloc
+                   && free_func != counting_free);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("num_allocs = %wd, num_frees = %wd\n",
+                         num_allocs, num_frees);
+            abort();
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
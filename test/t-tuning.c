@@ -0,0 +1,280 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fft.h"
+#include "fmpz_poly.h"
+#include "fmpz_mat.h"
+#include "nmod_poly.h"
+
+static int tuning_equal(const flint_tuning_t S, const flint_tuning_t T)
+{
+    slong i;
+
+    for (i = 0; i < 10; i++)
+        if (S->fft_tab[i / 2][i % 2] != T->fft_tab[i / 2][i % 2])
+            return 0;
+
+    if (S->mulmod_num != T->mulmod_num)
+        return 0;
+
+    for (i = 0; i < S->mulmod_num; i++)
+        if (S->mulmod_tab[i] != T->mulmod_tab[i])
+            return 0;
+
+    return S->fft_mulmod_2expp1_cutoff == T->fft_mulmod_2expp1_cutoff
+        && S->fmpz_poly_mul_KS_limbs == T->fmpz_poly_mul_KS_limbs
+        && S->fmpz_poly_mul_KS_len_ratio == T->fmpz_poly_mul_KS_len_ratio
+        && S->fmpz_mat_mul_classical_cutoff
+                                    == T->fmpz_mat_mul_classical_cutoff
+        && S->fmpz_mat_mul_strassen_cutoff == T->fmpz_mat_mul_strassen_cutoff
+        && S->nmod_poly_hgcd_cutoff == T->nmod_poly_hgcd_cutoff
+        && S->nmod_poly_gcd_cutoff == T->nmod_poly_gcd_cutoff
+        && S->nmod_poly_small_gcd_cutoff == T->nmod_poly_small_gcd_cutoff;
+}
+
+static void tuning_randtest(flint_tuning_t T, flint_rand_t state)
+{
+    slong i;
+
+    for (i = 0; i < 10; i++)
+        T->fft_tab[i / 2][i % 2] = n_randint(state, 5);
+
+    T->mulmod_num = n_randint(state, FLINT_TUNING_MULMOD_TAB_MAX) + 1;
+    for (i = 0; i < T->mulmod_num; i++)
+        T->mulmod_tab[i] = n_randint(state, 5);
+    for ( ; i < FLINT_TUNING_MULMOD_TAB_MAX; i++)
+        T->mulmod_tab[i] = T->mulmod_tab[T->mulmod_num - 1];
+
+    T->fft_mulmod_2expp1_cutoff = 2048 / FLINT_BITS + n_randint(state, 200);
+    T->fmpz_poly_mul_KS_limbs = n_randint(state, 20);
+    T->fmpz_poly_mul_KS_len_ratio = n_randint(state, 8);
+    T->fmpz_mat_mul_classical_cutoff = n_randint(state, 30) + 1;
+    T->fmpz_mat_mul_strassen_cutoff = n_randint(state, 100);
+    T->nmod_poly_hgcd_cutoff = n_randint(state, 200) + 2;
+    T->nmod_poly_gcd_cutoff = n_randint(state, 500) + 2;
+    T->nmod_poly_small_gcd_cutoff = n_randint(state, 500) + 2;
+}
+
+/* checks that fread rejects str and leaves T unchanged */
+static int rejects(const char * str, const flint_tuning_t T)
+{
+    FILE * file = tmpfile();
+    flint_tuning_t S;
+    int r;
+
+    fputs(str, file);
+    rewind(file);
+
+    *S = *T;
+    r = !flint_tuning_fread(file, S) && tuning_equal(S, T);
+
+    fclose(file);
+    return r;
+}
+
+int main(void)
+{
+    int i, result;
+    flint_tuning_t D, S, T;
+    FILE * file;
+    char str[200];
+    FLINT_TEST_INIT(state);
+
+    flint_printf("tuning....");
+    fflush(stdout);
+
+    _flint_rand_init_gmp(state);
+
+    flint_tuning_init_default(D);
+
+    /* reading back what is written */
+    for (i = 0; i < 100; i++)
+    {
+        if (i == 0)
+            *T = *D;
+        else
+            tuning_randtest(T, state);
+
+        tuning_randtest(S, state);
+
+        file = tmpfile();
+        result = flint_tuning_fprint(file, T);
+        rewind(file);
+        result = result && flint_tuning_fread(file, S);
+        fclose(file);
+
+        result = result && tuning_equal(S, T);
+
+        if (!result)
+        {
+            flint_printf("FAIL (read back):\n");
+            flint_printf("i = %d\n", i);
+            abort();
+        }
+    }
+
+    /* bad profiles */
+    result = rejects("", D);
+    result &= rejects("fft_tab 1 1 1 1 1 1 1 1 1 1\n", D);
+    result &= rejects("flint_bits 1\n", D);
+    flint_sprintf(str, "flint_bits %d\nfft_tab 1 1 1\n", FLINT_BITS);
+    result &= rejects(str, D);
+    flint_sprintf(str, "flint_bits %d\nmulmod_tab 1 5\n", FLINT_BITS);
+    result &= rejects(str, D);
+    flint_sprintf(str, "flint_bits %d\nnmod_poly_gcd_cutoff 1\n", FLINT_BITS);
+    result &= rejects(str, D);
+    flint_sprintf(str, "flint_bits %d\nnmod_poly_gcd_cutoff\n", FLINT_BITS);
+    result &= rejects(str, D);
+    flint_sprintf(str, "flint_bits %d\nfft_mulmod_2expp1_cutoff 10 x\n",
+                  FLINT_BITS);
+    result &= rejects(str, D);
+
+    if (!result)
+    {
+        flint_printf("FAIL (bad profile accepted)\n");
+        abort();
+    }
+
+    /* unknown parameters are skipped and missing ones kept */
+    file = tmpfile();
+    flint_fprintf(file, "# comment\n\nflint_bits %d\nfuture_cutoff 3\n"
+                  "fmpz_mat_mul_strassen_cutoff 7\n", FLINT_BITS);
+    rewind(file);
+    *S = *D;
+    result = flint_tuning_fread(file, S);
+    fclose(file);
+    *T = *D;
+    T->fmpz_mat_mul_strassen_cutoff = 7;
+    result = result && tuning_equal(S, T);
+
+    /* loading a profile which does not exist changes nothing */
+    result = result && !flint_tuning_load("/nonexistent/flint.tune")
+                    && tuning_equal(flint_get_tuning(), D);
+
+    if (!result)
+    {
+        flint_printf("FAIL (partial profile)\n");
+        abort();
+    }
+
+    /* results do not depend on the tuning */
+    for (i = 0; i < 30 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c, d;
+        fmpz_mat_t A, B, C, E;
+        nmod_poly_t f, g, h, k;
+        mp_ptr x, y, z1, z2;
+        slong m, n, p, n1, n2;
+        mp_limb_t mod;
+
+        tuning_randtest(T, state);
+        flint_set_tuning(T);
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_init(d);
+        m = n_randint(state, 100) + 1;
+        fmpz_poly_randtest(a, state, m, n_randint(state, 600) + 1);
+        fmpz_poly_randtest(b, state, n_randint(state, 100) + 1,
+                           n_randint(state, 600) + 1);
+        fmpz_poly_mul(c, a, b);
+        fmpz_poly_mul_classical(d, a, b);
+        result = fmpz_poly_equal(c, d);
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+        fmpz_poly_clear(d);
+
+        m = n_randint(state, 50) + 1;
+        n = n_randint(state, 50) + 1;
+        p = n_randint(state, 50) + 1;
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(B, n, p);
+        fmpz_mat_init(C, m, p);
+        fmpz_mat_init(E, m, p);
+        fmpz_mat_randtest(A, state, n_randint(state, 100) + 1);
+        fmpz_mat_randtest(B, state, n_randint(state, 100) + 1);
+        fmpz_mat_mul(C, A, B);
+        fmpz_mat_mul_classical(E, A, B);
+        result = result && fmpz_mat_equal(C, E);
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(C);
+        fmpz_mat_clear(E);
+
+        mod = n_randtest_prime(state, 0);
+        nmod_poly_init(f, mod);
+        nmod_poly_init(g, mod);
+        nmod_poly_init(h, mod);
+        nmod_poly_init(k, mod);
+        nmod_poly_randtest(f, state, n_randint(state, 600));
+        nmod_poly_randtest(g, state, n_randint(state, 600));
+        nmod_poly_randtest(h, state, n_randint(state, 100));
+        nmod_poly_mul(f, f, h);
+        nmod_poly_mul(g, g, h);
+        nmod_poly_gcd(h, f, g);
+        nmod_poly_gcd_euclidean(k, f, g);
+        result = result && nmod_poly_equal(h, k);
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+        nmod_poly_clear(h);
+        nmod_poly_clear(k);
+
+        n1 = n_randint(state, i % 10 == 0 ? 20000 : 3000) + 200;
+        n2 = n_randint(state, n1 - 99) + 100;
+        x = flint_malloc((2 * (n1 + n2)) * sizeof(mp_limb_t));
+        y = x + n1;
+        z1 = y + n2;
+        z2 = flint_malloc((n1 + n2) * sizeof(mp_limb_t));
+        flint_mpn_urandomb(x, state->gmp_state, n1 * FLINT_BITS);
+        flint_mpn_urandomb(y, state->gmp_state, n2 * FLINT_BITS);
+        flint_mpn_mul_fft_main(z1, x, n1, y, n2);
+        mpn_mul(z2, x, n1, y, n2);
+        result = result && (mpn_cmp(z1, z2, n1 + n2) == 0);
+        flint_free(x);
+        flint_free(z2);
+
+        if (!result)
+        {
+            flint_printf("FAIL (products):\n");
+            flint_printf("i = %d\n", i);
+            flint_tuning_fprint(stdout, T);
+            abort();
+        }
+    }
+
+    flint_set_tuning(D);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    A task has the same signature as a pthread start routine, so that the
+    existing *_worker functions can be submitted unchanged. The return value
+    is ignored.
+*/
+typedef void * (*thread_pool_task_func_t)(void * arg);
+
+typedef struct thread_pool_job_s
+{
+    thread_pool_task_func_t func;
+    char * args;
+    size_t arg_size;
+    slong num_tasks;
+    slong next;             /* index of the next unclaimed task */
+    slong pending;          /* number of tasks not yet completed */
+    slong helpers;          /* workers currently attached to the job */
+    slong max_helpers;
+    struct thread_pool_job_s * next_job;    /* next job in the queue */
+} thread_pool_job_struct;
+
+typedef struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t wake;    /* signalled when a job is posted or on exit */
+    pthread_cond_t done;    /* signalled when the last task of a job ends */
+    pthread_t * threads;
+    slong size;             /* number of persistent worker threads */
+    slong alloc;
+    int exit;               /* workers should terminate */
+
+    /* jobs with unclaimed tasks, in the order they were submitted */
+    thread_pool_job_struct * head;
+    thread_pool_job_struct * tail;
+} thread_pool_struct;
+
+typedef thread_pool_struct thread_pool_t[1];
+
+/* Memory management *********************************************************/
+
+FLINT_DLL void * _thread_pool_worker(void * arg_ptr);
+
+FLINT_DLL void thread_pool_init(thread_pool_t T, slong size);
+
+FLINT_DLL void thread_pool_clear(thread_pool_t T);
+
+FLINT_DLL void thread_pool_fit_size(thread_pool_t T, slong size);
+
+FLINT_DLL slong thread_pool_get_size(thread_pool_t T);
+
+/* Running tasks *************************************************************/
+
+FLINT_DLL void _thread_pool_work(thread_pool_t T,
+                                            thread_pool_job_struct * job);
+
+FLINT_DLL void thread_pool_run(thread_pool_t T, thread_pool_task_func_t f,
+                  void * args, size_t arg_size, slong n, slong num_threads);
+
+/* Global thread pool ********************************************************/
+
+FLINT_DLL void flint_parallel_do(thread_pool_task_func_t f, void * args,
+                                                  size_t arg_size, slong n);
+
+FLINT_DLL void flint_parallel_cleanup(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
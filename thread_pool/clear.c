@@ -0,0 +1,46 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include "thread_pool.h"
+
+void
+thread_pool_clear(thread_pool_t T)
+{
+    slong i;
+
+    pthread_mutex_lock(&T->mutex);
+    T->exit = 1;
+    pthread_cond_broadcast(&T->wake);
+    pthread_mutex_unlock(&T->mutex);
+
+    for (i = 0; i < T->size; i++)
+        pthread_join(T->threads[i], NULL);
+
+    flint_free(T->threads);
+
+    pthread_cond_destroy(&T->done);
+    pthread_cond_destroy(&T->wake);
+    pthread_mutex_destroy(&T->mutex);
+}
@@ -0,0 +1,50 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include "thread_pool.h"
+
+void
+thread_pool_fit_size(thread_pool_t T, slong size)
+{
+    slong i;
+
+    pthread_mutex_lock(&T->mutex);
+
+    if (size > T->alloc)
+    {
+        T->threads = flint_realloc(T->threads, size * sizeof(pthread_t));
+        T->alloc = size;
+    }
+
+    for (i = T->size; i < size; i++)
+    {
+        if (pthread_create(T->threads + i, NULL, _thread_pool_worker, T) != 0)
+            break;
+    }
+
+    T->size = i;
+
+    pthread_mutex_unlock(&T->mutex);
+}
@@ -0,0 +1,87 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include "thread_pool.h"
+
+/* the first queued job which can take another worker, or NULL */
+static thread_pool_job_struct *
+_thread_pool_find_job(thread_pool_t T)
+{
+    thread_pool_job_struct * job;
+
+    for (job = T->head; job != NULL; job = job->next_job)
+        if (job->helpers < job->max_helpers)
+            return job;
+
+    return NULL;
+}
+
+void *
+_thread_pool_worker(void * arg_ptr)
+{
+    thread_pool_struct * T = (thread_pool_struct *) arg_ptr;
+    thread_pool_job_struct * job;
+
+    pthread_mutex_lock(&T->mutex);
+
+    while (1)
+    {
+        while (!T->exit && (job = _thread_pool_find_job(T)) == NULL)
+            pthread_cond_wait(&T->wake, &T->mutex);
+
+        if (T->exit)
+            break;
+
+        /* the job lives on its owner's stack, which is only unwound once
+           no task is pending and this thread has released the mutex */
+        job->helpers++;
+        _thread_pool_work(T, job);
+        job->helpers--;
+    }
+
+    pthread_mutex_unlock(&T->mutex);
+
+    /* worker threads persist across jobs, so cached data is only
+       released when the thread exits */
+    flint_cleanup();
+    return NULL;
+}
+
+void
+thread_pool_init(thread_pool_t T, slong size)
+{
+    pthread_mutex_init(&T->mutex, NULL);
+    pthread_cond_init(&T->wake, NULL);
+    pthread_cond_init(&T->done, NULL);
+
+    T->threads = NULL;
+    T->size = 0;
+    T->alloc = 0;
+    T->exit = 0;
+    T->head = NULL;
+    T->tail = NULL;
+
+    thread_pool_fit_size(T, size);
+}
@@ -0,0 +1,77 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include "thread_pool.h"
+
+static thread_pool_t _flint_global_pool;
+static int _flint_global_pool_initialised = 0;
+static pthread_mutex_t _flint_global_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void
+flint_parallel_do(thread_pool_task_func_t f, void * args,
+                                                  size_t arg_size, slong n)
+{
+    slong i, num_threads = flint_get_num_threads();
+
+    if (n <= 0)
+        return;
+
+    if (n == 1 || num_threads <= 1)
+    {
+        for (i = 0; i < n; i++)
+            f((char *) args + i * arg_size);
+
+        return;
+    }
+
+    /* the calling thread is one of the num_threads threads */
+    pthread_mutex_lock(&_flint_global_pool_lock);
+
+    if (!_flint_global_pool_initialised)
+    {
+        thread_pool_init(_flint_global_pool, num_threads - 1);
+        _flint_global_pool_initialised = 1;
+    }
+    else
+        thread_pool_fit_size(_flint_global_pool, num_threads - 1);
+
+    pthread_mutex_unlock(&_flint_global_pool_lock);
+
+    thread_pool_run(_flint_global_pool, f, args, arg_size, n, num_threads);
+}
+
+void
+flint_parallel_cleanup(void)
+{
+    pthread_mutex_lock(&_flint_global_pool_lock);
+
+    if (_flint_global_pool_initialised)
+    {
+        thread_pool_clear(_flint_global_pool);
+        _flint_global_pool_initialised = 0;
+    }
+
+    pthread_mutex_unlock(&_flint_global_pool_lock);
+}
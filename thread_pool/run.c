@@ -0,0 +1,122 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include "thread_pool.h"
+
+/*
+    Claims tasks of the given job one at a time until none are left,
+    removing the job from the queue when its last task is claimed. Must be
+    called with the mutex held, which is released while a task runs. Since
+    every thread attached to the job takes the next unclaimed task as soon
+    as it is free, uneven task costs do not leave threads idling until the
+    slowest one of a fixed batch finishes.
+*/
+void
+_thread_pool_work(thread_pool_t T, thread_pool_job_struct * job)
+{
+    thread_pool_job_struct * prev;
+    slong i;
+
+    while (job->next < job->num_tasks)
+    {
+        i = job->next++;
+
+        if (job->next == job->num_tasks)
+        {
+            if (T->head == job)
+            {
+                T->head = job->next_job;
+                prev = NULL;
+            }
+            else
+            {
+                for (prev = T->head; prev->next_job != job; )
+                    prev = prev->next_job;
+                prev->next_job = job->next_job;
+            }
+
+            if (T->tail == job)
+                T->tail = prev;
+        }
+
+        pthread_mutex_unlock(&T->mutex);
+        job->func(job->args + i * job->arg_size);
+        pthread_mutex_lock(&T->mutex);
+
+        if (--job->pending == 0)
+            pthread_cond_broadcast(&T->done);
+    }
+}
+
+void
+thread_pool_run(thread_pool_t T, thread_pool_task_func_t f,
+                  void * args, size_t arg_size, slong n, slong num_threads)
+{
+    thread_pool_job_struct job;
+    slong i;
+
+    if (n <= 0)
+        return;
+
+    pthread_mutex_lock(&T->mutex);
+
+    if (n == 1 || num_threads <= 1 || T->size == 0)
+    {
+        pthread_mutex_unlock(&T->mutex);
+
+        for (i = 0; i < n; i++)
+            f((char *) args + i * arg_size);
+
+        return;
+    }
+
+    job.func = f;
+    job.args = (char *) args;
+    job.arg_size = arg_size;
+    job.num_tasks = n;
+    job.next = 0;
+    job.pending = n;
+    job.helpers = 0;
+    job.max_helpers = FLINT_MIN(num_threads, n) - 1;
+    job.next_job = NULL;
+
+    /* jobs submitted concurrently, or from inside a task, are queued and
+       served by the workers in order */
+    if (T->tail == NULL)
+        T->head = &job;
+    else
+        T->tail->next_job = &job;
+    T->tail = &job;
+
+    pthread_cond_broadcast(&T->wake);
+
+    /* the calling thread takes part in its own job */
+    _thread_pool_work(T, &job);
+
+    while (job.pending != 0)
+        pthread_cond_wait(&T->done, &T->mutex);
+
+    pthread_mutex_unlock(&T->mutex);
+}
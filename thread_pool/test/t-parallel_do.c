@@ -0,0 +1,270 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "thread_pool.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    ulong n;
+    ulong res;
+    slong count;
+    int nested;
+}
+task_arg_t;
+
+void *
+task_worker(void * arg_ptr)
+{
+    task_arg_t * arg = (task_arg_t *) arg_ptr;
+    ulong i, s = 0;
+
+    /* uneven amounts of work per task */
+    for (i = 0; i < arg->n; i++)
+        s += n_nextprime(i * i, 0) % 7;
+
+    if (arg->nested)
+    {
+        task_arg_t inner[3];
+        slong j;
+
+        for (j = 0; j < 3; j++)
+        {
+            inner[j].n = arg->n / 4;
+            inner[j].count = 0;
+            inner[j].nested = 0;
+        }
+
+        flint_parallel_do(task_worker, inner, sizeof(task_arg_t), 3);
+
+        for (j = 0; j < 3; j++)
+            s += inner[j].res + inner[j].count - 1;
+    }
+
+    arg->res = s;
+    arg->count++;
+
+    return NULL;
+}
+
+ulong
+task_expected(ulong n, int nested)
+{
+    ulong i, s = 0;
+
+    for (i = 0; i < n; i++)
+        s += n_nextprime(i * i, 0) % 7;
+
+    if (nested)
+        s += 3 * task_expected(n / 4, 0);
+
+    return s;
+}
+
+typedef struct
+{
+    thread_pool_struct * T;
+    slong seed;
+    int ok;
+}
+submit_arg_t;
+
+/* runs a sequence of jobs on a pool which other threads also use */
+void *
+submit_worker(void * arg_ptr)
+{
+    submit_arg_t * arg = (submit_arg_t *) arg_ptr;
+    task_arg_t args[20];
+    slong i, j, n;
+
+    arg->ok = 1;
+
+    for (i = 0; i < 10; i++)
+    {
+        n = 1 + (arg->seed + 7 * i) % 20;
+
+        for (j = 0; j < n; j++)
+        {
+            args[j].n = (arg->seed * 13 + j * 29) % 150;
+            args[j].count = 0;
+            args[j].nested = (j % 5 == 0);
+        }
+
+        thread_pool_run(arg->T, task_worker, args, sizeof(task_arg_t), n,
+                                                      2 + (arg->seed + i) % 3);
+
+        for (j = 0; j < n; j++)
+            if (args[j].count != 1
+                || args[j].res != task_expected(args[j].n, args[j].nested))
+                arg->ok = 0;
+    }
+
+    flint_cleanup();
+    return NULL;
+}
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("parallel_do....");
+    fflush(stdout);
+
+    /* check every task is run exactly once via the global pool */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        task_arg_t * args;
+        slong j, n;
+        int nested = n_randint(state, 4) == 0;
+
+        flint_set_num_threads(1 + n_randint(state, 5));
+
+        n = n_randint(state, 40);
+        args = flint_malloc(sizeof(task_arg_t) * (n + 1));
+
+        for (j = 0; j < n; j++)
+        {
+            args[j].n = n_randint(state, 200);
+            args[j].count = 0;
+            args[j].nested = nested;
+        }
+
+        flint_parallel_do(task_worker, args, sizeof(task_arg_t), n);
+
+        for (j = 0; j < n; j++)
+        {
+            if (args[j].count != 1
+                || args[j].res != task_expected(args[j].n, nested))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("num_threads = %d, n = %wd, j = %wd\n",
+                    flint_get_num_threads(), n, j);
+                flint_printf("count = %wd, res = %wu\n",
+                    args[j].count, args[j].res);
+                abort();
+            }
+        }
+
+        flint_free(args);
+    }
+
+    /* check a private pool */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        thread_pool_t T;
+        task_arg_t * args;
+        slong j, n, size, num_threads;
+
+        size = n_randint(state, 4);
+        num_threads = 1 + n_randint(state, 6);
+
+        thread_pool_init(T, size);
+
+        if (thread_pool_get_size(T) != size)
+        {
+            flint_printf("FAIL (size):\n");
+            flint_printf("size = %wd, get_size = %wd\n", size,
+                thread_pool_get_size(T));
+            abort();
+        }
+
+        n = n_randint(state, 60);
+        args = flint_malloc(sizeof(task_arg_t) * (n + 1));
+
+        for (j = 0; j < n; j++)
+        {
+            args[j].n = n_randint(state, 100);
+            args[j].count = 0;
+            args[j].nested = 0;
+        }
+
+        thread_pool_run(T, task_worker, args, sizeof(task_arg_t), n,
+                                                              num_threads);
+        thread_pool_run(T, task_worker, args, sizeof(task_arg_t), n,
+                                                              num_threads);
+
+        for (j = 0; j < n; j++)
+        {
+            if (args[j].count != 2
+                || args[j].res != task_expected(args[j].n, 0))
+            {
+                flint_printf("FAIL (private pool):\n");
+                flint_printf("size = %wd, n = %wd, j = %wd\n", size, n, j);
+                flint_printf("count = %wd, res = %wu\n",
+                    args[j].count, args[j].res);
+                abort();
+            }
+        }
+
+        flint_free(args);
+        thread_pool_clear(T);
+    }
+
+    /* check several threads submitting jobs to one pool at once */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        thread_pool_t T;
+        pthread_t threads[4];
+        submit_arg_t sargs[4];
+        slong j;
+
+        thread_pool_init(T, 1 + n_randint(state, 4));
+
+        for (j = 0; j < 4; j++)
+        {
+            sargs[j].T = T;
+            sargs[j].seed = n_randint(state, 1000);
+            pthread_create(threads + j, NULL, submit_worker, sargs + j);
+        }
+
+        for (j = 0; j < 4; j++)
+            pthread_join(threads[j], NULL);
+
+        for (j = 0; j < 4; j++)
+        {
+            if (!sargs[j].ok)
+            {
+                flint_printf("FAIL (concurrent jobs):\n");
+                flint_printf("i = %d, j = %wd, seed = %wd\n", i, j,
+                    sargs[j].seed);
+                abort();
+            }
+        }
+
+        thread_pool_clear(T);
+    }
+
+    flint_parallel_cleanup();
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,313 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#define ulong ulongxx /* interferes with system includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "fft_tuning.h"
+#include "fmpz_poly.h"
+#include "fmpz_mat.h"
+#include "nmod_poly.h"
+
+/*
+   The table starts out with the compiled in defaults. On first use the
+   profile named by the environment variable FLINT_TUNING_FILE is loaded,
+   if there is one. Both happen once, under pthread_once, so that threads
+   calling flint_get_tuning for the first time at the same moment all see
+   the finished table.
+*/
+
+static pthread_once_t _flint_tuning_once = PTHREAD_ONCE_INIT;
+static flint_tuning_struct _flint_tuning;
+
+#define TUNING_MAX_LINE 1024
+
+void flint_tuning_init_default(flint_tuning_t T)
+{
+    int fft_tab[5][2] = FFT_TAB;
+    int mulmod_tab[FFT_N_NUM] = MULMOD_TAB;
+    slong i;
+
+    memcpy(T->fft_tab, fft_tab, sizeof(fft_tab));
+
+    for (i = 0; i < FFT_N_NUM; i++)
+        T->mulmod_tab[i] = mulmod_tab[i];
+    for ( ; i < FLINT_TUNING_MULMOD_TAB_MAX; i++)
+        T->mulmod_tab[i] = mulmod_tab[FFT_N_NUM - 1];
+    T->mulmod_num = FFT_N_NUM;
+
+    T->fft_mulmod_2expp1_cutoff = FFT_MULMOD_2EXPP1_CUTOFF;
+    T->fmpz_poly_mul_KS_limbs = FMPZ_POLY_MUL_KS_LIMBS;
+    T->fmpz_poly_mul_KS_len_ratio = FMPZ_POLY_MUL_KS_LEN_RATIO;
+    T->fmpz_mat_mul_classical_cutoff = FMPZ_MAT_MUL_CLASSICAL_CUTOFF;
+    T->fmpz_mat_mul_strassen_cutoff = FMPZ_MAT_MUL_STRASSEN_CUTOFF;
+    T->nmod_poly_hgcd_cutoff = NMOD_POLY_HGCD_CUTOFF;
+    T->nmod_poly_gcd_cutoff = NMOD_POLY_GCD_CUTOFF;
+    T->nmod_poly_small_gcd_cutoff = NMOD_POLY_SMALL_GCD_CUTOFF;
+}
+
+static int _flint_tuning_read_file(flint_tuning_t T, const char * filename);
+
+static void _flint_tuning_startup(void)
+{
+    const char * filename;
+
+    flint_tuning_init_default(&_flint_tuning);
+
+    filename = getenv("FLINT_TUNING_FILE");
+    if (filename != NULL && filename[0] != '\0')
+        _flint_tuning_read_file(&_flint_tuning, filename);
+}
+
+const flint_tuning_struct * flint_get_tuning(void)
+{
+    pthread_once(&_flint_tuning_once, _flint_tuning_startup);
+
+    return &_flint_tuning;
+}
+
+/*
+   Not synchronised with readers: the caller must make sure no other thread
+   is using FLINT while the table changes.
+*/
+void flint_set_tuning(const flint_tuning_t T)
+{
+    pthread_once(&_flint_tuning_once, _flint_tuning_startup);
+
+    _flint_tuning = *T;
+}
+
+/* the table of scalar parameters, in the order they are written */
+static const char * _tuning_names[] = {
+    "fft_mulmod_2expp1_cutoff",
+    "fmpz_poly_mul_KS_limbs",
+    "fmpz_poly_mul_KS_len_ratio",
+    "fmpz_mat_mul_classical_cutoff",
+    "fmpz_mat_mul_strassen_cutoff",
+    "nmod_poly_hgcd_cutoff",
+    "nmod_poly_gcd_cutoff",
+    "nmod_poly_small_gcd_cutoff"
+};
+
+#define TUNING_NUM_SCALARS 8
+
+static slong * _tuning_scalar(flint_tuning_t T, slong i)
+{
+    switch (i)
+    {
+        case 0: return &T->fft_mulmod_2expp1_cutoff;
+        case 1: return &T->fmpz_poly_mul_KS_limbs;
+        case 2: return &T->fmpz_poly_mul_KS_len_ratio;
+        case 3: return &T->fmpz_mat_mul_classical_cutoff;
+        case 4: return &T->fmpz_mat_mul_strassen_cutoff;
+        case 5: return &T->nmod_poly_hgcd_cutoff;
+        case 6: return &T->nmod_poly_gcd_cutoff;
+        default: return &T->nmod_poly_small_gcd_cutoff;
+    }
+}
+
+/* smallest value of each scalar for which the dispatch code is correct */
+static const slong _tuning_min[] = {
+    2048 / FLINT_BITS, 0, 0, 1, 0, 2, 2, 2
+};
+
+int flint_tuning_fprint(FILE * file, const flint_tuning_t T)
+{
+    slong i;
+    int r;
+
+    r = fprintf(file, "# FLINT tuning profile\n");
+    r = (r > 0) && fprintf(file, "flint_bits %d\n", FLINT_BITS) > 0;
+
+    r = r && fprintf(file, "fft_tab") > 0;
+    for (i = 0; i < 10; i++)
+        r = r && fprintf(file, " %d", T->fft_tab[i / 2][i % 2]) > 0;
+
+    r = r && fprintf(file, "\nmulmod_tab") > 0;
+    for (i = 0; i < T->mulmod_num; i++)
+        r = r && fprintf(file, " %d", T->mulmod_tab[i]) > 0;
+    r = r && fprintf(file, "\n") > 0;
+
+    for (i = 0; i < TUNING_NUM_SCALARS; i++)
+        r = r && flint_fprintf(file, "%s %wd\n", _tuning_names[i],
+                         *_tuning_scalar((flint_tuning_struct *) T, i)) > 0;
+
+    return r;
+}
+
+/*
+   Reads whitespace separated integers from str into vals, returning the
+   number read, or -1 if there is anything else on the line.
+*/
+static slong _tuning_parse_ints(slong * vals, slong max, const char * str)
+{
+    slong num = 0;
+    char * end;
+
+    while (1)
+    {
+        while (*str == ' ' || *str == '\t' || *str == '\r' || *str == '\n')
+            str++;
+
+        if (*str == '\0')
+            return num;
+
+        if (num == max)
+            return -1;
+
+        vals[num] = strtol(str, &end, 10);
+        if (end == str)
+            return -1;
+
+        num++;
+        str = end;
+    }
+}
+
+int flint_tuning_fread(FILE * file, flint_tuning_t T)
+{
+    char line[TUNING_MAX_LINE], key[TUNING_MAX_LINE];
+    slong vals[FLINT_TUNING_MULMOD_TAB_MAX], num, i;
+    int bits_seen = 0, len;
+    flint_tuning_t S;
+
+    /* parameters missing from the profile keep their current values */
+    *S = *T;
+
+    while (fgets(line, TUNING_MAX_LINE, file) != NULL)
+    {
+        if (strchr(line, '\n') == NULL && !feof(file))
+            return 0;
+
+        if (sscanf(line, " %s%n", key, &len) != 1 || key[0] == '#')
+            continue;
+
+        num = _tuning_parse_ints(vals, FLINT_TUNING_MULMOD_TAB_MAX,
+                                 line + len);
+        if (num <= 0)
+            return 0;
+
+        if (strcmp(key, "flint_bits") == 0)
+        {
+            if (num != 1 || vals[0] != FLINT_BITS)
+                return 0;
+            bits_seen = 1;
+        }
+        else if (strcmp(key, "fft_tab") == 0)
+        {
+            if (num != 10)
+                return 0;
+            for (i = 0; i < 10; i++)
+            {
+                if (vals[i] < 0 || vals[i] > 4)
+                    return 0;
+                S->fft_tab[i / 2][i % 2] = vals[i];
+            }
+        }
+        else if (strcmp(key, "mulmod_tab") == 0)
+        {
+            for (i = 0; i < num; i++)
+            {
+                if (vals[i] < 0 || vals[i] > 4)
+                    return 0;
+                S->mulmod_tab[i] = vals[i];
+            }
+            for ( ; i < FLINT_TUNING_MULMOD_TAB_MAX; i++)
+                S->mulmod_tab[i] = vals[num - 1];
+            S->mulmod_num = num;
+        }
+        else
+        {
+            for (i = 0; i < TUNING_NUM_SCALARS; i++)
+                if (strcmp(key, _tuning_names[i]) == 0)
+                    break;
+
+            /* unknown parameters are skipped */
+            if (i == TUNING_NUM_SCALARS)
+                continue;
+
+            if (num != 1 || vals[0] < _tuning_min[i])
+                return 0;
+            *_tuning_scalar(S, i) = vals[0];
+        }
+    }
+
+    if (ferror(file) || !bits_seen)
+        return 0;
+
+    *T = *S;
+    return 1;
+}
+
+/* reads the profile into T, which is unchanged if it cannot be read */
+static int _flint_tuning_read_file(flint_tuning_t T, const char * filename)
+{
+    FILE * file;
+    int r;
+
+    file = fopen(filename, "r");
+    if (file == NULL)
+        return 0;
+
+    r = flint_tuning_fread(file, T);
+    fclose(file);
+
+    return r;
+}
+
+int flint_tuning_load(const char * filename)
+{
+    flint_tuning_t T;
+
+    *T = *flint_get_tuning();
+
+    if (!_flint_tuning_read_file(T, filename))
+        return 0;
+
+    flint_set_tuning(T);
+
+    return 1;
+}
+
+int flint_tuning_save(const char * filename)
+{
+    FILE * file;
+    int r;
+
+    file = fopen(filename, "w");
+    if (file == NULL)
+        return 0;
+
+    r = flint_tuning_fprint(file, flint_get_tuning());
+
+    return (fclose(file) == 0) && r;
+}
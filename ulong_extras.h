@@ -51,6 +51,7 @@ typedef struct {
 
 #define FLINT_ODDPRIME_SMALL_CUTOFF 4096
 #define FLINT_NUM_PRIMES_SMALL 172
+#define FLINT_NUM_PRIMES_BASE 6543
 #define FLINT_PRIMES_SMALL_CUTOFF 1030
 #define FLINT_PSEUDOSQUARES_CUTOFF 1000
 
@@ -64,11 +65,23 @@ typedef struct {
 #define FLINT_FACTOR_SQUFOF_ITERS 50000
 #define FLINT_FACTOR_ONE_LINE_MAX (UWORD(1)<<39)
 #define FLINT_FACTOR_ONE_LINE_ITERS 40000
+#define FLINT_FACTOR_POLLARD_BRENT_MAX_BITS 50
+#define FLINT_FACTOR_POLLARD_BRENT_TRIES 10
+#define FLINT_FACTOR_POLLARD_BRENT_ITERS (UWORD(1)<<20)
+#define FLINT_FACTOR_POLLARD_BRENT_SHORT_ITERS 1024
+#define FLINT_FACTOR_ECM_CURVES 1000
+#define FLINT_FACTOR_ECM_B1 150
+#define FLINT_FACTOR_ECM_B2 7500
 
 #define FLINT_PRIME_PI_ODD_LOOKUP_CUTOFF 311
+#define FLINT_PRIME_PI_LMO_CUTOFF (UWORD(1) << 22)
+#define FLINT_NTH_PRIME_LMO_CUTOFF (UWORD(1) << 18)
 
 #define FLINT_SIEVE_SIZE 65536
 
+/* largest subgroup orders (in bits) for which discrete logs use BSGS */
+#define FLINT_DISCRETE_LOG_BSGS_BITS 36
+
 #if FLINT64
 #define UWORD_MAX_PRIME UWORD(18446744073709551557)
 #else
@@ -91,6 +104,45 @@ n_primes_struct;
 
 typedef n_primes_struct n_primes_t[1];
 
+/*
+    Precomputed data for discrete logarithms modulo a prime p by the
+    Pohlig-Hellman method, with respect to the primitive root g. For each
+    prime power q^e exactly dividing p - 1 it holds gamma = g^((p - 1) / q)
+    of order q, alphainv = g^(-(p - 1) / q^e) and the CRT idempotent idem
+    which is 1 mod q^e and 0 mod (p - 1) / q^e. If m != 0 logarithms in
+    the subgroup of order q are found by baby-step giant-step, with the
+    pairs (gamma^j, j) for 0 <= j < m sorted in table and giant =
+    gamma^(-m), otherwise by Pollard rho.
+*/
+typedef struct
+{
+    mp_limb_t q;
+    int e;
+    mp_limb_t cofactor;
+    mp_limb_t idem;
+    mp_limb_t gamma;
+    mp_limb_t alphainv;
+    mp_limb_t giant;
+    mp_limb_t m;
+    n_pair_t * table;
+}
+n_discrete_log_ph_entry_struct;
+
+typedef struct
+{
+    mp_limb_t p;
+    mp_limb_t pinv;
+    mp_limb_t pm1inv;
+    mp_limb_t g;
+    slong num;
+    n_discrete_log_ph_entry_struct entries[FLINT_MAX_FACTORS_IN_LIMB];
+}
+n_discrete_log_ph_struct;
+
+typedef n_discrete_log_ph_struct n_discrete_log_ph_t[1];
+
+FLINT_DLL const unsigned int * n_primes_base(void);
+
 FLINT_DLL void n_primes_init(n_primes_t iter);
 
 FLINT_DLL void n_primes_clear(n_primes_t iter);
@@ -101,6 +153,8 @@ FLINT_DLL void n_primes_sieve_range(n_primes_t iter, mp_limb_t a, mp_limb_t b);
 
 FLINT_DLL void n_primes_jump_after(n_primes_t iter, mp_limb_t n);
 
+FLINT_DLL slong n_primes_range(mp_limb_t ** primes, mp_limb_t a, mp_limb_t b);
+
 static __inline__ mp_limb_t
 n_primes_next(n_primes_t iter)
 {
@@ -244,6 +298,50 @@ mp_limb_t n_negmod(mp_limb_t x, mp_limb_t n)
     return n_submod(0, x, n);
 }
 
+/*
+   Montgomery arithmetic for odd n: residues are stored as a*2^FLINT_BITS
+   mod n and ninv = n^(-1) mod 2^FLINT_BITS
+*/
+
+static __inline__
+mp_limb_t n_mont_inverse(mp_limb_t n)
+{
+    mp_limb_t ninv = n; /* correct to 3 bits as n*n = 1 mod 8 */
+    int i;
+
+    for (i = 3; i < FLINT_BITS; i *= 2)
+        ninv *= 2 - n*ninv;
+
+    return ninv;
+}
+
+static __inline__
+mp_limb_t n_mont_mulmod(mp_limb_t a, mp_limb_t b, mp_limb_t n, mp_limb_t ninv)
+{
+    mp_limb_t hi, lo, mh, ml;
+
+    umul_ppmm(hi, lo, a, b);
+    umul_ppmm(mh, ml, lo*ninv, n);
+
+    return (hi >= mh) ? hi - mh : hi - mh + n;
+}
+
+static __inline__
+mp_limb_t n_mont_redc(mp_limb_t a, mp_limb_t n, mp_limb_t ninv)
+{
+    mp_limb_t mh, ml;
+
+    umul_ppmm(mh, ml, a*ninv, n);
+
+    return (mh == 0) ? 0 : n - mh;
+}
+
+static __inline__
+mp_limb_t n_mont_set(mp_limb_t a, mp_limb_t n, mp_limb_t npre)
+{
+    return n_ll_mod_preinv(a, 0, n, npre);
+}
+
 FLINT_DLL mp_limb_t n_sqrtmod(mp_limb_t a, mp_limb_t p);
 
 FLINT_DLL slong n_sqrtmod_2pow(mp_limb_t ** sqrt, mp_limb_t a, slong exp); 
@@ -303,12 +401,18 @@ FLINT_DLL int n_is_prime_pocklington(mp_limb_t n, ulong iterations);
 
 FLINT_DLL int n_is_prime(mp_limb_t n);
 
+FLINT_DLL void _n_is_prime_vec(int * res, mp_srcptr v, slong len);
+
+FLINT_DLL void n_is_prime_vec(int * res, mp_srcptr v, slong len);
+
 FLINT_DLL mp_limb_t n_nth_prime(ulong n);
 
 FLINT_DLL void n_nth_prime_bounds(mp_limb_t *lo, mp_limb_t *hi, ulong n);
 
 FLINT_DLL ulong n_prime_pi(mp_limb_t n);
 
+FLINT_DLL ulong n_prime_pi_lmo(mp_limb_t n);
+
 FLINT_DLL void n_prime_pi_bounds(ulong *lo, ulong *hi, mp_limb_t n);
 
 FLINT_DLL int n_remove(mp_limb_t * n, mp_limb_t p);
@@ -347,6 +451,21 @@ FLINT_DLL void n_factor(n_factor_t * factors, mp_limb_t n, int proved);
 
 FLINT_DLL mp_limb_t n_factor_pp1(mp_limb_t n, ulong B1, ulong c);
 
+FLINT_DLL int n_factor_pollard_brent_single(mp_limb_t * f, mp_limb_t n,
+            mp_limb_t ninv, mp_limb_t a, mp_limb_t x0, ulong max_iters);
+
+FLINT_DLL int n_factor_pollard_brent(mp_limb_t * f, flint_rand_t state,
+                            mp_limb_t n, ulong max_tries, ulong max_iters);
+
+FLINT_DLL mp_limb_t * _n_factor_ecm_stage1_table(slong * len, ulong B1);
+
+FLINT_DLL unsigned char * _n_factor_ecm_stage2_table(slong * num_g,
+                      ulong * g0, ulong * D, slong * num_j, ulong ** j_arr,
+                                                       ulong B1, ulong B2);
+
+FLINT_DLL int n_factor_ecm(mp_limb_t * f, ulong curves, ulong B1, ulong B2,
+                                           flint_rand_t state, mp_limb_t n);
+
 FLINT_DLL int n_is_squarefree(mp_limb_t n);
 
 FLINT_DLL int n_moebius_mu(mp_limb_t n);
@@ -369,6 +488,21 @@ FLINT_DLL mp_limb_t n_primitive_root_prime(mp_limb_t p);
 
 FLINT_DLL mp_limb_t n_discrete_log_bsgs(mp_limb_t b, mp_limb_t a, mp_limb_t n);
 
+FLINT_DLL void n_discrete_log_ph_init(n_discrete_log_ph_t L, mp_limb_t p);
+
+FLINT_DLL void n_discrete_log_ph_clear(n_discrete_log_ph_t L);
+
+static __inline__
+mp_limb_t n_discrete_log_ph_primitive_root(const n_discrete_log_ph_t L)
+{
+    return L->g;
+}
+
+FLINT_DLL mp_limb_t n_discrete_log_ph_run(const n_discrete_log_ph_t L,
+                                                               mp_limb_t b);
+
+FLINT_DLL mp_limb_t n_discrete_log_ph(mp_limb_t b, mp_limb_t a, mp_limb_t p);
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,46 +25,119 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <math.h>
 
 #include "flint.h"
 #include "ulong_extras.h"
+#include "nmod_mont.h"
 
+static int
+_n_pair_cmp(const void * a, const void * b)
+{
+    const n_pair_t * x = (const n_pair_t *) a;
+    const n_pair_t * y = (const n_pair_t *) b;
+
+    if (x->x != y->x)
+        return (x->x < y->x) ? -1 : 1;
+
+    return (x->y < y->y) ? -1 : (x->y > y->y);
+}
+
+/* the first index i with table[i].x >= c */
+static mp_limb_t
+_n_pair_lower_bound(const n_pair_t * table, mp_limb_t m, mp_limb_t c)
+{
+    mp_limb_t lo = 0, hi = m, mid;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+
+        if (table[mid].x < c)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+/*
+    The baby steps a^j, 0 <= j < m, are sorted with their indices so that
+    each giant step costs a binary search. Sorting ties by index means the
+    smallest logarithm is returned, as with a linear scan. Odd moduli use
+    Montgomery arithmetic, with the table holding canonical values.
+*/
 mp_limb_t n_discrete_log_bsgs(mp_limb_t b, mp_limb_t a, mp_limb_t n)
 {
-    int i, j;
-    double ninv;
-    mp_limb_t m, a_m, c;
-    mp_limb_t * table;
+    mp_limb_t i, j, m, a_m, c, x, ninv = 0;
+    n_pair_t * table;
+    nmod_mont_t ctx;
+    int mont;
+
+    if (n == 1)
+        return 0;
+
+    a = a % n;
+    b = b % n;
 
-    ninv = n_precompute_inverse(n);
+    m = n_sqrt(n);
+    if (m * m < n)
+        m++;
 
-    m = ceil(sqrt((double) n));
+    mont = (n & 1) && FLINT_BIT_COUNT(n) <= NMOD_MONT_MAX_BITS;
 
-    table = (mp_limb_t*)flint_malloc(m * sizeof(mp_limb_t));
+    table = (n_pair_t *) flint_malloc(m * sizeof(n_pair_t));
 
-    table[0] = 1;
-    for (j = 1; j < m; j++)
+    if (mont)
     {
-        table[j] = n_mulmod_precomp(table[j-1], a, n, ninv);
+        nmod_mont_init(ctx, n);
+
+        x = nmod_mont_set_ui(a, ctx);
+        c = ctx->one;
+        for (j = 0; j < m; j++)
+        {
+            table[j].x = nmod_mont_canonical(c, ctx);
+            table[j].y = j;
+            c = nmod_mont_mul(c, x, ctx);
+        }
+
+        a_m = nmod_mont_pow_ui(nmod_mont_set_ui(n_invmod(a, n), ctx), m, ctx);
+        c = nmod_mont_set_ui(b, ctx);
     }
+    else
+    {
+        ninv = n_preinvert_limb(n);
+
+        c = UWORD(1);
+        for (j = 0; j < m; j++)
+        {
+            table[j].x = c;
+            table[j].y = j;
+            c = n_mulmod2_preinv(c, a, n, ninv);
+        }
 
-    a_m = n_invmod(a, n);
-    a_m = n_powmod_precomp(a_m, m, n, ninv);
+        a_m = n_powmod2_preinv(n_invmod(a, n), m, n, ninv);
+        c = b;
+    }
 
-    c = b;
+    qsort(table, m, sizeof(n_pair_t), _n_pair_cmp);
 
     for (i = 0; i < m; i++)
     {
-        for (j = 0; j < m; j++)
+        x = mont ? nmod_mont_canonical(c, ctx) : c;
+
+        j = _n_pair_lower_bound(table, m, x);
+        if (j < m && table[j].x == x)
         {
-            if (c == table[j])
-            {
-                flint_free(table);
-                return i * m + j;
-            }
+            x = i * m + table[j].y;
+            flint_free(table);
+            return x;
         }
-        c = n_mulmod_precomp(c, a_m, n, ninv);
+
+        if (mont)
+            c = nmod_mont_mul(c, a_m, ctx);
+        else
+            c = n_mulmod2_preinv(c, a_m, n, ninv);
     }
 
     flint_free(table);
@@ -0,0 +1,64 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+    With g the primitive root of the precomputed data, a^x = b exactly
+    when log_g(a) x = log_g(b) mod p - 1.
+*/
+mp_limb_t n_discrete_log_ph(mp_limb_t b, mp_limb_t a, mp_limb_t p)
+{
+    n_discrete_log_ph_t L;
+    mp_limb_t la, lb, n, d, x;
+
+    n_discrete_log_ph_init(L, p);
+    la = n_discrete_log_ph_run(L, a);
+    lb = n_discrete_log_ph_run(L, b);
+    n_discrete_log_ph_clear(L);
+
+    n = p - 1;
+    d = n_gcd(n, la);
+
+    if (lb % d != 0)
+    {
+        flint_printf("Exception (n_discrete_log_ph).  "
+                     "discrete log not found.\n");
+        abort();
+    }
+
+    n /= d;
+
+    if (n == 1)
+        return 0;
+
+    x = n_invmod((la / d) % n, n);
+    x = n_mulmod2_preinv(lb / d, x, n, n_preinvert_limb(n));
+
+    return x;
+}
@@ -0,0 +1,110 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+static int
+_n_pair_cmp(const void * a, const void * b)
+{
+    const n_pair_t * x = (const n_pair_t *) a;
+    const n_pair_t * y = (const n_pair_t *) b;
+
+    return (x->x < y->x) ? -1 : (x->x > y->x);
+}
+
+void n_discrete_log_ph_init(n_discrete_log_ph_t L, mp_limb_t p)
+{
+    n_discrete_log_ph_entry_struct * E;
+    n_factor_t fac;
+    mp_limb_t qe, ginv, gammainv, c, j;
+    slong i;
+
+    L->p = p;
+    L->pinv = n_preinvert_limb(p);
+    L->num = 0;
+
+    if (p == 2)
+    {
+        L->pm1inv = 0;
+        L->g = 1;
+        return;
+    }
+
+    L->pm1inv = n_preinvert_limb(p - 1);
+
+    n_factor_init(&fac);
+    n_factor(&fac, p - 1, 1);
+
+    L->g = n_primitive_root_prime_prefactor(p, &fac);
+    ginv = n_invmod(L->g, p);
+
+    L->num = fac.num;
+
+    for (i = 0; i < fac.num; i++)
+    {
+        E = L->entries + i;
+
+        E->q = fac.p[i];
+        E->e = fac.exp[i];
+
+        qe = n_pow(E->q, E->e);
+        E->cofactor = (p - 1) / qe;
+        E->idem = E->cofactor * n_invmod(E->cofactor % qe, qe);
+
+        E->gamma = n_powmod2_preinv(L->g, (p - 1) / E->q, p, L->pinv);
+        E->alphainv = n_powmod2_preinv(ginv, E->cofactor, p, L->pinv);
+
+        if (FLINT_BIT_COUNT(E->q) <= FLINT_DISCRETE_LOG_BSGS_BITS)
+        {
+            E->m = n_sqrt(E->q);
+            if (E->m * E->m < E->q)
+                E->m++;
+
+            E->table = (n_pair_t *) flint_malloc(E->m * sizeof(n_pair_t));
+
+            c = UWORD(1);
+            for (j = 0; j < E->m; j++)
+            {
+                E->table[j].x = c;
+                E->table[j].y = j;
+                c = n_mulmod2_preinv(c, E->gamma, p, L->pinv);
+            }
+
+            qsort(E->table, E->m, sizeof(n_pair_t), _n_pair_cmp);
+
+            gammainv = n_invmod(E->gamma, p);
+            E->giant = n_powmod2_preinv(gammainv, E->m, p, L->pinv);
+        }
+        else
+        {
+            E->m = 0;
+            E->table = NULL;
+            E->giant = 0;
+        }
+    }
+}
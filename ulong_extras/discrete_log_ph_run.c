@@ -0,0 +1,174 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+static __inline__ void
+_n_discrete_log_rho_step(mp_limb_t * x, mp_limb_t * a, mp_limb_t * b,
+                  mp_limb_t gamma, mp_limb_t h, mp_limb_t q,
+                  mp_limb_t p, mp_limb_t pinv)
+{
+    switch (*x % 3)
+    {
+        case 0:
+            *x = n_mulmod2_preinv(*x, *x, p, pinv);
+            *a = n_addmod(*a, *a, q);
+            *b = n_addmod(*b, *b, q);
+            break;
+        case 1:
+            *x = n_mulmod2_preinv(*x, gamma, p, pinv);
+            *a = n_addmod(*a, 1, q);
+            break;
+        default:
+            *x = n_mulmod2_preinv(*x, h, p, pinv);
+            *b = n_addmod(*b, 1, q);
+    }
+}
+
+/*
+    Pollard rho with Floyd's cycle finding on the walk x = gamma^a h^b. A
+    collision gives h^(b - B) = gamma^(A - a), which determines the log
+    since q is prime, unless b = B, in which case the walk is restarted
+    from a different point.
+*/
+static mp_limb_t
+_n_discrete_log_rho(mp_limb_t h, mp_limb_t gamma, mp_limb_t q,
+                                              mp_limb_t p, mp_limb_t pinv)
+{
+    mp_limb_t x, a, b, X, A, B, start;
+
+    if (h == 1)
+        return 0;
+
+    for (start = 1; ; start++)
+    {
+        a = A = start;
+        b = B = 0;
+        x = X = n_powmod2_preinv(gamma, start, p, pinv);
+
+        do
+        {
+            _n_discrete_log_rho_step(&x, &a, &b, gamma, h, q, p, pinv);
+            _n_discrete_log_rho_step(&X, &A, &B, gamma, h, q, p, pinv);
+            _n_discrete_log_rho_step(&X, &A, &B, gamma, h, q, p, pinv);
+        } while (x != X);
+
+        if (b != B)
+            return n_mulmod2_preinv(n_submod(A, a, q),
+                        n_invmod(n_submod(b, B, q), q), q, n_preinvert_limb(q));
+    }
+}
+
+/* log of h, an element of the subgroup of order q, with respect to gamma */
+static mp_limb_t
+_n_discrete_log_ph_subgroup(mp_limb_t h,
+         const n_discrete_log_ph_entry_struct * E, mp_limb_t p, mp_limb_t pinv)
+{
+    mp_limb_t i, lo, hi, mid;
+
+    if (E->m == 0)
+        return _n_discrete_log_rho(h, E->gamma, E->q, p, pinv);
+
+    for (i = 0; i < E->m; i++)
+    {
+        lo = 0;
+        hi = E->m;
+
+        while (lo < hi)
+        {
+            mid = lo + (hi - lo) / 2;
+
+            if (E->table[mid].x < h)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        if (lo < E->m && E->table[lo].x == h)
+            return i * E->m + E->table[lo].y;
+
+        h = n_mulmod2_preinv(h, E->giant, p, pinv);
+    }
+
+    flint_printf("Exception (n_discrete_log_ph_run).  "
+                 "discrete log not found.\n");
+    abort();
+}
+
+mp_limb_t n_discrete_log_ph_run(const n_discrete_log_ph_t L, mp_limb_t b)
+{
+    const n_discrete_log_ph_entry_struct * E;
+    mp_limb_t p = L->p, pinv = L->pinv;
+    mp_limb_t x, xq, qk, beta, ainv, h, d;
+    slong i;
+    int k;
+
+    b = n_mod2_preinv(b, p, pinv);
+
+    if (b == 0)
+    {
+        flint_printf("Exception (n_discrete_log_ph_run).  b is zero.\n");
+        abort();
+    }
+
+    x = 0;
+
+    for (i = 0; i < L->num; i++)
+    {
+        E = L->entries + i;
+
+        /* find the log of b^cofactor to base g^cofactor one digit at a time */
+        beta = n_powmod2_preinv(b, E->cofactor, p, pinv);
+        ainv = E->alphainv;
+        xq = 0;
+        qk = 1;
+
+        for (k = 0; k < E->e; k++)
+        {
+            h = n_powmod2_preinv(beta, n_pow(E->q, E->e - 1 - k), p, pinv);
+            d = _n_discrete_log_ph_subgroup(h, E, p, pinv);
+
+            if (d != 0)
+            {
+                beta = n_mulmod2_preinv(beta,
+                                n_powmod2_preinv(ainv, d, p, pinv), p, pinv);
+                xq += d * qk;
+            }
+
+            qk *= E->q;
+
+            if (k + 1 < E->e)
+                ainv = n_powmod2_preinv(ainv, E->q, p, pinv);
+        }
+
+        x = n_addmod(x, n_mulmod2_preinv(xq, E->idem, p - 1, L->pm1inv),
+                                                                     p - 1);
+    }
+
+    return x;
+}
@@ -44,6 +44,8 @@ void n_factor(n_factor_t * factors, mp_limb_t n, int proved)
    ulong factors_left;
    ulong exp;
    mp_limb_t cofactor, factor, cutoff;
+   ulong rho_tries, rho_iters;
+   flint_rand_t state;
 
    cofactor = n_factor_trial(factors, n, FLINT_FACTOR_TRIAL_PRIMES);
    if (cofactor == UWORD(1)) return;
@@ -59,6 +61,8 @@ void n_factor(n_factor_t * factors, mp_limb_t n, int proved)
 
    cutoff = FLINT_FACTOR_TRIAL_CUTOFF;
 
+   flint_randinit(state);
+
    while (factors_left > 0)
    {
       factor = factor_arr[factors_left - 1];
@@ -73,11 +77,30 @@ void n_factor(n_factor_t * factors, mp_limb_t n, int proved)
            
          if ((factor >= cutoff) && !is_prime(factor, proved))
          {
+            /*
+               below FLINT_FACTOR_POLLARD_BRENT_MAX_BITS bits rho beats ECM,
+               above that a short run only picks off factors of up to about
+               24 bits before ECM is tried
+            */
+            if (FLINT_BIT_COUNT(factor) < FLINT_FACTOR_POLLARD_BRENT_MAX_BITS)
+            {
+               rho_tries = FLINT_FACTOR_POLLARD_BRENT_TRIES;
+               rho_iters = FLINT_FACTOR_POLLARD_BRENT_ITERS;
+            } else
+            {
+               rho_tries = 1;
+               rho_iters = FLINT_FACTOR_POLLARD_BRENT_SHORT_ITERS;
+            }
+
 	    if ((
 #if FLINT64
                  (factor < FLINT_FACTOR_ONE_LINE_MAX) &&
 #endif
                  (cofactor = n_factor_one_line(factor, FLINT_FACTOR_ONE_LINE_ITERS))) 
+              || n_factor_pollard_brent(&cofactor, state, factor,
+                      rho_tries, rho_iters)
+              || n_factor_ecm(&cofactor, FLINT_FACTOR_ECM_CURVES,
+                      FLINT_FACTOR_ECM_B1, FLINT_FACTOR_ECM_B2, state, factor)
               || (cofactor = n_factor_SQUFOF(factor, FLINT_FACTOR_SQUFOF_ITERS)))
 	    {
 	       exp_arr[factors_left] = exp_arr[factors_left - 1];
@@ -100,4 +123,6 @@ void n_factor(n_factor_t * factors, mp_limb_t n, int proved)
          factors_left--;
       }
    } 
+
+   flint_randclear(state);
 }
@@ -0,0 +1,359 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   The elliptic curve method with Montgomery curves B y^2 = x^3 + A x^2 + x
+   in Montgomery's x-only coordinates (X : Z), using Suyama's
+   parametrisation. Arithmetic is done in Montgomery form a*2^FLINT_BITS
+   mod n, with redc reducing by a single multiply-high.
+*/
+
+typedef struct
+{
+    mp_limb_t n;
+    mp_limb_t ninv;
+    mp_limb_t a24;
+} _ecm_curve_t;
+
+/* (x, z) = 2 (x1, z1) */
+static void
+_ecm_double(mp_limb_t * x, mp_limb_t * z, mp_limb_t x1, mp_limb_t z1,
+                                                       const _ecm_curve_t * E)
+{
+    mp_limb_t n = E->n, ninv = E->ninv, s, d, t;
+
+    s = n_addmod(x1, z1, n);
+    s = n_mont_mulmod(s, s, n, ninv);
+    d = n_submod(x1, z1, n);
+    d = n_mont_mulmod(d, d, n, ninv);
+    t = n_submod(s, d, n);
+
+    *x = n_mont_mulmod(s, d, n, ninv);
+    *z = n_mont_mulmod(t, n_addmod(d, n_mont_mulmod(E->a24, t, n, ninv), n),
+                     n, ninv);
+}
+
+/* (x, z) = (x1, z1) + (x2, z2) given their difference (xd, zd) */
+static void
+_ecm_add(mp_limb_t * x, mp_limb_t * z, mp_limb_t x1, mp_limb_t z1,
+         mp_limb_t x2, mp_limb_t z2, mp_limb_t xd, mp_limb_t zd,
+                                                       const _ecm_curve_t * E)
+{
+    mp_limb_t n = E->n, ninv = E->ninv, u, v, s;
+
+    u = n_mont_mulmod(n_submod(x1, z1, n), n_addmod(x2, z2, n), n, ninv);
+    v = n_mont_mulmod(n_addmod(x1, z1, n), n_submod(x2, z2, n), n, ninv);
+
+    s = n_addmod(u, v, n);
+    *x = n_mont_mulmod(zd, n_mont_mulmod(s, s, n, ninv), n, ninv);
+    s = n_submod(u, v, n);
+    *z = n_mont_mulmod(xd, n_mont_mulmod(s, s, n, ninv), n, ninv);
+}
+
+/*
+   Montgomery ladder: sets (x0, z0) = k (x, z) and (x1, z1) = (k + 1) (x, z)
+   for k >= 1
+*/
+static void
+_ecm_ladder(mp_limb_t * x0, mp_limb_t * z0, mp_limb_t * x1, mp_limb_t * z1,
+              mp_limb_t x, mp_limb_t z, mp_limb_t k, const _ecm_curve_t * E)
+{
+    mp_limb_t bit = (UWORD(1) << (FLINT_BIT_COUNT(k) - 1)) >> 1;
+    mp_limb_t ax = x, az = z, bx, bz;
+
+    _ecm_double(&bx, &bz, x, z, E);
+
+    for ( ; bit != 0; bit >>= 1)
+    {
+        if (k & bit)
+        {
+            _ecm_add(&ax, &az, ax, az, bx, bz, x, z, E);
+            _ecm_double(&bx, &bz, bx, bz, E);
+        } else
+        {
+            _ecm_add(&bx, &bz, ax, az, bx, bz, x, z, E);
+            _ecm_double(&ax, &az, ax, az, E);
+        }
+    }
+
+    *x0 = ax;
+    *z0 = az;
+    *x1 = bx;
+    *z1 = bz;
+}
+
+/*
+   Choose the curve for sigma and its starting point (x : z), in
+   Montgomery form. Returns a factor of n if the curve cannot be set up,
+   otherwise 0.
+*/
+static mp_limb_t
+_ecm_select_curve(mp_limb_t * x, mp_limb_t * z, _ecm_curve_t * E,
+                  mp_limb_t sigma, mp_limb_t r2)
+{
+    mp_limb_t n = E->n, ninv = n_preinvert_limb(n);
+    mp_limb_t u, v, t, w, g, inv;
+
+    /* u = sigma^2 - 5, v = 4 sigma */
+    u = n_submod(n_mulmod2_preinv(sigma, sigma, n, ninv), 5 % n, n);
+    v = n_mulmod2_preinv(sigma, 4, n, ninv);
+
+    /* x = u^3, z = v^3 */
+    *x = n_mulmod2_preinv(n_mulmod2_preinv(u, u, n, ninv), u, n, ninv);
+    *z = n_mulmod2_preinv(n_mulmod2_preinv(v, v, n, ninv), v, n, ninv);
+
+    /* a24 = (v - u)^3 (3u + v) / (16 u^3 v) */
+    t = n_submod(v, u, n);
+    t = n_mulmod2_preinv(n_mulmod2_preinv(t, t, n, ninv), t, n, ninv);
+    t = n_mulmod2_preinv(t, n_addmod(n_mulmod2_preinv(u, 3, n, ninv), v, n),
+                         n, ninv);
+    w = n_mulmod2_preinv(n_mulmod2_preinv(*x, v, n, ninv), 16, n, ninv);
+
+    g = n_gcdinv(&inv, w, n);
+    if (g != 1)
+        return (g == n || g == 0) ? 0 : g;
+
+    E->a24 = n_mulmod2_preinv(t, inv, n, ninv);
+
+    /* convert to Montgomery form */
+    E->a24 = n_mont_mulmod(E->a24, r2, n, E->ninv);
+    *x = n_mont_mulmod(*x, r2, n, E->ninv);
+    *z = n_mont_mulmod(*z, r2, n, E->ninv);
+
+    return 0;
+}
+
+mp_limb_t *
+_n_factor_ecm_stage1_table(slong * len, ulong B1)
+{
+    mp_limb_t * tab;
+    mp_limb_t p, q, hi, lo;
+    slong alloc = 16;
+    n_primes_t iter;
+
+    tab = flint_malloc(alloc*sizeof(mp_limb_t));
+    tab[0] = 1;
+    *len = 1;
+
+    n_primes_init(iter);
+
+    for (p = n_primes_next(iter); p <= B1; p = n_primes_next(iter))
+    {
+        /* largest power of p at most B1 */
+        for (q = p; q <= B1/p; q *= p) ;
+
+        umul_ppmm(hi, lo, tab[*len - 1], q);
+
+        if (hi == 0)
+            tab[*len - 1] = lo;
+        else
+        {
+            if (*len == alloc)
+            {
+                alloc *= 2;
+                tab = flint_realloc(tab, alloc*sizeof(mp_limb_t));
+            }
+
+            tab[(*len)++] = q;
+        }
+    }
+
+    n_primes_clear(iter);
+
+    return tab;
+}
+
+unsigned char *
+_n_factor_ecm_stage2_table(slong * num_g, ulong * g0, ulong * D,
+                           slong * num_j, ulong ** j_arr, ulong B1, ulong B2)
+{
+    unsigned char * tab;
+    slong * j_ind;
+    ulong d, p, g, j, lo;
+    n_primes_t iter;
+
+    d = (B2 - B1 >= UWORD(100)*2310) ? 2310 : 210;
+    *D = d;
+
+    /* baby steps j < D/2 coprime to D */
+    *j_arr = flint_malloc((d/4 + 1)*sizeof(ulong));
+    j_ind = flint_malloc((d/2)*sizeof(slong));
+
+    *num_j = 0;
+    for (j = 1; j < d/2; j++)
+    {
+        if (n_gcd(d, j) == 1)
+        {
+            j_ind[j] = *num_j;
+            (*j_arr)[(*num_j)++] = j;
+        } else
+            j_ind[j] = -1;
+    }
+
+    /* primes in (lo, B2] are p = g D +- j with g = (p + D/2)/D */
+    lo = FLINT_MAX(B1, d/2);
+    *g0 = (lo + 1 + d/2)/d;
+    *num_g = (B2 > lo) ? (B2 + d/2)/d - *g0 + 1 : 0;
+    *num_g = FLINT_MAX(*num_g, 0);
+
+    tab = flint_calloc(FLINT_MAX(*num_g * *num_j, 1), 1);
+
+    n_primes_init(iter);
+    n_primes_jump_after(iter, lo);
+
+    for (p = n_primes_next(iter); p <= B2; p = n_primes_next(iter))
+    {
+        g = (p + d/2)/d;
+        j = (p > g*d) ? p - g*d : g*d - p;
+
+        if (j_ind[j] >= 0)
+            tab[(g - *g0) * *num_j + j_ind[j]] = 1;
+    }
+
+    n_primes_clear(iter);
+    flint_free(j_ind);
+
+    return tab;
+}
+
+int
+n_factor_ecm(mp_limb_t * f, ulong curves, ulong B1, ulong B2,
+                                          flint_rand_t state, mp_limb_t n)
+{
+    _ecm_curve_t E[1];
+    mp_limb_t * prod, * baby;
+    unsigned char * tab;
+    ulong * j_arr;
+    ulong D, g0;
+    slong prod_len, num_g, num_j, c, i, k;
+    mp_limb_t r, r2, x, z, x1, z1, gx, gz, hx, hz, dx, dz, acc, t, g;
+    int ret = 0;
+
+    if ((n & 1) == 0)
+    {
+        *f = 2;
+        return 1;
+    }
+
+    E->n = n;
+
+    E->ninv = n_mont_inverse(n);
+
+    /* r = 2^FLINT_BITS mod n and r2 = r^2 mod n */
+    r = (-n) % n;
+    r2 = n_mulmod2_preinv(r, r, n, n_preinvert_limb(n));
+
+    prod = _n_factor_ecm_stage1_table(&prod_len, B1);
+    tab = _n_factor_ecm_stage2_table(&num_g, &g0, &D, &num_j, &j_arr, B1, B2);
+    baby = flint_malloc(2*(D/4 + 1)*sizeof(mp_limb_t));
+
+    for (c = 0; c < curves && ret == 0; c++)
+    {
+        /********************** Select curve ************************/
+
+        g = _ecm_select_curve(&x, &z, E, n_randint(state, n - 7) + 6, r2);
+        if (g != 0)
+        {
+            *f = g;
+            ret = 1;
+            break;
+        }
+
+        /************************* Stage I **************************/
+
+        for (i = 0; i < prod_len; i++)
+            if (prod[i] != 1)
+                _ecm_ladder(&x, &z, &x1, &z1, x, z, prod[i], E);
+
+        g = n_gcd(n, z);
+        if (g == n)
+            continue;
+        if (g != 1)
+        {
+            *f = g;
+            ret = 1;
+            break;
+        }
+
+        if (num_g == 0)
+            continue;
+
+        /************************* Stage II *************************/
+
+        /* baby steps j Q for odd j < D/2, in the entry for (j - 1)/2 */
+        baby[0] = x;
+        baby[1] = z;
+        _ecm_double(&dx, &dz, x, z, E);
+        if (D/4 > 1)
+            _ecm_add(baby + 2, baby + 3, dx, dz, x, z, x, z, E);
+        for (k = 2; k < D/4; k++)
+            _ecm_add(baby + 2*k, baby + 2*k + 1, baby[2*k - 2],
+                     baby[2*k - 1], dx, dz, baby[2*k - 4], baby[2*k - 3], E);
+
+        /* giant steps g D Q, starting from g0 D Q and (g0 + 1) D Q */
+        _ecm_ladder(&dx, &dz, &x1, &z1, x, z, D, E);
+        _ecm_ladder(&gx, &gz, &hx, &hz, dx, dz, g0, E);
+
+        acc = r; /* one in Montgomery form */
+
+        for (i = 0; i < num_g; i++)
+        {
+            for (k = 0; k < num_j; k++)
+            {
+                if (tab[i*num_j + k])
+                {
+                    mp_limb_t * b = baby + 2*((j_arr[k] - 1)/2);
+
+                    t = n_submod(n_mont_mulmod(gx, b[1], n, E->ninv),
+                                 n_mont_mulmod(b[0], gz, n, E->ninv), n);
+                    acc = n_mont_mulmod(acc, t, n, E->ninv);
+                }
+            }
+
+            /* (g + 2) D Q = (g + 1) D Q + D Q, with difference g D Q */
+            _ecm_add(&x1, &z1, hx, hz, dx, dz, gx, gz, E);
+            gx = hx; gz = hz;
+            hx = x1; hz = z1;
+        }
+
+        g = n_gcd(n, acc);
+        if (g != 1 && g != n)
+        {
+            *f = g;
+            ret = 2;
+        }
+    }
+
+    flint_free(prod);
+    flint_free(tab);
+    flint_free(j_arr);
+    flint_free(baby);
+
+    return ret;
+}
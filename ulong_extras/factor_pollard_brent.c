@@ -0,0 +1,125 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/* number of steps whose differences are multiplied together per gcd */
+#define RHO_BATCH 128
+
+/*
+   Brent's variant of Pollard rho with the map x -> x^2 + a, done in
+   Montgomery form. As the map commutes with conversion to Montgomery form
+   up to a change of a, any a and x0 with 0 <= a, x0 < n will do.
+*/
+int
+n_factor_pollard_brent_single(mp_limb_t * f, mp_limb_t n, mp_limb_t ninv,
+                           mp_limb_t a, mp_limb_t x0, ulong max_iters)
+{
+    mp_limb_t x, y, ys, q, g;
+    ulong r, k, i, m = 0;
+
+    y = x0;
+    q = 1;
+    g = 1;
+
+    for (r = 1; g == 1 && r <= max_iters; r *= 2)
+    {
+        x = y;
+
+        for (i = 0; i < r; i++)
+            y = n_addmod(n_mont_mulmod(y, y, n, ninv), a, n);
+
+        for (k = 0; k < r && g == 1; k += m)
+        {
+            ys = y;
+            m = FLINT_MIN(RHO_BATCH, r - k);
+
+            for (i = 0; i < m; i++)
+            {
+                y = n_addmod(n_mont_mulmod(y, y, n, ninv), a, n);
+                q = n_mont_mulmod(q, x > y ? x - y : y - x, n, ninv);
+            }
+
+            g = (q == 0) ? n : n_gcd(n, q);
+        }
+    }
+
+    /* the batch went past a factor, redo it one step at a time */
+    if (g == n)
+    {
+        for (i = 0; i < m; i++)
+        {
+            ys = n_addmod(n_mont_mulmod(ys, ys, n, ninv), a, n);
+
+            if (x != ys)
+            {
+                g = n_gcd(n, x > ys ? x - ys : ys - x);
+                if (g != 1)
+                    break;
+            }
+        }
+    }
+
+    if (g == 1 || g == n)
+        return 0;
+
+    *f = g;
+    return 1;
+}
+
+int
+n_factor_pollard_brent(mp_limb_t * f, flint_rand_t state, mp_limb_t n,
+                                           ulong max_tries, ulong max_iters)
+{
+    mp_limb_t ninv, a, x0;
+    ulong i;
+
+    if ((n & 1) == 0)
+    {
+        if (n == 2)
+            return 0;
+
+        *f = 2;
+        return 1;
+    }
+
+    if (n < 5)
+        return 0;
+
+    ninv = n_mont_inverse(n);
+
+    for (i = 0; i < max_tries; i++)
+    {
+        a = n_randint(state, n - 1) + 1;
+        x0 = n_randint(state, n);
+
+        if (n_factor_pollard_brent_single(f, n, ninv, a, x0, max_iters))
+            return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,262 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "thread_pool.h"
+
+/*
+    The values are handled in blocks of PRIME_VEC_BLOCK. Values below
+    FLINT_PRIMES_TAB_DEFAULT_CUTOFF are left to n_is_prime, which looks them
+    up in a table. Larger values without small factors go through a strong
+    probable prime test to base 2, which runs on PRIME_VEC_LANES values at
+    once in Montgomery form, so that the independent multiplication chains
+    can overlap. Survivors below 4759123141 are finished with bases 7 and
+    61 (Jaeschke), the others with the Lucas half of BPSW, exactly as in
+    n_is_probabprime_BPSW.
+*/
+
+#define PRIME_VEC_LANES 4
+#define PRIME_VEC_BLOCK 256
+#define PRIME_VEC_NUM_SMALL 24
+#define PRIME_VEC_TASK_MIN 4096
+
+/* sets pass[i] to whether n[i] is a strong probable prime to base a */
+static void
+_n_is_strong_probabprime_vec(int * pass, mp_srcptr n, slong num, mp_limb_t a)
+{
+    mp_limb_t m[PRIME_VEC_LANES], ninv[PRIME_VEC_LANES];
+    mp_limb_t one[PRIME_VEC_LANES], b[PRIME_VEC_LANES];
+    mp_limb_t x[PRIME_VEC_LANES], d[PRIME_VEC_LANES], t, mask;
+    unsigned int s[PRIME_VEC_LANES];
+    slong i, j, k, l;
+    int bits, r;
+
+    for (i = 0; i < num; i += PRIME_VEC_LANES)
+    {
+        l = FLINT_MIN(PRIME_VEC_LANES, num - i);
+        bits = 0;
+
+        /* unused lanes repeat the first value */
+        for (j = 0; j < PRIME_VEC_LANES; j++)
+        {
+            m[j] = n[i + (j < l ? j : 0)];
+            ninv[j] = n_mont_inverse(m[j]);
+            one[j] = (-m[j]) % m[j];
+
+            /* a * one by doubling and adding, as a is tiny */
+            b[j] = 0;
+            for (k = FLINT_BIT_COUNT(a) - 1; k >= 0; k--)
+            {
+                b[j] = n_addmod(b[j], b[j], m[j]);
+                if ((a >> k) & 1)
+                    b[j] = n_addmod(b[j], one[j], m[j]);
+            }
+
+            d[j] = m[j] - 1;
+            count_trailing_zeros(s[j], d[j]);
+            d[j] >>= s[j];
+            bits = FLINT_MAX(bits, FLINT_BIT_COUNT(d[j]));
+            x[j] = one[j];
+        }
+
+        /* the exponent bits are applied by masking, as they are random */
+        for (k = bits - 1; k >= 0; k--)
+        {
+            for (j = 0; j < PRIME_VEC_LANES; j++)
+                x[j] = n_mont_mulmod(x[j], x[j], m[j], ninv[j]);
+
+            for (j = 0; j < PRIME_VEC_LANES; j++)
+            {
+                mask = -((d[j] >> k) & 1);
+                t = (a == 2) ? n_addmod(x[j], x[j], m[j])
+                             : n_mont_mulmod(x[j], b[j], m[j], ninv[j]);
+                x[j] = (t & mask) | (x[j] & ~mask);
+            }
+        }
+
+        for (j = 0; j < l; j++)
+        {
+            r = (x[j] == one[j] || x[j] == m[j] - one[j]);
+
+            for (k = 1; k < s[j] && !r; k++)
+            {
+                x[j] = n_mont_mulmod(x[j], x[j], m[j], ninv[j]);
+
+                if (x[j] == m[j] - one[j])
+                    r = 1;
+                else if (x[j] == one[j])
+                    break;
+            }
+
+            pass[i + j] = r;
+        }
+    }
+}
+
+void
+_n_is_prime_vec(int * res, mp_srcptr v, slong len)
+{
+    mp_limb_t pinv[PRIME_VEC_NUM_SMALL], plim[PRIME_VEC_NUM_SMALL];
+    mp_limb_t cand[PRIME_VEC_BLOCK], cand2[PRIME_VEC_BLOCK];
+    slong idx[PRIME_VEC_BLOCK], idx2[PRIME_VEC_BLOCK];
+    int pass[PRIME_VEC_BLOCK];
+    slong i, j, k, num, num2;
+    mp_limb_t n;
+
+    /* n is divisible by the odd prime p iff n * p^(-1) <= (2^B - 1) / p */
+    for (k = 0; k < PRIME_VEC_NUM_SMALL; k++)
+    {
+        pinv[k] = n_mont_inverse(flint_primes_small[k + 1]);
+        plim[k] = UWORD_MAX / flint_primes_small[k + 1];
+    }
+
+    for (i = 0; i < len; i += PRIME_VEC_BLOCK)
+    {
+        num = 0;
+
+        for (j = i; j < FLINT_MIN(len, i + PRIME_VEC_BLOCK); j++)
+        {
+            n = v[j];
+
+            /* n_is_prime looks these up in a table */
+            if (n < FLINT_PRIMES_TAB_DEFAULT_CUTOFF)
+            {
+                res[j] = n_is_prime(n);
+                continue;
+            }
+
+            if ((n & UWORD(1)) == 0)
+            {
+                res[j] = 0;
+                continue;
+            }
+
+            for (k = 0; k < PRIME_VEC_NUM_SMALL; k++)
+                if (n * pinv[k] <= plim[k])
+                    break;
+
+            if (k < PRIME_VEC_NUM_SMALL)
+                res[j] = 0;
+            else
+            {
+                cand[num] = n;
+                idx[num++] = j;
+            }
+        }
+
+        _n_is_strong_probabprime_vec(pass, cand, num, UWORD(2));
+
+        num2 = 0;
+        for (j = 0; j < num; j++)
+        {
+            n = cand[j];
+
+            if (!pass[j])
+                res[idx[j]] = 0;
+#if FLINT64
+            else if (n >= UWORD(4759123141))
+            {
+                if ((n % 10) == 3 || (n % 10) == 7)
+                    res[idx[j]] = n_is_probabprime_fibonacci(n);
+                else
+                    res[idx[j]] = (n_is_probabprime_lucas(n) == 1);
+            }
+#endif
+            else
+            {
+                cand2[num2] = n;
+                idx2[num2++] = idx[j];
+            }
+        }
+
+        _n_is_strong_probabprime_vec(pass, cand2, num2, UWORD(7));
+
+        num = 0;
+        for (j = 0; j < num2; j++)
+        {
+            if (pass[j])
+            {
+                cand[num] = cand2[j];
+                idx[num++] = idx2[j];
+            }
+            else
+                res[idx2[j]] = 0;
+        }
+
+        _n_is_strong_probabprime_vec(pass, cand, num, UWORD(61));
+
+        for (j = 0; j < num; j++)
+            res[idx[j]] = pass[j];
+    }
+}
+
+typedef struct
+{
+    int * res;
+    mp_srcptr v;
+    slong len;
+} _is_prime_vec_arg_t;
+
+static void *
+_n_is_prime_vec_worker(void * arg_ptr)
+{
+    _is_prime_vec_arg_t arg = *((_is_prime_vec_arg_t *) arg_ptr);
+
+    _n_is_prime_vec(arg.res, arg.v, arg.len);
+
+    return NULL;
+}
+
+void
+n_is_prime_vec(int * res, mp_srcptr v, slong len)
+{
+    _is_prime_vec_arg_t * args;
+    slong i, num_tasks;
+
+    num_tasks = FLINT_MIN(flint_get_num_threads(),
+                          len / PRIME_VEC_TASK_MIN + 1);
+
+    if (num_tasks <= 1)
+    {
+        _n_is_prime_vec(res, v, len);
+        return;
+    }
+
+    args = flint_malloc(num_tasks * sizeof(_is_prime_vec_arg_t));
+
+    for (i = 0; i < num_tasks; i++)
+    {
+        args[i].res = res + (i * len) / num_tasks;
+        args[i].v = v + (i * len) / num_tasks;
+        args[i].len = ((i + 1) * len) / num_tasks - (i * len) / num_tasks;
+    }
+
+    flint_parallel_do(_n_is_prime_vec_worker, args,
+                      sizeof(_is_prime_vec_arg_t), num_tasks);
+
+    flint_free(args);
+}
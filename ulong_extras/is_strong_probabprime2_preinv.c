@@ -28,6 +28,7 @@
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
+#include "nmod_mont.h"
 
 int
 n_is_strong_probabprime2_preinv(mp_limb_t n, mp_limb_t ninv, mp_limb_t a,
@@ -42,6 +43,32 @@ n_is_strong_probabprime2_preinv(mp_limb_t n, mp_limb_t ninv, mp_limb_t a,
 
     if ((a <= 1) || (a == n - 1))  return 1;
 
+    /* the whole chain is done in Montgomery form if n is small enough */
+    if (FLINT_BIT_COUNT(n) <= NMOD_MONT_MAX_BITS)
+    {
+        nmod_mont_t ctx;
+        mp_limb_t one, minus_one;
+
+        nmod_mont_init_preinv(ctx, n, ninv);
+        one = ctx->one;
+        minus_one = n - one;
+
+        y = nmod_mont_pow_ui(nmod_mont_set_ui(a, ctx), t, ctx);
+        y = nmod_mont_canonical(y, ctx);
+
+        if (y == one)
+            return 1;
+        t <<= 1;
+
+        while ((t != n - 1) && (y != minus_one))
+        {
+            y = nmod_mont_canonical(nmod_mont_sqr(y, ctx), ctx);
+            t <<= 1;
+        }
+
+        return (y == minus_one);
+    }
+
     y = n_powmod2_ui_preinv(a, t, n, ninv);
 
     if (y == UWORD(1))
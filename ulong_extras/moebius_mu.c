@@ -54,26 +54,24 @@ const mp_limb_t FLINT_MOEBIUS_ODD[] =
 void n_moebius_mu_vec(int * mu, ulong len)
 {
     slong k;
-    ulong pi;
-    const mp_limb_t * primes;
+    n_primes_t iter;
     mp_limb_t p, q;
 
-    pi = n_prime_pi(len);
-    primes = n_primes_arr_readonly(pi);
-
     if (len)
         mu[0] = 0;
     for (k = 1; k < len; k++)
         mu[k] = 1;
-    for (k = 0; k < pi; k++)
+
+    n_primes_init(iter);
+    while ((p = n_primes_next(iter)) < len)
     {
-        p = primes[k];
         for (q = p; q < len; q += p)
             mu[q] = -mu[q];
         p = p * p;
         for (q = p; q < len; q += p)
             mu[q] = 0;
     }
+    n_primes_clear(iter);
 }
 
 int n_moebius_mu(mp_limb_t n)
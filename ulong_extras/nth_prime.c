@@ -26,19 +26,97 @@
 #define ulong ulongxx /* interferes with system includes */
 #include <stdlib.h>
 #include <stdio.h>
+#include <math.h>
 #undef ulong
 #define ulong mp_limb_t
 #include "flint.h"
 #include "ulong_extras.h"
 
+/* the logarithmic integral li(x) for x > 1, by Ramanujan's series */
+static double
+_li(double x)
+{
+    double lx = log(x), term = 1.0, inner = 0.0, sum = 0.0;
+    slong k;
+
+    for (k = 1; k < 1000; k++)
+    {
+        term *= lx / (k * (k == 1 ? 1.0 : 2.0));
+        if ((k & 1) == 1)
+            inner += 1.0 / k;
+        sum += ((k & 1) ? term : -term) * inner;
+
+        if (term * inner < 1e-17 * fabs(sum))
+            break;
+    }
+
+    return 0.5772156649015329 + log(lx) + sqrt(x) * sum;
+}
+
 mp_limb_t n_nth_prime(ulong n)
 {
+    n_primes_t iter;
+    double x, dx;
+    mp_limb_t guess, count, lo, hi, p = 0;
+    slong i, k, j;
+
     if (n == 0)
     {
         flint_printf("Exception (n_nth_prime). n_nth_prime(0) is undefined.\n");
         abort();
     }
 
-    return n_primes_arr_readonly(n)[n-1];
-}
+    if (n < FLINT_NTH_PRIME_LMO_CUTOFF)
+        return n_primes_arr_readonly(n)[n-1];
+
+    /* guess li^(-1)(n), which is within about sqrt(p_n) of p_n */
+    x = n * log((double) n);
+    for (i = 0; i < 100; i++)
+    {
+        dx = (_li(x) - n) * log(x);
+        x -= dx;
+        if (fabs(dx) < 1.0)
+            break;
+    }
+
+    guess = (x >= (double) UWORD_MAX_PRIME) ? UWORD_MAX_PRIME : (mp_limb_t) x;
+    count = n_prime_pi(guess);
 
+    n_primes_init(iter);
+
+    if (count < n)
+    {
+        /* step forwards to the nth prime */
+        n_primes_jump_after(iter, guess);
+        for ( ; count < n; count++)
+            p = n_primes_next(iter);
+    }
+    else
+    {
+        /* sieve backwards, the largest prime up to hi being the count-th */
+        for (hi = guess; ; hi = lo - 1)
+        {
+            lo = hi - FLINT_SIEVE_SIZE + 2;
+            n_primes_sieve_range(iter, lo, hi);
+
+            for (k = 0, j = 0; j < iter->sieve_num; j++)
+                k += (iter->sieve[j] != 0);
+
+            if (count - k < n)
+                break;
+
+            count -= k;
+        }
+
+        /* the nth prime is the (n - count + k)th in the segment */
+        for (k = n - count + k, j = 0; ; j++)
+            if (iter->sieve[j] != 0 && --k == 0)
+                break;
+
+        p = iter->sieve_a + 2*j;
+    }
+
+    n_primes_clear(iter);
+
+    return p;
+}
@@ -26,6 +26,7 @@
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
+#include "nmod_mont.h"
 
 mp_limb_t
 n_powmod2_ui_preinv(mp_limb_t a, mp_limb_t exp, mp_limb_t n, mp_limb_t ninv)
@@ -34,6 +35,18 @@ n_powmod2_ui_preinv(mp_limb_t a, mp_limb_t exp, mp_limb_t n, mp_limb_t ninv)
    
     if (n == UWORD(1) || (a == 0 && exp != 0)) return UWORD(0);
 
+    /* the conversions pay for themselves on long chains */
+    if ((n & UWORD(1)) && exp >= NMOD_MONT_POW_CUTOFF
+                       && FLINT_BIT_COUNT(n) <= NMOD_MONT_MAX_BITS)
+    {
+        nmod_mont_t ctx;
+
+        nmod_mont_init_preinv(ctx, n, ninv);
+        x = nmod_mont_pow_ui(nmod_mont_set_ui(a, ctx), exp, ctx);
+
+        return nmod_mont_get_ui(x, ctx);
+    }
+
     x = UWORD(1);
     
     if (exp)
@@ -70,6 +83,10 @@ n_powmod2_preinv(mp_limb_t a, mp_limb_signed_t exp, mp_limb_t n, mp_limb_t ninv)
         exp = -exp;
     }
 
+    if ((n & UWORD(1)) && exp >= NMOD_MONT_POW_CUTOFF
+                       && FLINT_BIT_COUNT(n) <= NMOD_MONT_MAX_BITS)
+        return n_powmod2_ui_preinv(a, exp, n, ninv);
+
     count_leading_zeros(norm, n);
 
     return n_powmod_ui_preinv(a<<norm, exp, n<<norm, ninv, norm) >> norm;
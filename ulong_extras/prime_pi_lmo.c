@@ -0,0 +1,401 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <math.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   Lagarias-Miller-Odlyzko prime counting. With y = alpha x^(1/3) and
+   a = pi(y) we have pi(x) = phi(x, a) + a - 1 - P2(x, a), where phi(x, a)
+   is split into ordinary leaves S1 and special leaves S2. Both S2 and P2
+   need values of phi or pi below z = x/y, which are found with a
+   segmented sieve of [1, z]. For S2 the sieve is combined with a binary
+   indexed tree counting the unsieved entries. All sums are done modulo
+   2^FLINT_BITS, which is harmless as the result fits in a limb.
+*/
+
+/* the number of primes used for phi(t, c) by table lookup */
+#define LMO_C 6
+
+/* bound on y, which limits the memory used to about 5 bytes per y */
+#define LMO_Y_MAX (UWORD(1) << 23)
+
+/* floor(x^(1/3)) */
+static ulong
+_lmo_cbrt(ulong x)
+{
+    ulong r = (ulong) pow((double) x, 1.0/3.0);
+
+    /* largest r with r^3 < 2^FLINT_BITS, so the cubes below cannot wrap */
+#if FLINT64
+    const ulong r_max = UWORD(2642245);
+#else
+    const ulong r_max = UWORD(1625);
+#endif
+
+    if (r > r_max)
+        r = r_max;
+
+    while (r*r*r > x)
+        r--;
+    while (r < r_max && (r + 1)*(r + 1)*(r + 1) <= x)
+        r++;
+
+    return r;
+}
+
+/*
+   sets s[i] = 1 if lo + i is prime and 0 otherwise, for lo <= i < hi,
+   given the primes in primes[1..a] include all primes up to sqrt(hi);
+   returns the number of primes found
+*/
+static ulong
+_lmo_sieve_primes(unsigned char * s, ulong lo, ulong hi,
+                                   const unsigned int * primes, ulong a)
+{
+    ulong i, b, p, k, count;
+
+    for (i = 0; i < hi - lo; i++)
+        s[i] = (lo + i) & 1;
+
+    if (lo <= 1 && hi > 1)
+        s[1 - lo] = 0;
+    if (lo <= 2 && hi > 2)
+        s[2 - lo] = 1;
+
+    for (b = 2; b <= a && (ulong) primes[b]*primes[b] < hi; b++)
+    {
+        p = primes[b];
+        k = (p*p >= lo) ? p*p : ((lo + p - 1)/p)*p;
+        if ((k & 1) == 0)
+            k += p;
+
+        for ( ; k < hi; k += 2*p)
+            s[k - lo] = 0;
+    }
+
+    count = 0;
+    for (i = 0; i < hi - lo; i++)
+        count += s[i];
+
+    return count;
+}
+
+/* the number of primes up to m <= p_a among primes[1..a] */
+static ulong
+_lmo_pi(const unsigned int * primes, ulong a, ulong m)
+{
+    ulong lo = 0, hi = a, mid;
+
+    /* primes[lo] <= m < primes[hi + 1] */
+    while (lo < hi)
+    {
+        mid = (lo + hi + 1)/2;
+        if (primes[mid] <= m)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    return lo;
+}
+
+/* S1 = sum of mu(n) phi(x/n, c) over n <= y with lpf(n) > p_c */
+static ulong
+_lmo_S1(ulong x, ulong y, ulong c, const unsigned int * primes,
+        const unsigned int * lpf, const signed char * mu,
+        const unsigned int * tab, ulong pp, ulong tot)
+{
+    ulong n, t, s = 0;
+
+    for (n = 1; n <= y; n++)
+    {
+        if (mu[n] != 0 && lpf[n] > primes[c])
+        {
+            t = x / n;
+            t = (t / pp)*tot + tab[t % pp];
+            s = (mu[n] > 0) ? s + t : s - t;
+        }
+    }
+
+    return s;
+}
+
+/*
+   S2 = - sum of mu(m) phi(x/(p_b m), b - 1) over c < b < a and m <= y
+   with p_b m > y, lpf(m) > p_b
+*/
+static ulong
+_lmo_S2(ulong x, ulong y, ulong a, ulong c, const unsigned int * primes,
+        const unsigned int * lpf, const signed char * mu,
+        const unsigned int * tab, ulong pp)
+{
+    ulong limit = x / y + 1, size, low, high, b, p, xp, m, min_m, max_m;
+    ulong i, j, k, l, r, t, count, seg_count, pi_sqrty, s = 0;
+    ulong * phi, * next;
+    unsigned char * sieve;
+    unsigned int * tree;
+
+    size = UWORD(1) << FLINT_BIT_COUNT(n_sqrt(limit));
+
+    sieve = flint_malloc(size);
+    tree = flint_malloc(size*sizeof(unsigned int));
+    phi = flint_calloc(a + 1, sizeof(ulong));
+    next = flint_malloc((a + 1)*sizeof(ulong));
+
+    for (b = 1; b <= a; b++)
+        next[b] = primes[b];
+
+    pi_sqrty = _lmo_pi(primes, a, n_sqrt(y));
+
+    for (low = 1; low < limit; low += size)
+    {
+        high = FLINT_MIN(low + size, limit);
+
+        /* remove the multiples of the first c primes */
+        r = low % pp;
+        seg_count = 0;
+        for (i = 0; i < high - low; i++)
+        {
+            sieve[i] = (r != 0 && tab[r] != tab[r - 1]);
+            seg_count += sieve[i];
+            if (++r == pp)
+                r = 0;
+        }
+
+        /* binary indexed tree of the counts */
+        for (i = 0; i < high - low; i++)
+            tree[i] = sieve[i];
+        for (i = 0; i < high - low; i++)
+        {
+            j = i | (i + 1);
+            if (j < high - low)
+                tree[j] += tree[i];
+        }
+
+        for (b = c + 1; b < a; b++)
+        {
+            p = primes[b];
+            xp = x / p;
+            min_m = FLINT_MAX(xp / high, y / p);
+            max_m = FLINT_MIN(xp / low, y);
+
+            if (p >= max_m)
+                break;
+
+            if (b <= pi_sqrty)
+            {
+                for (m = max_m; m > min_m; m--)
+                {
+                    if (mu[m] != 0 && p < lpf[m])
+                    {
+                        /* phi(x/(p m), b - 1) */
+                        t = xp / m - low;
+                        count = phi[b];
+                        for (j = t + 1; j > 0; j &= j - 1)
+                            count += tree[j - 1];
+
+                        s = (mu[m] > 0) ? s - count : s + count;
+                    }
+                }
+            }
+            else
+            {
+                /* here m > p > sqrt(y) must be a prime */
+                for (l = _lmo_pi(primes, a, max_m);
+                                        l > b && primes[l] > min_m; l--)
+                {
+                    t = xp / primes[l] - low;
+                    count = phi[b];
+                    for (j = t + 1; j > 0; j &= j - 1)
+                        count += tree[j - 1];
+
+                    s += count;
+                }
+            }
+
+            phi[b] += seg_count;
+
+            /* remove the odd multiples of p, the even ones are gone */
+            for (k = next[b]; k < high; k += 2*p)
+            {
+                if (sieve[k - low])
+                {
+                    sieve[k - low] = 0;
+                    seg_count--;
+                    for (j = k - low; j < high - low; j |= j + 1)
+                        tree[j]--;
+                }
+            }
+            next[b] = k;
+        }
+    }
+
+    flint_free(sieve);
+    flint_free(tree);
+    flint_free(phi);
+    flint_free(next);
+
+    return s;
+}
+
+/* P2 = sum of pi(x/p) - pi(p) + 1 over primes y < p <= sqrt(x) */
+static ulong
+_lmo_P2(ulong x, ulong y, ulong a, const unsigned int * primes)
+{
+    ulong sqrtx = n_sqrt(x), limit = x / y + 1, size;
+    ulong blo, bhi, mlow, mhigh, pos, before, rest, num, i, p, t, s = 0;
+    unsigned char * block, * msieve;
+
+    if (sqrtx <= y)
+        return 0;
+
+    size = FLINT_MAX(n_sqrt(limit), UWORD(1) << 12);
+    block = flint_malloc(size);
+    msieve = flint_malloc(size);
+
+    mlow = 2;
+    mhigh = FLINT_MIN(mlow + size, limit);
+    before = 0;
+    rest = _lmo_sieve_primes(msieve, mlow, mhigh, primes, a);
+    pos = mlow;
+    num = 0;
+
+    /* primes p in (y, sqrt(x)] in decreasing order, so x/p increases */
+    for (bhi = sqrtx + 1; bhi > y + 1; bhi = blo)
+    {
+        blo = (bhi - (y + 1) > size) ? bhi - size : y + 1;
+        _lmo_sieve_primes(block, blo, bhi, primes, a);
+
+        for (i = bhi - blo; i > 0; i--)
+        {
+            if (!block[i - 1])
+                continue;
+
+            p = blo + i - 1;
+            t = x / p;
+
+            /* before counts the primes below pos, rest those in the
+               remainder of the segment */
+            while (t >= mhigh)
+            {
+                before += rest;
+                mlow = mhigh;
+                mhigh = FLINT_MIN(mlow + size, limit);
+                rest = _lmo_sieve_primes(msieve, mlow, mhigh, primes, a);
+                pos = mlow;
+            }
+
+            for ( ; pos <= t; pos++)
+            {
+                before += msieve[pos - mlow];
+                rest -= msieve[pos - mlow];
+            }
+
+            s += before;
+            num++;
+        }
+    }
+
+    flint_free(block);
+    flint_free(msieve);
+
+    /* subtract the sum of pi(p) - 1 = a, ..., a + num - 1 */
+    return s - num*a - num*(num - 1)/2;
+}
+
+ulong n_prime_pi_lmo(mp_limb_t x)
+{
+    ulong y, a, c, pp, tot, r, i, m, bound, s1, s2, p2;
+    unsigned int * primes, * lpf, * tab;
+    signed char * mu;
+    n_primes_t iter;
+
+    if (x < FLINT_PRIME_PI_ODD_LOOKUP_CUTOFF)
+        return n_prime_pi(x);
+
+    /*
+       y > x^(1/3) ensures the primes up to y suffice for sieving, larger
+       y trades sieving for special leaves
+    */
+    y = _lmo_cbrt(x) + 1;
+    y = FLINT_MAX(y, FLINT_MIN(y*(FLINT_BIT_COUNT(x)/10), LMO_Y_MAX));
+    y = FLINT_MIN(y, n_sqrt(x));
+
+    /* primes[1..a] are the primes up to y */
+    n_prime_pi_bounds(&r, &bound, FLINT_MAX(y, 17));
+    primes = flint_malloc((bound + 2)*sizeof(unsigned int));
+    primes[0] = 0;
+    n_primes_init(iter);
+    for (a = 0; (r = n_primes_next(iter)) <= y; )
+        primes[++a] = r;
+    n_primes_clear(iter);
+
+    /* least prime factors and Moebius function up to y */
+    lpf = flint_calloc(y + 1, sizeof(unsigned int));
+    mu = flint_malloc(y + 1);
+    for (m = 1; m <= y; m++)
+        mu[m] = 1;
+    for (i = 1; i <= a; i++)
+    {
+        r = primes[i];
+        for (m = r; m <= y; m += r)
+        {
+            if (lpf[m] == 0)
+                lpf[m] = r;
+            mu[m] = -mu[m];
+        }
+        for (m = r*r; m <= y; m += r*r)
+            mu[m] = 0;
+    }
+    lpf[1] = y + 1;
+
+    /* tab[r] = phi(r, c) for r < pp = p_1 ... p_c */
+    c = FLINT_MIN(a, LMO_C);
+    for (pp = 1, tot = 1, i = 1; i <= c; i++)
+    {
+        pp *= primes[i];
+        tot *= primes[i] - 1;
+    }
+    tab = flint_malloc(pp*sizeof(unsigned int));
+    for (r = 0; r < pp; r++)
+    {
+        for (i = 1; i <= c && r % primes[i] != 0; i++) ;
+        tab[r] = (r == 0 ? 0 : tab[r - 1]) + (i > c);
+    }
+
+    s1 = _lmo_S1(x, y, c, primes, lpf, mu, tab, pp, tot);
+    s2 = _lmo_S2(x, y, a, c, primes, lpf, mu, tab, pp);
+    p2 = _lmo_P2(x, y, a, primes);
+
+    flint_free(primes);
+    flint_free(lpf);
+    flint_free(mu);
+    flint_free(tab);
+
+    return s1 + s2 + a - 1 - p2;
+}
@@ -0,0 +1,75 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+    The primes below 2^16 followed by 65537. The table is filled once, by
+    whichever thread gets there first, and is then only ever read, so that
+    all prime iterators in all threads can share it.
+*/
+static unsigned int _n_primes_base_arr[FLINT_NUM_PRIMES_BASE];
+static pthread_once_t _n_primes_base_once = PTHREAD_ONCE_INIT;
+
+static void
+_n_primes_base_init(void)
+{
+    char * sieve;
+    slong i, j, num;
+
+    sieve = flint_malloc(UWORD(1) << 16);
+    memset(sieve, 1, UWORD(1) << 16);
+
+    for (i = 2; i < 256; i++)
+        if (sieve[i])
+            for (j = i * i; j < (WORD(1) << 16); j += i)
+                sieve[j] = 0;
+
+    num = 0;
+    for (i = 2; i < (WORD(1) << 16); i++)
+        if (sieve[i])
+            _n_primes_base_arr[num++] = i;
+
+    _n_primes_base_arr[num] = 65537;
+
+    flint_free(sieve);
+}
+
+const unsigned int *
+n_primes_base(void)
+{
+    pthread_once(&_n_primes_base_once, _n_primes_base_init);
+
+    return _n_primes_base_arr;
+}
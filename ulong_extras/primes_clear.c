@@ -29,7 +29,8 @@
 void
 n_primes_clear(n_primes_t iter)
 {
-    if (iter->small_primes != flint_primes_small)
+    if (iter->small_primes != flint_primes_small
+        && iter->small_primes != n_primes_base())
         flint_free(iter->small_primes);
 
     if (iter->sieve != NULL)
@@ -38,7 +38,9 @@ n_primes_extend_small(n_primes_t iter, mp_limb_t bound)
 
         num = iter->small_num * 2;
 
-        if (iter->small_primes == flint_primes_small)
+        /* the shared tables are never written to */
+        if (iter->small_primes == flint_primes_small
+            || iter->small_primes == n_primes_base())
             iter->small_primes = flint_malloc(num * sizeof(unsigned int));
         else
             iter->small_primes = flint_realloc(iter->small_primes,
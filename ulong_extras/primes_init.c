@@ -30,8 +30,8 @@ void
 n_primes_init(n_primes_t iter)
 {
     iter->small_i = 0;
-    iter->small_primes = (unsigned int *) flint_primes_small;
-    iter->small_num = FLINT_NUM_PRIMES_SMALL;
+    iter->small_primes = (unsigned int *) n_primes_base();
+    iter->small_num = FLINT_NUM_PRIMES_BASE;
 
     iter->sieve_i = 0;
     iter->sieve_num = 0;
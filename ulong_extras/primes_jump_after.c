@@ -31,7 +31,19 @@ n_primes_jump_after(n_primes_t iter, mp_limb_t n)
 {
     if (n < iter->small_primes[iter->small_num - 1])
     {
-        iter->small_i = n_prime_pi(n);
+        slong lo = 0, hi = iter->small_num - 1, mid;
+
+        /* index of the first tabulated prime exceeding n */
+        while (lo < hi)
+        {
+            mid = lo + (hi - lo) / 2;
+            if (iter->small_primes[mid] <= n)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        iter->small_i = lo;
         iter->sieve_a = iter->sieve_b = iter->sieve_num = 0;
     }
     else
@@ -0,0 +1,167 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <string.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "thread_pool.h"
+
+/* smallest interval worth handing to a separate task */
+#define PRIMES_RANGE_TASK_MIN (WORD(1) << 20)
+
+/*
+   segments whose primes would need sieving primes beyond this are tested
+   one odd value at a time, which is faster from about 2^46 on and avoids
+   tabulating the primes up to 2^32 near the top of the word
+*/
+#define PRIMES_RANGE_SIEVE_SQRT_MAX (UWORD(1) << 23)
+
+typedef struct
+{
+    mp_limb_t a;
+    mp_limb_t b;
+    mp_limb_t * primes;
+    slong num;
+} _primes_range_arg_t;
+
+/* collects the primes in [a, b), where a is odd and at least 3 */
+static void *
+_n_primes_range_worker(void * arg_ptr)
+{
+    _primes_range_arg_t * arg = (_primes_range_arg_t *) arg_ptr;
+    mp_limb_t s, e, t, b = arg->b;
+    mp_limb_t * primes;
+    slong i, num = 0, alloc = 256;
+    n_primes_t iter;
+
+    primes = flint_malloc(alloc * sizeof(mp_limb_t));
+
+    n_primes_init(iter);
+
+    /* segments [s, e] with s odd, written so that nothing wraps near
+       the top of the word */
+    for (s = arg->a; ; s = e + 2)
+    {
+        e = (b - 1 - s < FLINT_SIEVE_SIZE - 2) ?
+                b - 1 : s + FLINT_SIEVE_SIZE - 2;
+
+        if (num + (slong) ((e - s) / 2 + 1) > alloc)
+        {
+            alloc = FLINT_MAX(2 * alloc, num + (e - s) / 2 + 1);
+            primes = flint_realloc(primes, alloc * sizeof(mp_limb_t));
+        }
+
+        if (n_sqrt(e) < PRIMES_RANGE_SIEVE_SQRT_MAX)
+        {
+            n_primes_sieve_range(iter, s, e);
+
+            for (i = 0; i < iter->sieve_num; i++)
+                if (iter->sieve[i] != 0)
+                    primes[num++] = iter->sieve_a + 2 * i;
+        }
+        else
+        {
+            for (t = s; t <= e; t += 2)
+                if (n_is_prime(t))
+                    primes[num++] = t;
+        }
+
+        if (e >= b - 2)
+            break;
+    }
+
+    n_primes_clear(iter);
+
+    arg->primes = primes;
+    arg->num = num;
+
+    return NULL;
+}
+
+slong
+n_primes_range(mp_limb_t ** primes, mp_limb_t a, mp_limb_t b)
+{
+    _primes_range_arg_t * args;
+    mp_limb_t len;
+    slong i, num, num_tasks;
+    int two;
+
+    two = (a <= 2 && b > 2);
+
+    a = FLINT_MAX(a, 3);
+    a += (a % 2 == 0);
+
+    if (a >= b)
+    {
+        *primes = two ? flint_malloc(sizeof(mp_limb_t)) : NULL;
+        if (two)
+            (*primes)[0] = 2;
+        return two;
+    }
+
+    /* split [a, b) into intervals of even length, so each starts odd */
+    num_tasks = FLINT_MIN(flint_get_num_threads(),
+                          (b - a) / PRIMES_RANGE_TASK_MIN + 1);
+    len = (b - a) / num_tasks + 1;
+    len += (len % 2);
+    num_tasks = (b - a - 1) / len + 1;
+
+    args = flint_malloc(num_tasks * sizeof(_primes_range_arg_t));
+
+    for (i = 0; i < num_tasks; i++)
+    {
+        args[i].a = a + i * len;
+        args[i].b = (b - args[i].a > len) ? args[i].a + len : b;
+    }
+
+    if (num_tasks == 1)
+        _n_primes_range_worker(args);
+    else
+        flint_parallel_do(_n_primes_range_worker, args,
+                          sizeof(_primes_range_arg_t), num_tasks);
+
+    num = two;
+    for (i = 0; i < num_tasks; i++)
+        num += args[i].num;
+
+    *primes = flint_malloc(FLINT_MAX(num, 1) * sizeof(mp_limb_t));
+
+    if (two)
+        (*primes)[0] = 2;
+
+    num = two;
+    for (i = 0; i < num_tasks; i++)
+    {
+        memcpy(*primes + num, args[i].primes,
+               args[i].num * sizeof(mp_limb_t));
+        num += args[i].num;
+        flint_free(args[i].primes);
+    }
+
+    flint_free(args);
+
+    return num;
+}
@@ -0,0 +1,99 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   Compares n_discrete_log_bsgs with Pohlig-Hellman using precomputed
+   data for NUM logs to a primitive root of a random prime of each size.
+*/
+
+#define NUM 100
+
+typedef struct
+{
+   mp_bitcnt_t bits;
+   int algo;
+} info_t;
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   mp_limb_t p, g, b[NUM], r = 0;
+   n_discrete_log_ph_t L;
+   ulong i;
+   slong j;
+   FLINT_TEST_INIT(state);
+
+   for (i = 0; i < count; i++)
+   {
+      p = n_randprime(state, info->bits, 1);
+      g = n_primitive_root_prime(p);
+      for (j = 0; j < NUM; j++)
+         b[j] = n_randint(state, p - 1) + 1;
+
+      prof_start();
+      if (info->algo == 0)
+      {
+         for (j = 0; j < NUM; j++)
+            r += n_discrete_log_bsgs(b[j], g, p);
+      } else
+      {
+         n_discrete_log_ph_init(L, p);
+         for (j = 0; j < NUM; j++)
+            r += n_discrete_log_ph_run(L, b[j]);
+         n_discrete_log_ph_clear(L);
+      }
+      prof_stop();
+   }
+
+   if (r == 0)
+      flint_printf("\r");
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min[2], max;
+   info_t info;
+
+   flint_printf("times in us per log: bsgs, pohlig-hellman\n");
+
+   for (info.bits = 10; info.bits <= 30; info.bits += 4)
+   {
+      for (info.algo = 0; info.algo < 2; info.algo++)
+         prof_repeat(min + info.algo, &max, sample, (void *) &info);
+
+      flint_printf("bits %wu: %.2lf %.2lf\n",
+         info.bits, min[0]/NUM, min[1]/NUM);
+   }
+
+   return 0;
+}
@@ -0,0 +1,130 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   Compares the methods which n_factor chains together on composites left
+   over after trial division, which are what n_factor actually sees.
+*/
+
+#define NUM 256
+
+typedef struct
+{
+   mp_bitcnt_t bits;
+   int algo;
+} info_t;
+
+void fill_array(mp_limb_t * arr, mp_bitcnt_t bits, flint_rand_t state)
+{
+   n_factor_t factors;
+   mp_limb_t n, e;
+   slong i;
+
+   for (i = 0; i < NUM; i++)
+   {
+      do
+      {
+         n_factor_init(&factors);
+         n = n_factor_trial(&factors, n_randbits(state, bits),
+                            FLINT_FACTOR_TRIAL_PRIMES);
+      } while (FLINT_BIT_COUNT(n) + 8 < bits || n_is_prime(n)
+               || n_factor_power235(&e, n));
+
+      arr[i] = n;
+   }
+}
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   mp_limb_t arr[NUM], f;
+   ulong i;
+   slong j;
+   FLINT_TEST_INIT(state);
+
+   for (i = 0; i < count; i++)
+   {
+      fill_array(arr, info->bits, state);
+
+      prof_start();
+      for (j = 0; j < NUM; j++)
+      {
+         if (info->algo == 0)
+         {
+            n_factor_t factors;
+            n_factor_init(&factors);
+            n_factor(&factors, arr[j], 0);
+         } else if (info->algo == 1)
+         {
+            if (!n_factor_pollard_brent(&f, state, arr[j], 10, UWORD(1) << 20))
+               flint_printf("Error n = %wu\n", arr[j]);
+         } else if (info->algo == 2)
+         {
+            if (!n_factor_ecm(&f, FLINT_FACTOR_ECM_CURVES,
+                     FLINT_FACTOR_ECM_B1, FLINT_FACTOR_ECM_B2, state, arr[j]))
+               flint_printf("Error n = %wu\n", arr[j]);
+         } else
+         {
+            if (!n_factor_SQUFOF(arr[j], FLINT_FACTOR_SQUFOF_ITERS))
+               flint_printf("Error n = %wu\n", arr[j]);
+         }
+      }
+      prof_stop();
+   }
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min[4], max;
+   info_t info;
+   mp_bitcnt_t bits;
+   int algo;
+
+   flint_printf("times in us per number: n_factor, rho, ecm, SQUFOF\n");
+
+   for (bits = 32; bits <= FLINT_BITS; bits += 4)
+   {
+      info.bits = bits;
+
+      for (algo = 0; algo < 4; algo++)
+      {
+         info.algo = algo;
+         prof_repeat(min + algo, &max, sample, (void *) &info);
+      }
+
+      flint_printf("bits %wu: %.2lf %.2lf %.2lf %.2lf\n", bits,
+         min[0]/NUM, min[1]/NUM, min[2]/NUM, min[3]/NUM);
+   }
+
+   return 0;
+}
@@ -0,0 +1,102 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   Compares n_is_prime called in a loop with n_is_prime_vec, on random odd
+   numbers and on primes of the given size.
+*/
+
+#define NUM 1024
+
+typedef struct
+{
+   mp_bitcnt_t bits;
+   int primes;
+   int algo;
+} info_t;
+
+void sample(void * arg, ulong count)
+{
+   info_t * info = (info_t *) arg;
+   mp_limb_t arr[NUM];
+   int res[NUM];
+   ulong i;
+   slong j;
+   FLINT_TEST_INIT(state);
+
+   for (i = 0; i < count; i++)
+   {
+      for (j = 0; j < NUM; j++)
+      {
+         do
+         {
+            arr[j] = n_randbits(state, info->bits) | 1;
+         } while (info->primes && !n_is_prime(arr[j]));
+      }
+
+      prof_start();
+      if (info->algo == 0)
+      {
+         for (j = 0; j < NUM; j++)
+            res[j] = n_is_prime(arr[j]);
+      } else
+         n_is_prime_vec(res, arr, NUM);
+      prof_stop();
+   }
+
+   flint_randclear(state);
+}
+
+int main(void)
+{
+   double min[4], max;
+   info_t info;
+   mp_bitcnt_t bits;
+
+   flint_printf("times in ns per number: odd (loop, vec), primes (loop, vec)\n");
+
+   for (bits = 16; bits <= FLINT_BITS; bits += 8)
+   {
+      info.bits = bits;
+
+      for (info.primes = 0; info.primes < 2; info.primes++)
+      {
+         for (info.algo = 0; info.algo < 2; info.algo++)
+            prof_repeat(min + 2*info.primes + info.algo, &max, sample,
+                        (void *) &info);
+      }
+
+      flint_printf("bits %wu: %.1lf %.1lf %.1lf %.1lf\n", bits,
+         1000*min[0]/NUM, 1000*min[1]/NUM, 1000*min[2]/NUM, 1000*min[3]/NUM);
+   }
+
+   return 0;
+}
@@ -0,0 +1,119 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    slong i, j;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("discrete_log_ph....");
+    fflush(stdout);
+
+    /* logs to the primitive root of the precomputed data */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        n_discrete_log_ph_t L;
+        mp_limb_t p, g, b, x;
+
+        p = n_randprime(state, n_randint(state, 28) + 2, 1);
+
+        n_discrete_log_ph_init(L, p);
+        g = n_discrete_log_ph_primitive_root(L);
+
+        for (j = 0; j < 4; j++)
+        {
+            b = n_randint(state, p - 1) + 1;
+            x = n_discrete_log_ph_run(L, b);
+
+            if (x >= p - 1 || n_powmod2(g, x, p) != b)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("p = %wu, g = %wu, b = %wu, x = %wu\n",
+                             p, g, b, x);
+                abort();
+            }
+        }
+
+        n_discrete_log_ph_clear(L);
+    }
+
+    /* arbitrary bases, checked against baby-step giant-step */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        mp_limb_t p, a, b, x, y;
+
+        p = n_randprime(state, n_randint(state, 20) + 2, 1);
+        a = n_randint(state, p - 1) + 1;
+        b = n_powmod2(a, n_randtest(state), p);
+
+        x = n_discrete_log_ph(b, a, p);
+        y = n_discrete_log_bsgs(b, a, p);
+
+        if (x != y)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("p = %wu, a = %wu, b = %wu, x = %wu, y = %wu\n",
+                         p, a, b, x, y);
+            abort();
+        }
+    }
+
+#if FLINT64
+    /* large subgroups of safe primes are handled by Pollard rho */
+    for (i = 0; i < 5 * flint_test_multiplier(); i++)
+    {
+        mp_limb_t p, q, a, b, x;
+
+        do
+        {
+            q = n_randprime(state, 37 + n_randint(state, 2), 1);
+            p = 2 * q + 1;
+        } while (!n_is_prime(p));
+
+        a = n_randint(state, p - 1) + 1;
+        b = n_powmod2(a, n_randtest(state), p);
+
+        x = n_discrete_log_ph(b, a, p);
+
+        if (n_powmod2(a, x, p) != b)
+        {
+            flint_printf("FAIL (rho):\n");
+            flint_printf("p = %wu, a = %wu, b = %wu, x = %wu\n", p, a, b, x);
+            abort();
+        }
+    }
+#endif
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+   int i, result;
+   ulong count = UWORD(0);
+   FLINT_TEST_INIT(state);
+   
+
+   flint_printf("factor_ecm....");
+   fflush(stdout);
+
+   for (i = 0; i < 500 * flint_test_multiplier(); i++) /* Test random semiprimes */
+   {
+      mp_limb_t n, p, q, f;
+      int found;
+
+      p = n_randprime(state, n_randint(state, FLINT_BITS/2 - 7) + 8, 0);
+      q = n_randprime(state, n_randint(state, FLINT_BITS/2 - 7) + 8, 0);
+      n = p * q;
+
+      found = n_factor_ecm(&f, 200, 200, 10000, state, n);
+
+      if (found)
+      {
+         count++;
+         result = (f > 1 && f < n && n % f == UWORD(0));
+         if (!result)
+         {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, f = %wu, found = %d\n", n, f, found); 
+            abort();
+         }
+      }
+   }
+   
+   if (count < 490 * flint_test_multiplier())
+   {
+      flint_printf("FAIL:\n");
+      flint_printf("Only %wu numbers factored\n", count); 
+      abort();
+   }
+
+   FLINT_TEST_CLEANUP(state);
+   
+   flint_printf("PASS\n");
+   return 0;
+}
@@ -0,0 +1,104 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+   int i, result;
+   ulong count = UWORD(0);
+   FLINT_TEST_INIT(state);
+   
+
+   flint_printf("factor_pollard_brent....");
+   fflush(stdout);
+
+   for (i = 0; i < 1000 * flint_test_multiplier(); i++) /* Test random numbers */
+   {
+      mp_limb_t n, f;
+
+      do
+      {
+         n = n_randtest_bits(state, n_randint(state, FLINT_BITS) + 1);
+      } while (n < UWORD(4) || n_is_prime(n));
+
+      if (n_factor_pollard_brent(&f, state, n, 10, UWORD(1) << 16))
+      {
+         count++;
+         result = (f > 1 && f < n && n % f == UWORD(0));
+         if (!result)
+         {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, f = %wu\n", n, f); 
+            abort();
+         }
+      }
+   }
+   
+   if (count < 950 * flint_test_multiplier())
+   {
+      flint_printf("FAIL:\n");
+      flint_printf("Only %wu numbers factored\n", count); 
+      abort();
+   }
+
+   /* semiprimes with factors of similar size, using the single version */
+   for (i = 0; i < 200 * flint_test_multiplier(); i++)
+   {
+      mp_limb_t n, p, q, f, ninv;
+      ulong bits = n_randint(state, FLINT_BITS/2 - 7) + 8;
+      int j, found = 0;
+
+      p = n_randprime(state, bits, 0);
+      do {
+         q = n_randprime(state, bits, 0);
+      } while (q == p);
+      n = p*q;
+      ninv = n_mont_inverse(n);
+
+      for (j = 0; j < 10 && !found; j++)
+         found = n_factor_pollard_brent_single(&f, n, ninv,
+                   n_randint(state, n - 1) + 1, n_randint(state, n),
+                   UWORD(1) << (bits/2 + 4));
+
+      result = (found && (f == p || f == q));
+      if (!result)
+      {
+         flint_printf("FAIL:\n");
+         flint_printf("n = %wu, p = %wu, q = %wu, found = %d\n", n, p, q,
+                                                                   found); 
+         abort();
+      }
+   }
+
+   FLINT_TEST_CLEANUP(state);
+   
+   flint_printf("PASS\n");
+   return 0;
+}
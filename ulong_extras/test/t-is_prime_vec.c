@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/* strong pseudoprimes to base 2, some also to bases 7 and 61 */
+mp_limb_t spsp[] = {
+    UWORD(2047), UWORD(3277), UWORD(4033), UWORD(4681), UWORD(8321),
+    UWORD(15841), UWORD(29341), UWORD(42799), UWORD(49141), UWORD(52633),
+    UWORD(65281), UWORD(74665), UWORD(80581), UWORD(85489), UWORD(88357),
+    UWORD(90751), UWORD(3215031751)
+#if FLINT64
+    , UWORD(4759123141), UWORD(3825123056546413051)
+#endif
+};
+
+int main(void)
+{
+    int * res;
+    mp_ptr v;
+    slong i, j, len;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("is_prime_vec....");
+    fflush(stdout);
+
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        len = n_randint(state, 2000);
+        if (n_randint(state, 20) == 0)
+            len += n_randint(state, 20000);
+
+        v = flint_malloc(len * sizeof(mp_limb_t));
+        res = flint_malloc(len * sizeof(int));
+
+        for (j = 0; j < len; j++)
+        {
+            switch (n_randint(state, 5))
+            {
+                case 0:
+                    v[j] = n_randtest_prime(state, 0);
+                    break;
+                case 1:
+                    v[j] = spsp[n_randint(state,
+                                    sizeof(spsp) / sizeof(mp_limb_t))];
+                    break;
+                case 2:
+                    v[j] = n_randtest_prime(state, 0);
+                    v[j] *= n_randtest_prime(state, 0);
+                    break;
+                default:
+                    v[j] = n_randtest(state);
+            }
+        }
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        n_is_prime_vec(res, v, len);
+
+        for (j = 0; j < len; j++)
+        {
+            if (res[j] != n_is_prime(v[j]))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("n = %wu, res = %d\n", v[j], res[j]);
+                abort();
+            }
+        }
+
+        flint_free(v);
+        flint_free(res);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
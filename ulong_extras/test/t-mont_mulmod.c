@@ -0,0 +1,73 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+   int i, result;
+   FLINT_TEST_INIT(state);
+   
+
+   flint_printf("mont_mulmod....");
+   fflush(stdout);
+
+   for (i = 0; i < 100000 * flint_test_multiplier(); i++)
+   {
+      mp_limb_t a, b, n, ninv, npre, am, bm, r1, r2;
+
+      n = n_randtest_not_zero(state) | UWORD(1);
+      a = n_randint(state, n);
+      b = n_randint(state, n);
+
+      ninv = n_mont_inverse(n);
+      npre = n_preinvert_limb(n);
+
+      am = n_mont_set(a, n, npre);
+      bm = n_mont_set(b, n, npre);
+
+      r1 = n_mont_redc(n_mont_mulmod(am, bm, n, ninv), n, ninv);
+      r2 = n_mulmod2_preinv(a, b, n, npre);
+
+      result = (n*ninv == UWORD(1) && r1 == r2
+                && n_mont_redc(am, n, ninv) == a);
+      if (!result)
+      {
+         flint_printf("FAIL:\n");
+         flint_printf("a = %wu, b = %wu, n = %wu\n", a, b, n); 
+         flint_printf("r1 = %wu, r2 = %wu\n", r1, r2); 
+         abort();
+      }
+   }
+
+   FLINT_TEST_CLEANUP(state);
+   
+   flint_printf("PASS\n");
+   return 0;
+}
@@ -0,0 +1,97 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    int i;
+    mp_limb_t n, p;
+    ulong k;
+    const mp_limb_t tab[][2] = {
+        { UWORD(10000000), UWORD(664579) },
+        { UWORD(100000000), UWORD(5761455) },
+        { UWORD(1000000000), UWORD(50847534) },
+        { UWORD(4294967295), UWORD(203280221) },
+#if FLINT64
+        { UWORD(10000000000), UWORD(455052511) },
+        { UWORD(100000000000), UWORD(4118054813) }
+#endif
+    };
+
+    FLINT_TEST_INIT(state);
+    
+    flint_printf("prime_pi_lmo....");
+    fflush(stdout);
+
+    /* compare with the table of primes */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        n = n_randint(state, i % 4 == 0 ? 10000 : FLINT_PRIME_PI_LMO_CUTOFF);
+
+        if (n_prime_pi_lmo(n) != n_prime_pi(n))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, pi(n) = %wu, lmo %wu\n", n,
+                         n_prime_pi(n), n_prime_pi_lmo(n)); 
+            abort();
+        }
+    }
+
+    /* known values */
+    for (i = 0; i < sizeof(tab) / sizeof(tab[0]); i++)
+    {
+        if (n_prime_pi(tab[i][0]) != tab[i][1]
+            || n_prime_pi(tab[i][0] + 1) != tab[i][1])
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("pi(%wu) = %wu, expected %wu\n", tab[i][0],
+                         n_prime_pi(tab[i][0]), tab[i][1]); 
+            abort();
+        }
+    }
+
+    /* pi(p_k) = k and pi(p_k - 1) = k - 1 beyond the tables */
+    for (i = 0; i < 5 * flint_test_multiplier(); i++)
+    {
+        k = n_randint(state, UWORD(100000000)) + FLINT_NTH_PRIME_LMO_CUTOFF;
+        p = n_nth_prime(k);
+
+        if (!n_is_prime(p) || n_prime_pi(p) != k || n_prime_pi(p - 1) != k - 1)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("k = %wu, p_k = %wu, pi(p_k) = %wu\n", k, p,
+                         n_prime_pi(p)); 
+            abort();
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
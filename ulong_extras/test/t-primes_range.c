@@ -0,0 +1,129 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2026 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/* checks n_primes_range(a, b) against repeated n_nextprime */
+void
+check_range(mp_limb_t a, mp_limb_t b)
+{
+    mp_limb_t p, * primes;
+    slong j, num;
+
+    num = n_primes_range(&primes, a, b);
+
+    p = (a == 0) ? 0 : a - 1;
+    for (j = 0; j < num; j++)
+    {
+        p = n_nextprime(p, 0);
+
+        if (primes[j] != p || p >= b)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("a = %wu, b = %wu, j = %wd\n", a, b, j);
+            flint_printf("primes[j] = %wu, p = %wu\n", primes[j], p);
+            abort();
+        }
+    }
+
+    if (p < UWORD_MAX_PRIME && n_nextprime(p, 0) < b)
+    {
+        flint_printf("FAIL (missing primes):\n");
+        flint_printf("a = %wu, b = %wu, num = %wd\n", a, b, num);
+        abort();
+    }
+
+    flint_free(primes);
+}
+
+int main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("primes_range....");
+    fflush(stdout);
+
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        mp_limb_t a, b;
+        ulong len;
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                a = n_randint(state, 1000);
+                break;
+            case 1:
+                a = n_randint(state, UWORD(1) << 24);
+                break;
+            default:
+                a = n_randint(state, UWORD(1) << 40);
+        }
+
+        if (n_randint(state, 40) == 0)
+            len = n_randint(state, UWORD(1) << 21);
+        else
+            len = n_randint(state, 50000);
+
+        b = a + len;
+
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
+        check_range(a, b);
+    }
+
+    /*
+       Intervals whose length is a multiple of FLINT_SIEVE_SIZE: [3, 65539)
+       in a single task, and an interval split into two tasks of length
+       2^20 and 2^20 - 2.
+    */
+    flint_set_num_threads(1);
+    check_range(3, 3 + FLINT_SIEVE_SIZE);
+    check_range(UWORD(1) << 30, (UWORD(1) << 30) + 4 * FLINT_SIEVE_SIZE + 1);
+
+    flint_set_num_threads(2);
+    check_range(3, 3 + (UWORD(1) << 21) - 2);
+    check_range(UWORD(1) << 30, (UWORD(1) << 30) + (UWORD(1) << 21) - 2);
+
+    /* intervals ending at or near the top of the word */
+    check_range(UWORD_MAX - (UWORD(1) << 21), UWORD_MAX);
+
+    flint_set_num_threads(1);
+    check_range(UWORD_MAX - 1000, UWORD_MAX);
+    check_range(UWORD_MAX - 1000, UWORD_MAX - 1);
+    check_range(UWORD_MAX_PRIME, UWORD_MAX);
+    check_range(UWORD_MAX - FLINT_SIEVE_SIZE, UWORD_MAX);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}